@@ -41,6 +41,11 @@
 #include "util/traits.hpp"
 #include "hipSYCL/algorithms/util/allocation_cache.hpp"
 #include "hipSYCL/algorithms/util/memory_streaming.hpp"
+#include "hipSYCL/algorithms/scan/scan_descriptor.hpp"
+#include "hipSYCL/algorithms/scan/scan_engine.hpp"
+#include "hipSYCL/algorithms/sort/sort_traits.hpp"
+#include "hipSYCL/algorithms/sort/radix_sort.hpp"
+#include "hipSYCL/algorithms/sort/merge_sort.hpp"
 
 namespace hipsycl::algorithms {
 
@@ -87,6 +92,47 @@ inline bool should_use_memset(const sycl::device& dev) {
   return true;
 }
 
+// Stream compaction: Runs a scan over the selection flags of all
+// elements and hands each element's output position to scatter.
+// * IsSelected must be a callable of signature bool(std::size_t);
+// * Scatter must be a callable of signature
+//   void(std::size_t idx, std::size_t num_selected_before, bool is_selected).
+// If num_selected is not nullptr, the total number of selected elements is
+// written to it once the returned event has completed.
+struct compaction_state {
+  // Number of selected elements up to and including this one
+  std::size_t num_selected;
+  // Whether this element is selected. Carried through the scan
+  // so that the selection is only evaluated once per element.
+  bool is_selected;
+};
+
+template <class IsSelected, class Scatter>
+sycl::event compact(sycl::queue &q, util::allocation_group &scratch_allocations,
+                    std::size_t problem_size, IsSelected is_selected,
+                    Scatter scatter, std::size_t *num_selected) {
+  auto op = [](const compaction_state &a, const compaction_state &b) {
+    return compaction_state{a.num_selected + b.num_selected, b.is_selected};
+  };
+  auto generator = [=](std::size_t i) -> compaction_state {
+    bool selected = is_selected(i);
+    return compaction_state{selected ? std::size_t{1} : std::size_t{0},
+                            selected};
+  };
+  auto result_processor = [=](std::size_t i, const compaction_state &state) {
+    scatter(i, state.num_selected - (state.is_selected ? 1 : 0),
+            state.is_selected);
+    if(num_selected && i == problem_size - 1)
+      *num_selected = state.num_selected;
+  };
+
+  scanning::scan_descriptor<compaction_state, decltype(op),
+                            decltype(generator), decltype(result_processor)>
+      desc{scanning::scan_type::inclusive, problem_size, op, generator,
+           result_processor};
+  return scanning::scan(q, scratch_allocations, desc);
+}
+
 }
 
 template <class ForwardIt, class UnaryFunction2>
@@ -182,23 +228,127 @@ sycl::event copy(sycl::queue &q, ForwardIt1 first, ForwardIt1 last,
 }
 
 
-template<class ForwardIt1, class ForwardIt2, class UnaryPredicate >
-sycl::event copy_if(sycl::queue& q,
-                    ForwardIt1 first, ForwardIt1 last,
-                    ForwardIt2 d_first,
-                    UnaryPredicate pred) {
+// Note: The compacting algorithms below (copy_if, remove_copy_if,
+// partition_copy, unique_copy) cannot return the output end iterator
+// directly since it is only known once the kernels have completed.
+// Instead, if the optional result slot num_elements_copied is provided,
+// the number of elements written to the output is stored there. The slot
+// must be accessible from the device and is valid once the returned event
+// has completed. If first==last, no operation is enqueued, the returned event
+// is complete and the result slot is not written.
+template <class ForwardIt1, class ForwardIt2, class UnaryPredicate>
+sycl::event copy_if(sycl::queue &q,
+                    util::allocation_group &scratch_allocations,
+                    ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first,
+                    UnaryPredicate pred,
+                    std::size_t *num_elements_copied = nullptr) {
   if(first == last)
     return sycl::event{};
-  return q.parallel_for(sycl::range{std::distance(first, last)},
-                        [=](sycl::id<1> id) {
-                          auto input = first;
-                          auto output = d_first;
-                          std::advance(input, id[0]);
-                          std::advance(output, id[0]);
-                          auto input_v = *input;
-                          if(pred(input_v))
-                            *output = input_v;
-                        });
+
+  auto is_selected = [=](std::size_t i) -> bool {
+    auto input = first;
+    std::advance(input, i);
+    return pred(*input);
+  };
+  auto scatter = [=](std::size_t i, std::size_t pos, bool selected) {
+    if(selected) {
+      auto input = first;
+      auto output = d_first;
+      std::advance(input, i);
+      std::advance(output, pos);
+      *output = *input;
+    }
+  };
+  return detail::compact(q, scratch_allocations, std::distance(first, last),
+                         is_selected, scatter, num_elements_copied);
+}
+
+template <class ForwardIt1, class ForwardIt2, class UnaryPredicate>
+sycl::event remove_copy_if(sycl::queue &q,
+                           util::allocation_group &scratch_allocations,
+                           ForwardIt1 first, ForwardIt1 last,
+                           ForwardIt2 d_first, UnaryPredicate pred,
+                           std::size_t *num_elements_copied = nullptr) {
+  return copy_if(
+      q, scratch_allocations, first, last, d_first,
+      [=](const auto &x) { return !pred(x); }, num_elements_copied);
+}
+
+// For partition_copy, num_elements_copied_true receives the number of
+// elements written to d_first_true. The number of elements written to
+// d_first_false is the problem size minus that value.
+template <class ForwardIt1, class ForwardIt2, class ForwardIt3,
+          class UnaryPredicate>
+sycl::event partition_copy(sycl::queue &q,
+                           util::allocation_group &scratch_allocations,
+                           ForwardIt1 first, ForwardIt1 last,
+                           ForwardIt2 d_first_true, ForwardIt3 d_first_false,
+                           UnaryPredicate p,
+                           std::size_t *num_elements_copied_true = nullptr) {
+  if(first == last)
+    return sycl::event{};
+
+  auto is_selected = [=](std::size_t i) -> bool {
+    auto input = first;
+    std::advance(input, i);
+    return p(*input);
+  };
+  auto scatter = [=](std::size_t i, std::size_t pos, bool selected) {
+    auto input = first;
+    std::advance(input, i);
+    if(selected) {
+      auto output = d_first_true;
+      std::advance(output, pos);
+      *output = *input;
+    } else {
+      auto output = d_first_false;
+      std::advance(output, i - pos);
+      *output = *input;
+    }
+  };
+  return detail::compact(q, scratch_allocations, std::distance(first, last),
+                         is_selected, scatter, num_elements_copied_true);
+}
+
+template <class ForwardIt1, class ForwardIt2, class BinaryPredicate>
+sycl::event unique_copy(sycl::queue &q,
+                        util::allocation_group &scratch_allocations,
+                        ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first,
+                        BinaryPredicate p,
+                        std::size_t *num_elements_copied = nullptr) {
+  if(first == last)
+    return sycl::event{};
+
+  auto is_selected = [=](std::size_t i) -> bool {
+    if(i == 0)
+      return true;
+    auto current = first;
+    std::advance(current, i);
+    auto previous = first;
+    std::advance(previous, i - 1);
+    return !p(*previous, *current);
+  };
+  auto scatter = [=](std::size_t i, std::size_t pos, bool selected) {
+    if(selected) {
+      auto input = first;
+      auto output = d_first;
+      std::advance(input, i);
+      std::advance(output, pos);
+      *output = *input;
+    }
+  };
+  return detail::compact(q, scratch_allocations, std::distance(first, last),
+                         is_selected, scatter, num_elements_copied);
+}
+
+template <class ForwardIt1, class ForwardIt2>
+sycl::event unique_copy(sycl::queue &q,
+                        util::allocation_group &scratch_allocations,
+                        ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first,
+                        std::size_t *num_elements_copied = nullptr) {
+  return unique_copy(
+      q, scratch_allocations, first, last, d_first,
+      [](const auto &a, const auto &b) { return a == b; }, num_elements_copied);
 }
 
 template<class ForwardIt1, class Size, class ForwardIt2 >
@@ -469,6 +619,87 @@ sycl::event none_of(sycl::queue &q,
   });
 }
 
+namespace detail {
+
+template <class RandomIt, class Compare, class ValueIt>
+sycl::event sort_impl(sycl::queue &q,
+                      util::allocation_group &scratch_allocations,
+                      RandomIt first, RandomIt last, Compare comp,
+                      ValueIt values_first) {
+  std::size_t problem_size = std::distance(first, last);
+  if(problem_size < 2)
+    return sycl::event{};
+
+  using key_type = typename std::iterator_traits<RandomIt>::value_type;
+  using order = sorting::comparator_order<Compare, key_type>;
+
+  if constexpr (sorting::radix_key<key_type>::is_supported &&
+                (order::is_ascending || order::is_descending)) {
+    return sorting::radix_sort::run(q, scratch_allocations, first,
+                                    problem_size, order::is_descending,
+                                    values_first);
+  } else {
+    return sorting::merge_sort::run(q, scratch_allocations, first,
+                                    problem_size, comp, values_first);
+  }
+}
+
+}
+
+// Note: All sorting algorithms are stable, so sort and stable_sort
+// are equivalent. Arithmetic keys that are compared using std::less or
+// std::greater are sorted using radix sort, all other cases use merge sort.
+// The radix sort waits for an initial histogram kernel to complete to
+// decide which digits need to be sorted; apart from that, the sorting
+// algorithms are asynchronous.
+// Keys and values must be trivially copyable.
+template <class RandomIt, class Compare>
+sycl::event sort(sycl::queue &q, util::allocation_group &scratch_allocations,
+                 RandomIt first, RandomIt last, Compare comp) {
+  return detail::sort_impl(q, scratch_allocations, first, last, comp,
+                           sorting::no_values{});
+}
+
+template <class RandomIt>
+sycl::event sort(sycl::queue &q, util::allocation_group &scratch_allocations,
+                 RandomIt first, RandomIt last) {
+  return sort(q, scratch_allocations, first, last, std::less<>{});
+}
+
+template <class RandomIt, class Compare>
+sycl::event stable_sort(sycl::queue &q,
+                        util::allocation_group &scratch_allocations,
+                        RandomIt first, RandomIt last, Compare comp) {
+  return sort(q, scratch_allocations, first, last, comp);
+}
+
+template <class RandomIt>
+sycl::event stable_sort(sycl::queue &q,
+                        util::allocation_group &scratch_allocations,
+                        RandomIt first, RandomIt last) {
+  return sort(q, scratch_allocations, first, last);
+}
+
+// Sorts the keys in [keys_first, keys_last), and applies the same
+// permutation to the values starting at values_first.
+template <class RandomIt1, class RandomIt2, class Compare>
+sycl::event sort_by_key(sycl::queue &q,
+                        util::allocation_group &scratch_allocations,
+                        RandomIt1 keys_first, RandomIt1 keys_last,
+                        RandomIt2 values_first, Compare comp) {
+  return detail::sort_impl(q, scratch_allocations, keys_first, keys_last, comp,
+                           values_first);
+}
+
+template <class RandomIt1, class RandomIt2>
+sycl::event sort_by_key(sycl::queue &q,
+                        util::allocation_group &scratch_allocations,
+                        RandomIt1 keys_first, RandomIt1 keys_last,
+                        RandomIt2 values_first) {
+  return sort_by_key(q, scratch_allocations, keys_first, keys_last,
+                     values_first, std::less<>{});
+}
+
 }
 
 #endif
@@ -41,6 +41,8 @@
 #include "hipSYCL/algorithms/reduction/reduction_descriptor.hpp"
 #include "hipSYCL/algorithms/reduction/reduction_engine.hpp"
 #include "hipSYCL/algorithms/util/memory_streaming.hpp"
+#include "hipSYCL/algorithms/scan/scan_descriptor.hpp"
+#include "hipSYCL/algorithms/scan/scan_engine.hpp"
 
 namespace hipsycl::algorithms {
 
@@ -207,6 +209,35 @@ sycl::event transform_reduce_impl(sycl::queue &q,
 
 }
 
+template <class T, class ForwardIt1, class ForwardIt2, class BinaryOp,
+          class UnaryTransformOp, class... Init>
+sycl::event transform_scan_impl(sycl::queue &q,
+                                util::allocation_group &scratch_allocations,
+                                scanning::scan_type type, ForwardIt1 first,
+                                ForwardIt1 last, ForwardIt2 d_first,
+                                BinaryOp op, UnaryTransformOp transform,
+                                const Init &...init) {
+  if(first == last)
+    return sycl::event{};
+
+  std::size_t n = std::distance(first, last);
+  auto generator = [=](std::size_t i) -> T {
+    auto input = first;
+    std::advance(input, i);
+    return transform(*input);
+  };
+  auto result_processor = [=](std::size_t i, const T& value) {
+    auto output = d_first;
+    std::advance(output, i);
+    *output = value;
+  };
+
+  scanning::scan_descriptor<T, BinaryOp, decltype(generator),
+                            decltype(result_processor)>
+      desc{type, n, op, generator, result_processor, static_cast<T>(init)...};
+  return scanning::scan(q, scratch_allocations, desc);
+}
+
 }
 
 // Note: All transform_reduce variants defined here behave slightly different than STL
@@ -289,6 +320,97 @@ sycl::event reduce(sycl::queue &q, util::allocation_group &scratch_allocations,
                 typename std::iterator_traits<ForwardIt>::value_type{});
 }
 
+// Note: As with transform_reduce, if first==last, the scans return an event
+// that is complete, even if preceding enqueued operations are not yet
+// complete.
+//
+// On host devices, a blocked two-pass scan is used; other devices use
+// a single-pass scan with decoupled look-back. Scans can operate in-place,
+// i.e. d_first == first.
+template <class ForwardIt1, class ForwardIt2, class BinaryOp,
+          class UnaryTransformOp>
+sycl::event
+transform_inclusive_scan(sycl::queue &q,
+                         util::allocation_group &scratch_allocations,
+                         ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first,
+                         BinaryOp op, UnaryTransformOp transform) {
+  using value_type = std::decay_t<decltype(transform(*first))>;
+  return detail::transform_scan_impl<value_type>(
+      q, scratch_allocations, scanning::scan_type::inclusive, first, last,
+      d_first, op, transform);
+}
+
+template <class ForwardIt1, class ForwardIt2, class BinaryOp,
+          class UnaryTransformOp, class T>
+sycl::event
+transform_inclusive_scan(sycl::queue &q,
+                         util::allocation_group &scratch_allocations,
+                         ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first,
+                         BinaryOp op, UnaryTransformOp transform, T init) {
+  return detail::transform_scan_impl<T>(q, scratch_allocations,
+                                        scanning::scan_type::inclusive, first,
+                                        last, d_first, op, transform, init);
+}
+
+template <class ForwardIt1, class ForwardIt2, class T, class BinaryOp,
+          class UnaryTransformOp>
+sycl::event
+transform_exclusive_scan(sycl::queue &q,
+                         util::allocation_group &scratch_allocations,
+                         ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first,
+                         T init, BinaryOp op, UnaryTransformOp transform) {
+  return detail::transform_scan_impl<T>(q, scratch_allocations,
+                                        scanning::scan_type::exclusive, first,
+                                        last, d_first, op, transform, init);
+}
+
+template <class ForwardIt1, class ForwardIt2, class BinaryOp>
+sycl::event inclusive_scan(sycl::queue &q,
+                           util::allocation_group &scratch_allocations,
+                           ForwardIt1 first, ForwardIt1 last,
+                           ForwardIt2 d_first, BinaryOp op) {
+  using value_type = typename std::iterator_traits<ForwardIt1>::value_type;
+  return detail::transform_scan_impl<value_type>(
+      q, scratch_allocations, scanning::scan_type::inclusive, first, last,
+      d_first, op, [](const auto &x) { return x; });
+}
+
+template <class ForwardIt1, class ForwardIt2, class BinaryOp, class T>
+sycl::event inclusive_scan(sycl::queue &q,
+                           util::allocation_group &scratch_allocations,
+                           ForwardIt1 first, ForwardIt1 last,
+                           ForwardIt2 d_first, BinaryOp op, T init) {
+  return transform_inclusive_scan(q, scratch_allocations, first, last, d_first,
+                                  op, [](const auto &x) { return x; }, init);
+}
+
+template <class ForwardIt1, class ForwardIt2>
+sycl::event inclusive_scan(sycl::queue &q,
+                           util::allocation_group &scratch_allocations,
+                           ForwardIt1 first, ForwardIt1 last,
+                           ForwardIt2 d_first) {
+  return inclusive_scan(q, scratch_allocations, first, last, d_first,
+                        std::plus<>{});
+}
+
+template <class ForwardIt1, class ForwardIt2, class T, class BinaryOp>
+sycl::event exclusive_scan(sycl::queue &q,
+                           util::allocation_group &scratch_allocations,
+                           ForwardIt1 first, ForwardIt1 last,
+                           ForwardIt2 d_first, T init, BinaryOp op) {
+  return transform_exclusive_scan(q, scratch_allocations, first, last, d_first,
+                                  init, op, [](const auto &x) { return x; });
+}
+
+template <class ForwardIt1, class ForwardIt2, class T>
+sycl::event exclusive_scan(sycl::queue &q,
+                           util::allocation_group &scratch_allocations,
+                           ForwardIt1 first, ForwardIt1 last,
+                           ForwardIt2 d_first, T init) {
+  return exclusive_scan(q, scratch_allocations, first, last, d_first, init,
+                        std::plus<>{});
+}
+
 }
 
 #endif
@@ -0,0 +1,141 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef HIPSYCL_ALGORITHMS_BLOCKED_SCAN_HPP
+#define HIPSYCL_ALGORITHMS_BLOCKED_SCAN_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+
+#include "hipSYCL/sycl/event.hpp"
+#include "hipSYCL/sycl/queue.hpp"
+#include "hipSYCL/sycl/info/device.hpp"
+#include "hipSYCL/algorithms/util/allocation_cache.hpp"
+#include "scan_descriptor.hpp"
+
+namespace hipsycl::algorithms::scanning {
+
+/// Two-pass scan for CPU devices: The input is split into one contiguous
+/// block per thread. The first pass computes the aggregate of each block,
+/// the second pass derives each block's prefix from the aggregates of its
+/// predecessors and scans the block sequentially.
+///
+/// Since the number of blocks is on the order of the number of threads,
+/// combining the block aggregates redundantly in each block is cheaper
+/// than an additional kernel launch.
+class blocked_scan {
+public:
+  // Blocks smaller than this are not worth distributing across threads
+  static constexpr std::size_t min_block_size = 4096;
+
+  template <class ScanDescriptor>
+  static sycl::event run(sycl::queue &q,
+                         util::allocation_group &scratch_allocations,
+                         const ScanDescriptor &desc) {
+    using T = typename ScanDescriptor::value_type;
+
+    const std::size_t problem_size = desc.get_problem_size();
+    const std::size_t max_num_blocks = std::max<std::size_t>(
+        1, q.get_device().get_info<sycl::info::device::max_compute_units>());
+    const std::size_t num_blocks = std::min(
+        max_num_blocks, (problem_size + min_block_size - 1) / min_block_size);
+    const std::size_t block_size = (problem_size + num_blocks - 1) / num_blocks;
+
+    auto get_block_begin = [=](std::size_t block) {
+      return std::min(problem_size, block * block_size);
+    };
+    auto get_block_end = [=](std::size_t block) {
+      return std::min(problem_size, (block + 1) * block_size);
+    };
+
+    sycl::event block_aggregates_computed;
+    T* block_aggregates = nullptr;
+    if(num_blocks > 1) {
+      // The last block's aggregate is never needed
+      block_aggregates = scratch_allocations.obtain<T>(num_blocks - 1);
+      block_aggregates_computed = q.parallel_for(
+          sycl::range<1>{num_blocks - 1}, [=](sycl::id<1> idx) {
+            const std::size_t begin = get_block_begin(idx[0]);
+            const std::size_t end = get_block_end(idx[0]);
+
+            const auto &op = desc.get_operator();
+            const auto &gen = desc.get_generator();
+
+            T current = gen(begin);
+            for(std::size_t i = begin + 1; i < end; ++i)
+              current = op(current, gen(i));
+            block_aggregates[idx[0]] = current;
+          });
+    }
+
+    return q.parallel_for(
+        sycl::range<1>{num_blocks}, block_aggregates_computed,
+        [=](sycl::id<1> idx) {
+          const std::size_t block = idx[0];
+          const std::size_t begin = get_block_begin(block);
+          const std::size_t end = get_block_end(block);
+
+          const auto &op = desc.get_operator();
+          const auto &gen = desc.get_generator();
+          const auto &processor = desc.get_result_processor();
+
+          // Does not require T to be default-constructible
+          std::optional<T> prefix;
+          if(desc.has_init())
+            prefix.emplace(desc.get_init());
+          for(std::size_t i = 0; i < block; ++i) {
+            if(prefix)
+              prefix.emplace(op(*prefix, block_aggregates[i]));
+            else
+              prefix.emplace(block_aggregates[i]);
+          }
+
+          if(desc.is_inclusive()) {
+            for(std::size_t i = begin; i < end; ++i) {
+              T current = gen(i);
+              if(prefix)
+                prefix.emplace(op(*prefix, current));
+              else
+                prefix.emplace(current);
+              processor(i, *prefix);
+            }
+          } else {
+            // Exclusive scans always have an init value, so
+            // prefix is always valid.
+            for(std::size_t i = begin; i < end; ++i) {
+              T current = gen(i);
+              processor(i, *prefix);
+              prefix.emplace(op(*prefix, current));
+            }
+          }
+        });
+  }
+};
+
+}
+
+#endif
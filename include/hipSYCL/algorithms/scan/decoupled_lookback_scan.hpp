@@ -0,0 +1,258 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef HIPSYCL_ALGORITHMS_DECOUPLED_LOOKBACK_SCAN_HPP
+#define HIPSYCL_ALGORITHMS_DECOUPLED_LOOKBACK_SCAN_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+
+#include "hipSYCL/sycl/event.hpp"
+#include "hipSYCL/sycl/queue.hpp"
+#include "hipSYCL/sycl/libkernel/atomic_builtins.hpp"
+#include "hipSYCL/sycl/libkernel/accessor.hpp"
+#include "hipSYCL/sycl/libkernel/nd_item.hpp"
+#include "hipSYCL/sycl/libkernel/detail/local_memory_allocator.hpp"
+#include "hipSYCL/algorithms/reduction/wg_model/group_reduction_algorithms.hpp"
+#include "hipSYCL/algorithms/util/allocation_cache.hpp"
+#include "scan_descriptor.hpp"
+
+namespace hipsycl::algorithms::scanning {
+
+/// Single-pass scan for GPU devices based on decoupled look-back
+/// (Merrill & Garland, "Single-pass Parallel Prefix Scan with Decoupled
+/// Look-back", 2016).
+///
+/// Each work group scans one tile of the input. Tiles are assigned in the
+/// order in which work groups start executing, so that all predecessors of
+/// a tile are guaranteed to make progress. Each tile first publishes its
+/// local aggregate, then walks backwards over its predecessors, accumulating
+/// their aggregates until it finds a predecessor that has already published
+/// its inclusive prefix. This way, the input is only read once.
+class decoupled_lookback_scan {
+public:
+  static constexpr std::size_t group_size = 128;
+  static constexpr std::size_t items_per_work_item = 8;
+  static constexpr std::size_t tile_size = group_size * items_per_work_item;
+
+  template <class ScanDescriptor>
+  static sycl::event run(sycl::queue &q,
+                         util::allocation_group &scratch_allocations,
+                         const ScanDescriptor &desc) {
+    using T = typename ScanDescriptor::value_type;
+
+    const std::size_t problem_size = desc.get_problem_size();
+    const std::size_t num_tiles = (problem_size + tile_size - 1) / tile_size;
+
+    // Tile status and the tile counter need to be reset for each invocation
+    tile_status_t *tile_status =
+        scratch_allocations.obtain<tile_status_t>(num_tiles + 1);
+    tile_status_t *tile_counter = tile_status + num_tiles;
+    T *tile_aggregates = scratch_allocations.obtain<T>(num_tiles);
+    T *tile_prefixes = scratch_allocations.obtain<T>(num_tiles);
+
+    sycl::event status_initialized =
+        q.parallel_for(sycl::range<1>{num_tiles + 1}, [=](sycl::id<1> idx) {
+          tile_status[idx[0]] = status_invalid;
+        });
+
+    std::size_t local_mem_size = 0;
+    sycl::detail::local_memory_allocator local_mem_alloc;
+    const auto scan_addr = local_mem_alloc.alloc<T>(group_size);
+    const auto tile_prefix_addr = local_mem_alloc.alloc<T>(1);
+    const auto tile_info_addr = local_mem_alloc.alloc<tile_status_t>(2);
+    local_mem_size = local_mem_alloc.get_allocation_size();
+
+    auto kernel = [=](sycl::nd_item<1> idx) {
+      using sycl::detail::local_memory;
+      using reduction::wg_model::group_reductions::local_barrier;
+
+      const auto& op = desc.get_operator();
+      const auto& gen = desc.get_generator();
+      const auto& processor = desc.get_result_processor();
+
+      T *scan_mem = local_memory::get_ptr<T>(scan_addr);
+      T *tile_prefix_mem = local_memory::get_ptr<T>(tile_prefix_addr);
+      // [0]: tile id, [1]: whether the tile prefix is valid
+      tile_status_t *tile_info_mem =
+          local_memory::get_ptr<tile_status_t>(tile_info_addr);
+
+      const std::size_t lid = idx.get_local_id(0);
+
+      if(lid == 0) {
+        tile_info_mem[0] = sycl::detail::__hipsycl_atomic_fetch_add<
+            sycl::access::address_space::global_space>(
+            tile_counter, 1, sycl::memory_order_relaxed,
+            sycl::memory_scope_device);
+      }
+      local_barrier(idx);
+
+      const std::size_t tile = tile_info_mem[0];
+      const std::size_t tile_begin = tile * tile_size;
+      const std::size_t num_tile_items =
+          std::min(tile_size, problem_size - tile_begin);
+      const std::size_t num_active_items =
+          (num_tile_items + items_per_work_item - 1) / items_per_work_item;
+
+      const std::size_t item_begin = tile_begin + lid * items_per_work_item;
+      const std::size_t num_items =
+          item_begin < problem_size
+              ? std::min(items_per_work_item, problem_size - item_begin)
+              : 0;
+
+      // Load all values before writing any results, so that
+      // in-place scans work. std::optional is used here and below
+      // so that T need not be default-constructible.
+      std::optional<T> values[items_per_work_item];
+      for(std::size_t i = 0; i < num_items; ++i) {
+        T current = gen(item_begin + i);
+        if(i > 0)
+          values[i].emplace(op(*values[i - 1], current));
+        else
+          values[i].emplace(current);
+      }
+      if(num_items > 0)
+        scan_mem[lid] = *values[num_items - 1];
+      local_barrier(idx);
+
+      // Inclusive Hillis-Steele scan of the work item aggregates.
+      // Inactive work items are always at the end of the group,
+      // so active work items never depend on them.
+      for(std::size_t offset = 1; offset < num_active_items; offset *= 2) {
+        const bool participates = lid < num_active_items && lid >= offset;
+        std::optional<T> updated;
+        if(participates)
+          updated.emplace(op(scan_mem[lid - offset], scan_mem[lid]));
+        local_barrier(idx);
+        if(participates)
+          scan_mem[lid] = *updated;
+        local_barrier(idx);
+      }
+
+      if(lid == 0) {
+        const T tile_aggregate = scan_mem[num_active_items - 1];
+
+        std::optional<T> exclusive_prefix;
+        if(desc.has_init())
+          exclusive_prefix.emplace(desc.get_init());
+
+        if(tile > 0) {
+          tile_aggregates[tile] = tile_aggregate;
+          store_status(tile_status + tile, status_aggregate_available);
+
+          std::optional<T> lookback_value;
+          for(std::size_t predecessor = tile - 1;; --predecessor) {
+            tile_status_t status;
+            do {
+              status = load_status(tile_status + predecessor);
+            } while(status == status_invalid);
+
+            const T &predecessor_value = (status == status_prefix_available)
+                                             ? tile_prefixes[predecessor]
+                                             : tile_aggregates[predecessor];
+            if(lookback_value)
+              lookback_value.emplace(op(predecessor_value, *lookback_value));
+            else
+              lookback_value.emplace(predecessor_value);
+
+            // Tile 0 always publishes its prefix directly,
+            // so this loop is guaranteed to terminate.
+            if(status == status_prefix_available)
+              break;
+          }
+          // The prefix of tile 0 already includes the init value
+          exclusive_prefix = lookback_value;
+        }
+
+        tile_prefixes[tile] = exclusive_prefix
+                                  ? op(*exclusive_prefix, tile_aggregate)
+                                  : tile_aggregate;
+        store_status(tile_status + tile, status_prefix_available);
+
+        if(exclusive_prefix)
+          *tile_prefix_mem = *exclusive_prefix;
+        tile_info_mem[1] = exclusive_prefix.has_value();
+      }
+      local_barrier(idx);
+
+      std::optional<T> prefix;
+      if(tile_info_mem[1])
+        prefix.emplace(*tile_prefix_mem);
+      if(lid > 0 && num_items > 0) {
+        if(prefix)
+          prefix.emplace(op(*prefix, scan_mem[lid - 1]));
+        else
+          prefix.emplace(scan_mem[lid - 1]);
+      }
+
+      if(desc.is_inclusive()) {
+        for(std::size_t i = 0; i < num_items; ++i)
+          processor(item_begin + i,
+                    prefix ? op(*prefix, *values[i]) : *values[i]);
+      } else {
+        // Exclusive scans always have an init value,
+        // so prefix is always valid.
+        for(std::size_t i = 0; i < num_items; ++i)
+          processor(item_begin + i,
+                    i == 0 ? *prefix : op(*prefix, *values[i - 1]));
+      }
+    };
+
+    return q.submit([&](sycl::handler &cgh) {
+      cgh.depends_on(status_initialized);
+      // This is just there to register the appropriate amount of local
+      // memory; the kernel will access it directly without going
+      // through the accessor.
+      sycl::local_accessor<char> acc{sycl::range<1>{local_mem_size}, cgh};
+      cgh.parallel_for(sycl::nd_range<1>{num_tiles * group_size, group_size},
+                       kernel);
+    });
+  }
+
+private:
+  using tile_status_t = int;
+
+  static constexpr tile_status_t status_invalid = 0;
+  static constexpr tile_status_t status_aggregate_available = 1;
+  static constexpr tile_status_t status_prefix_available = 2;
+
+  static tile_status_t load_status(tile_status_t *status) {
+    return sycl::detail::__hipsycl_atomic_load<
+        sycl::access::address_space::global_space>(
+        status, sycl::memory_order_acquire, sycl::memory_scope_device);
+  }
+
+  static void store_status(tile_status_t *status, tile_status_t value) {
+    sycl::detail::__hipsycl_atomic_store<
+        sycl::access::address_space::global_space>(
+        status, value, sycl::memory_order_release, sycl::memory_scope_device);
+  }
+};
+
+}
+
+#endif
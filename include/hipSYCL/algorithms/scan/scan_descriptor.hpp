@@ -0,0 +1,91 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef HIPSYCL_ALGORITHMS_SCAN_DESCRIPTOR_HPP
+#define HIPSYCL_ALGORITHMS_SCAN_DESCRIPTOR_HPP
+
+#include <cstddef>
+#include <optional>
+
+namespace hipsycl::algorithms::scanning {
+
+enum class scan_type {
+  inclusive,
+  exclusive
+};
+
+/// Describes a scan operation independently of the algorithm that is
+/// used to carry it out.
+///
+/// * Generator is a callable of signature T(std::size_t) that returns the
+///   (possibly transformed) input value at the given position.
+/// * ResultProcessor is a callable of signature void(std::size_t, const T&)
+///   that is invoked exactly once for each position with the scan result.
+///   For in-place scans, the generator is guaranteed to have been invoked
+///   for a position before the result processor is invoked for it.
+///
+/// Exclusive scans require an initial value; inclusive scans may optionally
+/// use one which is then combined with all results from the left.
+template <class T, class BinaryOp, class Generator, class ResultProcessor>
+class scan_descriptor {
+public:
+  using value_type = T;
+
+  scan_descriptor(scan_type type, std::size_t problem_size, BinaryOp op,
+                  Generator gen, ResultProcessor processor)
+      : _type{type}, _problem_size{problem_size}, _op{op}, _gen{gen},
+        _processor{processor}, _init{} {}
+
+  scan_descriptor(scan_type type, std::size_t problem_size, BinaryOp op,
+                  Generator gen, ResultProcessor processor, T init)
+      : _type{type}, _problem_size{problem_size}, _op{op}, _gen{gen},
+        _processor{processor}, _init{init} {}
+
+  scan_type get_type() const noexcept { return _type; }
+  bool is_inclusive() const noexcept { return _type == scan_type::inclusive; }
+  std::size_t get_problem_size() const noexcept { return _problem_size; }
+  const BinaryOp& get_operator() const noexcept { return _op; }
+  const Generator& get_generator() const noexcept { return _gen; }
+  const ResultProcessor& get_result_processor() const noexcept {
+    return _processor;
+  }
+
+  bool has_init() const noexcept { return _init.has_value(); }
+  /// Only valid if has_init() is true
+  const T& get_init() const noexcept { return *_init; }
+
+private:
+  scan_type _type;
+  std::size_t _problem_size;
+  BinaryOp _op;
+  Generator _gen;
+  ResultProcessor _processor;
+  std::optional<T> _init;
+};
+
+}
+
+#endif
@@ -0,0 +1,196 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HIPSYCL_ALGORITHMS_MERGE_SORT_HPP
+#define HIPSYCL_ALGORITHMS_MERGE_SORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "hipSYCL/sycl/event.hpp"
+#include "hipSYCL/sycl/queue.hpp"
+#include "hipSYCL/algorithms/util/allocation_cache.hpp"
+#include "sort_traits.hpp"
+
+namespace hipsycl::algorithms::sorting {
+
+/// Stable bottom-up merge sort for arbitrary comparators.
+///
+/// Small blocks are first sorted by one work item each using insertion sort.
+/// Afterwards, sorted runs are merged pairwise until a single run remains.
+/// In each merge pass, every work item produces a fixed-size chunk of the
+/// output: It locates the start of its chunk in the two input runs using a
+/// binary search along the merge path, and then merges sequentially.
+/// This keeps the work per pass linear in the problem size and does not
+/// require any synchronization within a pass.
+///
+/// As the other algorithms, run() relies on q being an in-order queue.
+class merge_sort {
+public:
+  // Must be powers of two
+  static constexpr std::size_t block_size = 16;
+  static constexpr std::size_t device_chunk_size = 16;
+  static constexpr std::size_t host_chunk_size = 4096;
+
+  template <class KeyIt, class Compare, class ValueIt = no_values>
+  static sycl::event run(sycl::queue &q,
+                         util::allocation_group &scratch_allocations,
+                         KeyIt keys_first, std::size_t problem_size,
+                         Compare comp, ValueIt values_first = {}) {
+    using key_type = typename std::iterator_traits<KeyIt>::value_type;
+    using value_type = typename value_type_of<ValueIt>::type;
+    constexpr bool has_values = !std::is_same_v<ValueIt, no_values>;
+
+    static_assert(std::is_trivially_copyable_v<key_type>,
+                  "merge_sort requires trivially copyable keys");
+    static_assert(std::is_trivially_copyable_v<value_type>,
+                  "merge_sort requires trivially copyable values");
+
+    if(problem_size < 2)
+      return sycl::event{};
+
+    key_type *key_buffers[2] = {
+        scratch_allocations.obtain<key_type>(problem_size),
+        scratch_allocations.obtain<key_type>(problem_size)};
+    value_type *value_buffers[2] = {nullptr, nullptr};
+    if constexpr(has_values) {
+      value_buffers[0] = scratch_allocations.obtain<value_type>(problem_size);
+      value_buffers[1] = scratch_allocations.obtain<value_type>(problem_size);
+    }
+
+    const std::size_t num_blocks = (problem_size + block_size - 1) / block_size;
+    key_type *sorted_keys = key_buffers[0];
+    value_type *sorted_values = value_buffers[0];
+    q.parallel_for(sycl::range<1>{num_blocks}, [=](sycl::id<1> idx) {
+      const std::size_t begin = idx[0] * block_size;
+      const std::size_t end = std::min(problem_size, begin + block_size);
+
+      auto key = keys_first;
+      std::advance(key, begin);
+      for(std::size_t i = begin; i < end; ++i, ++key)
+        sorted_keys[i] = *key;
+      if constexpr(has_values) {
+        auto value = values_first;
+        std::advance(value, begin);
+        for(std::size_t i = begin; i < end; ++i, ++value)
+          sorted_values[i] = *value;
+      }
+
+      // Insertion sort is stable as long as we only move elements
+      // past strictly larger ones.
+      for(std::size_t i = begin + 1; i < end; ++i) {
+        key_type current_key = sorted_keys[i];
+        std::size_t j = i;
+        for(; j > begin && comp(current_key, sorted_keys[j - 1]); --j)
+          sorted_keys[j] = sorted_keys[j - 1];
+        sorted_keys[j] = current_key;
+
+        // Move the value by the same distance as its key. Values are only
+        // copied, so they need not be default-constructible.
+        if constexpr(has_values) {
+          value_type current_value = sorted_values[i];
+          for(std::size_t k = i; k > j; --k)
+            sorted_values[k] = sorted_values[k - 1];
+          sorted_values[j] = current_value;
+        }
+      }
+    });
+
+    const std::size_t max_chunk_size =
+        q.get_device().is_host() ? host_chunk_size : device_chunk_size;
+
+    int current_buffer = 0;
+    for(std::size_t width = block_size; width < problem_size; width *= 2) {
+      const std::size_t chunk_size = std::min(max_chunk_size, 2 * width);
+      const std::size_t num_chunks =
+          (problem_size + chunk_size - 1) / chunk_size;
+
+      key_type *keys_in = key_buffers[current_buffer];
+      value_type *values_in = value_buffers[current_buffer];
+      key_type *keys_out = key_buffers[1 - current_buffer];
+      value_type *values_out = value_buffers[1 - current_buffer];
+
+      q.parallel_for(sycl::range<1>{num_chunks}, [=](sycl::id<1> idx) {
+        // Since chunk_size divides 2*width, chunks never cross the
+        // boundary between two pairs of runs.
+        const std::size_t out_begin = idx[0] * chunk_size;
+        const std::size_t out_end = std::min(problem_size, out_begin + chunk_size);
+        const std::size_t pair_begin = out_begin - out_begin % (2 * width);
+
+        const std::size_t a_begin = pair_begin;
+        const std::size_t a_end = std::min(problem_size, pair_begin + width);
+        const std::size_t b_begin = a_end;
+        const std::size_t b_end = std::min(problem_size, pair_begin + 2 * width);
+
+        // Find the number of elements from run a among the first
+        // k elements of the merged output.
+        const std::size_t k = out_begin - pair_begin;
+        const std::size_t b_size = b_end - b_begin;
+        std::size_t lo = k > b_size ? k - b_size : 0;
+        std::size_t hi = std::min(k, a_end - a_begin);
+        while(lo < hi) {
+          std::size_t mid = (lo + hi) / 2;
+          if(comp(keys_in[b_begin + k - mid - 1], keys_in[a_begin + mid]))
+            hi = mid;
+          else
+            lo = mid + 1;
+        }
+
+        std::size_t i = a_begin + lo;
+        std::size_t j = b_begin + (k - lo);
+        for(std::size_t out = out_begin; out < out_end; ++out) {
+          // On ties, elements from run a come first to maintain stability.
+          bool take_b = j < b_end && (i >= a_end || comp(keys_in[j], keys_in[i]));
+          std::size_t src = take_b ? j++ : i++;
+          keys_out[out] = keys_in[src];
+          if constexpr(has_values)
+            values_out[out] = values_in[src];
+        }
+      });
+      current_buffer = 1 - current_buffer;
+    }
+
+    key_type *keys_result = key_buffers[current_buffer];
+    value_type *values_result = value_buffers[current_buffer];
+    return q.parallel_for(sycl::range<1>{problem_size}, [=](sycl::id<1> idx) {
+      auto key = keys_first;
+      std::advance(key, idx[0]);
+      *key = keys_result[idx[0]];
+      if constexpr(has_values) {
+        auto value = values_first;
+        std::advance(value, idx[0]);
+        *value = values_result[idx[0]];
+      }
+    });
+  }
+};
+
+}
+
+#endif
@@ -0,0 +1,336 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HIPSYCL_ALGORITHMS_RADIX_SORT_HPP
+#define HIPSYCL_ALGORITHMS_RADIX_SORT_HPP
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "hipSYCL/sycl/event.hpp"
+#include "hipSYCL/sycl/queue.hpp"
+#include "hipSYCL/sycl/info/device.hpp"
+#include "hipSYCL/sycl/libkernel/atomic_builtins.hpp"
+#include "hipSYCL/sycl/libkernel/bit_cast.hpp"
+#include "hipSYCL/algorithms/util/allocation_cache.hpp"
+#include "hipSYCL/algorithms/scan/scan_descriptor.hpp"
+#include "hipSYCL/algorithms/scan/scan_engine.hpp"
+#include "sort_traits.hpp"
+
+namespace hipsycl::algorithms::sorting {
+
+namespace detail {
+
+template<std::size_t Size>
+struct unsigned_integer_of_size {};
+
+template<> struct unsigned_integer_of_size<1> { using type = uint8_t; };
+template<> struct unsigned_integer_of_size<2> { using type = uint16_t; };
+template<> struct unsigned_integer_of_size<4> { using type = uint32_t; };
+template<> struct unsigned_integer_of_size<8> { using type = uint64_t; };
+
+}
+
+/// Maps arithmetic keys to unsigned integers whose natural ordering
+/// matches the ordering of the keys.
+///
+/// For floating point keys, -0.0 and +0.0 are mapped to the same integer
+/// since they compare equal, which keeps sorts involving both stable.
+/// NaNs are not ordered by operator<, so a comparison-based sort gives no
+/// guarantees for them. Here, NaNs are ordered by their bit pattern:
+/// NaNs with the sign bit set precede -inf, all others follow +inf.
+template<class T>
+struct radix_key {
+  static constexpr bool is_supported =
+      std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+      (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+  using bits_type = typename detail::unsigned_integer_of_size<sizeof(T)>::type;
+  static constexpr int num_bits = sizeof(T) * CHAR_BIT;
+  static constexpr bits_type sign_bit = bits_type{1} << (num_bits - 1);
+
+  static bits_type to_bits(T x) noexcept {
+    if constexpr(std::is_floating_point_v<T>) {
+      // Canonicalize -0.0 to +0.0
+      bits_type bits =
+          (x == T{0}) ? bits_type{0} : sycl::bit_cast<bits_type>(x);
+      // Negative values are ordered reversely, and must precede
+      // all positive values.
+      return (bits & sign_bit) ? static_cast<bits_type>(~bits)
+                               : static_cast<bits_type>(bits | sign_bit);
+    } else if constexpr(std::is_signed_v<T>) {
+      return static_cast<bits_type>(sycl::bit_cast<bits_type>(x) ^ sign_bit);
+    } else {
+      return sycl::bit_cast<bits_type>(x);
+    }
+  }
+};
+
+/// Stable LSD radix sort for arithmetic keys.
+///
+/// Before the first pass, the digit histograms of *all* passes are computed
+/// with a single read of the keys, similar to the upfront histogram of
+/// onesweep. This allows skipping passes in which all keys share the same
+/// digit (e.g. the upper bytes of small integers) entirely. Each remaining
+/// pass then
+/// 1. counts the digits of each tile into a digit-major table,
+/// 2. runs an exclusive device scan over that table, which yields the
+///    output offset of each (digit, tile) pair, and
+/// 3. scatters the elements of each tile in order, which keeps the
+///    sort stable.
+///
+/// Note: Deciding which passes can be skipped requires the histogram on the
+/// host, so run() waits for the histogram kernel to complete.
+/// As the other algorithms, run() relies on q being an in-order queue.
+class radix_sort {
+public:
+  static constexpr int radix_bits = 8;
+  static constexpr std::size_t radix = std::size_t{1} << radix_bits;
+  // Tiles are processed sequentially by a single work item
+  static constexpr std::size_t device_tile_size = 1024;
+  static constexpr std::size_t min_host_tile_size = 4096;
+
+  template <class KeyIt, class ValueIt = no_values>
+  static sycl::event run(sycl::queue &q,
+                         util::allocation_group &scratch_allocations,
+                         KeyIt keys_first, std::size_t problem_size,
+                         bool descending, ValueIt values_first = {}) {
+    using key_type = typename std::iterator_traits<KeyIt>::value_type;
+    using value_type = typename value_type_of<ValueIt>::type;
+    using bits_type = typename radix_key<key_type>::bits_type;
+    constexpr bool has_values = !std::is_same_v<ValueIt, no_values>;
+    constexpr int num_passes =
+        (radix_key<key_type>::num_bits + radix_bits - 1) / radix_bits;
+
+    static_assert(radix_key<key_type>::is_supported,
+                  "radix_sort requires arithmetic keys");
+    static_assert(std::is_trivially_copyable_v<value_type>,
+                  "radix_sort requires trivially copyable values");
+
+    if(problem_size < 2)
+      return sycl::event{};
+
+    const std::size_t tile_size = get_tile_size(q, problem_size);
+    const std::size_t num_tiles = (problem_size + tile_size - 1) / tile_size;
+
+    auto get_digit = [=](const key_type& key, int pass) -> std::size_t {
+      bits_type bits = radix_key<key_type>::to_bits(key);
+      if(descending)
+        bits = static_cast<bits_type>(~bits);
+      return static_cast<std::size_t>(bits >> (pass * radix_bits)) &
+             (radix - 1);
+    };
+
+    // Upfront histogram of all passes
+    std::size_t *histogram =
+        scratch_allocations.obtain<std::size_t>(num_passes * radix);
+    q.parallel_for(sycl::range<1>{num_passes * radix},
+                   [=](sycl::id<1> idx) { histogram[idx[0]] = 0; });
+    q.parallel_for(sycl::range<1>{num_tiles}, [=](sycl::id<1> idx) {
+      const std::size_t begin = idx[0] * tile_size;
+      const std::size_t end = std::min(problem_size, begin + tile_size);
+
+      // Accumulate runs of identical digits to keep the number
+      // of atomic operations low for (partially) sorted inputs.
+      std::size_t current_digit[num_passes];
+      std::size_t run_length[num_passes];
+      for(int pass = 0; pass < num_passes; ++pass) {
+        current_digit[pass] = 0;
+        run_length[pass] = 0;
+      }
+
+      auto flush = [&](int pass) {
+        if(run_length[pass] > 0)
+          sycl::detail::__hipsycl_atomic_fetch_add<
+              sycl::access::address_space::global_space>(
+              histogram + pass * radix + current_digit[pass],
+              run_length[pass], sycl::memory_order_relaxed,
+              sycl::memory_scope_device);
+      };
+
+      for(std::size_t i = begin; i < end; ++i) {
+        auto it = keys_first;
+        std::advance(it, i);
+        key_type key = *it;
+        for(int pass = 0; pass < num_passes; ++pass) {
+          std::size_t digit = get_digit(key, pass);
+          if(digit != current_digit[pass]) {
+            flush(pass);
+            current_digit[pass] = digit;
+            run_length[pass] = 0;
+          }
+          ++run_length[pass];
+        }
+      }
+      for(int pass = 0; pass < num_passes; ++pass)
+        flush(pass);
+    });
+
+    std::vector<std::size_t> host_histogram(num_passes * radix);
+    q.memcpy(host_histogram.data(), histogram,
+             sizeof(std::size_t) * host_histogram.size()).wait();
+
+    std::vector<int> active_passes;
+    for(int pass = 0; pass < num_passes; ++pass) {
+      auto pass_begin = host_histogram.begin() + pass * radix;
+      bool is_trivial =
+          std::find(pass_begin, pass_begin + radix, problem_size) !=
+          pass_begin + radix;
+      if(!is_trivial)
+        active_passes.push_back(pass);
+    }
+
+    if(active_passes.empty())
+      return sycl::event{};
+
+    key_type *key_buffers[2] = {
+        scratch_allocations.obtain<key_type>(problem_size),
+        scratch_allocations.obtain<key_type>(problem_size)};
+    value_type *value_buffers[2] = {nullptr, nullptr};
+    if constexpr(has_values) {
+      value_buffers[0] = scratch_allocations.obtain<value_type>(problem_size);
+      value_buffers[1] = scratch_allocations.obtain<value_type>(problem_size);
+    }
+    std::size_t *offsets =
+        scratch_allocations.obtain<std::size_t>(radix * num_tiles);
+
+    // The first pass reads directly from the input range, afterwards
+    // we alternate between the scratch buffers.
+    run_pass(q, scratch_allocations, active_passes[0], problem_size, tile_size,
+             num_tiles, offsets, get_digit, keys_first, values_first,
+             key_buffers[0], value_buffers[0]);
+    int current_buffer = 0;
+    for(std::size_t i = 1; i < active_passes.size(); ++i) {
+      run_pass(q, scratch_allocations, active_passes[i], problem_size,
+               tile_size, num_tiles, offsets, get_digit,
+               key_buffers[current_buffer], value_buffers[current_buffer],
+               key_buffers[1 - current_buffer],
+               value_buffers[1 - current_buffer]);
+      current_buffer = 1 - current_buffer;
+    }
+
+    key_type *keys_result = key_buffers[current_buffer];
+    value_type *values_result = value_buffers[current_buffer];
+    return q.parallel_for(sycl::range<1>{problem_size}, [=](sycl::id<1> idx) {
+      auto key = keys_first;
+      std::advance(key, idx[0]);
+      *key = keys_result[idx[0]];
+      if constexpr(has_values) {
+        auto value = values_first;
+        std::advance(value, idx[0]);
+        *value = values_result[idx[0]];
+      }
+    });
+  }
+
+private:
+  static std::size_t get_tile_size(const sycl::queue &q,
+                                   std::size_t problem_size) {
+    if(q.get_device().is_host()) {
+      // One tile per thread, as for the blocked scan
+      std::size_t num_threads = std::max<std::size_t>(
+          1, q.get_device().get_info<sycl::info::device::max_compute_units>());
+      return std::max(min_host_tile_size,
+                      (problem_size + num_threads - 1) / num_threads);
+    }
+    return device_tile_size;
+  }
+
+  template <class DigitExtractor, class KeyInIt, class ValueInIt,
+            class KeyType, class ValueType>
+  static sycl::event
+  run_pass(sycl::queue &q, util::allocation_group &scratch_allocations,
+           int pass, std::size_t problem_size, std::size_t tile_size,
+           std::size_t num_tiles, std::size_t *offsets,
+           DigitExtractor get_digit, KeyInIt keys_in, ValueInIt values_in,
+           KeyType *keys_out, ValueType *values_out) {
+    constexpr bool has_values = !std::is_same_v<ValueInIt, no_values>;
+
+    // offsets is laid out digit-major: offsets[digit * num_tiles + tile].
+    // An exclusive scan over this table then yields for each tile the
+    // position of its first element of a given digit in the output.
+    q.parallel_for(sycl::range<1>{num_tiles}, [=](sycl::id<1> idx) {
+      const std::size_t tile = idx[0];
+      const std::size_t begin = tile * tile_size;
+      const std::size_t end = std::min(problem_size, begin + tile_size);
+
+      for(std::size_t digit = 0; digit < radix; ++digit)
+        offsets[digit * num_tiles + tile] = 0;
+      for(std::size_t i = begin; i < end; ++i) {
+        auto key = keys_in;
+        std::advance(key, i);
+        ++offsets[get_digit(*key, pass) * num_tiles + tile];
+      }
+    });
+
+    auto generator = [=](std::size_t i) -> std::size_t {
+      return offsets[i];
+    };
+    auto result_processor = [=](std::size_t i, const std::size_t &offset) {
+      offsets[i] = offset;
+    };
+    scanning::scan_descriptor<std::size_t, std::plus<std::size_t>,
+                              decltype(generator), decltype(result_processor)>
+        desc{scanning::scan_type::exclusive,
+             radix * num_tiles,
+             std::plus<std::size_t>{},
+             generator,
+             result_processor,
+             std::size_t{0}};
+    scanning::scan(q, scratch_allocations, desc);
+
+    return q.parallel_for(sycl::range<1>{num_tiles}, [=](sycl::id<1> idx) {
+      const std::size_t tile = idx[0];
+      const std::size_t begin = tile * tile_size;
+      const std::size_t end = std::min(problem_size, begin + tile_size);
+
+      for(std::size_t i = begin; i < end; ++i) {
+        auto key = keys_in;
+        std::advance(key, i);
+        auto key_value = *key;
+        std::size_t &offset =
+            offsets[get_digit(key_value, pass) * num_tiles + tile];
+        keys_out[offset] = key_value;
+        if constexpr(has_values) {
+          auto value = values_in;
+          std::advance(value, i);
+          values_out[offset] = *value;
+        }
+        ++offset;
+      }
+    });
+  }
+};
+
+}
+
+#endif
@@ -0,0 +1,83 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HIPSYCL_ALGORITHMS_SORT_TRAITS_HPP
+#define HIPSYCL_ALGORITHMS_SORT_TRAITS_HPP
+
+#include <functional>
+#include <iterator>
+
+namespace hipsycl::algorithms::sorting {
+
+/// Tag type that denotes that only keys are sorted, without values.
+struct no_values {};
+
+template<class ValueIt>
+struct value_type_of {
+  using type = typename std::iterator_traits<ValueIt>::value_type;
+};
+
+template<>
+struct value_type_of<no_values> {
+  using type = no_values;
+};
+
+/// Identifies comparators for which the ordering of keys is known,
+/// such that radix sort can be used instead of a comparison sort.
+template<class Compare, class Key>
+struct comparator_order {
+  static constexpr bool is_ascending = false;
+  static constexpr bool is_descending = false;
+};
+
+template<class Key>
+struct comparator_order<std::less<Key>, Key> {
+  static constexpr bool is_ascending = true;
+  static constexpr bool is_descending = false;
+};
+
+template<class Key>
+struct comparator_order<std::less<>, Key> {
+  static constexpr bool is_ascending = true;
+  static constexpr bool is_descending = false;
+};
+
+template<class Key>
+struct comparator_order<std::greater<Key>, Key> {
+  static constexpr bool is_ascending = false;
+  static constexpr bool is_descending = true;
+};
+
+template<class Key>
+struct comparator_order<std::greater<>, Key> {
+  static constexpr bool is_ascending = false;
+  static constexpr bool is_descending = true;
+};
+
+}
+
+#endif
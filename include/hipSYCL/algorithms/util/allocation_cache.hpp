@@ -30,11 +30,20 @@
 #ifndef HIPSYCL_ALGORITHM_UTIL_ALLOCATION_CACHE_HPP
 #define HIPSYCL_ALGORITHM_UTIL_ALLOCATION_CACHE_HPP
 
-#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <map>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 #include "hipSYCL/common/small_vector.hpp"
+#include "hipSYCL/runtime/dag_manager.hpp"
 #include "hipSYCL/runtime/device_id.hpp"
+#include "hipSYCL/runtime/event.hpp"
+#include "hipSYCL/runtime/inorder_executor.hpp"
 #include "hipSYCL/runtime/runtime.hpp"
 #include "hipSYCL/runtime/application.hpp"
 #include "hipSYCL/sycl/device.hpp"
@@ -58,33 +67,114 @@ enum class allocation_type {
   device, shared, host
 };
 
+struct allocation_cache_statistics {
+  std::size_t num_hits = 0;
+  std::size_t num_misses = 0;
+  std::size_t num_evictions = 0;
+  // Total size of allocations currently available for reuse
+  std::size_t cached_bytes = 0;
+  // Total size of evicted allocations that have not yet been freed
+  std::size_t evicted_bytes = 0;
+
+  double get_hit_rate() const {
+    std::size_t num_requests = num_hits + num_misses;
+    if(num_requests == 0)
+      return 0.0;
+    return static_cast<double>(num_hits) / num_requests;
+  }
+};
+
+/// Caches scratch allocations for reuse across algorithm invocations.
+///
+/// Allocations are returned to the cache when their allocation_group is
+/// released, which may happen while operations using them are still in
+/// flight. Reusing them is safe as long as all users of the cache submit
+/// to the same in-order queue. Freeing them is not: allocations that are
+/// evicted because the cache exceeds its size limit are therefore only
+/// freed once all operations that had been submitted to their device at
+/// the time of eviction have completed. This is checked whenever the cache
+/// is accessed. release_evicted_allocations() frees them right away, which
+/// the user must only do when all operations submitted so far have
+/// completed.
 class allocation_cache {
   friend class allocation_group;
 public:
-  allocation_cache(allocation_type alloc_type)
-  : _alloc_type{alloc_type} {}
+  static constexpr std::size_t default_max_cached_bytes = 512 * 1024 * 1024;
+
+  /// \param max_cached_bytes Upper bound for the total size of allocations
+  /// retained for reuse. If it is exceeded, the least recently returned
+  /// allocations are evicted.
+  allocation_cache(allocation_type alloc_type,
+                   std::size_t max_cached_bytes = default_max_cached_bytes)
+  : _alloc_type{alloc_type}, _max_cached_bytes{max_cached_bytes} {}
 
   ~allocation_cache() {
     purge();
   }
 
+  /// Frees all allocations. Must only be called when no operations using
+  /// them are in flight.
   void purge() {
     std::lock_guard<std::mutex> lock{_mutex};
     
-    for(auto& allocation : _allocations) {
-      _rt.get()->backends()
-          .get(allocation.dev.get_backend())
-          ->get_allocator(allocation.dev)
-          ->free(allocation.ptr);
+    for(auto& allocation : _lru_allocations) {
+      free_allocation(allocation);
+    }
+    _lru_allocations.clear();
+    _device_pools.clear();
+    _stats.cached_bytes = 0;
+
+    for(const auto& evicted : _evicted_allocations)
+      free_allocation(evicted.alloc);
+    _evicted_allocations.clear();
+    _stats.evicted_bytes = 0;
+  }
+
+  /// Frees allocations that have been evicted from the cache. Must only be
+  /// called when no operations submitted before their eviction are in flight,
+  /// e.g. after waiting on the queue that the cache is used with.
+  void release_evicted_allocations() {
+    std::vector<evicted_allocation> evicted;
+    {
+      std::lock_guard<std::mutex> lock{_mutex};
+      if(_evicted_allocations.empty())
+        return;
+      std::swap(evicted, _evicted_allocations);
+      _stats.evicted_bytes = 0;
     }
-    _allocations.clear();
+    for(const auto& e : evicted)
+      free_allocation(e.alloc);
+  }
+
+  allocation_cache_statistics get_statistics() const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _stats;
   }
 private:
-  
+  using lru_list = std::list<allocation>;
+  // Maps allocation size to the position in the LRU list, which allows for
+  // O(log n) best-fit lookup.
+  using size_index = std::multimap<std::size_t, lru_list::iterator>;
+
+  struct device_pool {
+    rt::device_id dev;
+    size_index allocations;
+  };
+
+  struct evicted_allocation {
+    allocation alloc;
+    // Completes once the allocation is no longer in use;
+    // nullptr if it was not in use at the time of eviction.
+    std::shared_ptr<rt::dag_node_event> free_after;
+  };
+
   allocation find_or_alloc(std::size_t min_size, std::size_t min_alignment,
-                           rt::device_id dev) {
+                           rt::device_id dev, bool& is_hit) {
+    release_completed_evictions();
+
     allocation result;
-    if(!find_allocation(min_size, min_alignment, dev, result)){  
+    is_hit = find_allocation(min_size, min_alignment, dev, result);
+    if(!is_hit){
       result.dev = dev;
       result.size = min_size;
 
@@ -107,42 +197,131 @@ private:
                        rt::device_id dev, allocation &out) {
     std::lock_guard<std::mutex> lock{_mutex};
 
-    bool found = false;
-    std::size_t found_index = 0;
-    for (std::size_t i = 0; i < _allocations.size(); ++i) {
-      const auto& allocation = _allocations[i];
-      if (allocation.dev == dev) {
-        if (allocation.size >= min_size &&
-            reinterpret_cast<std::size_t>(allocation.ptr) % min_alignment ==
-                0) {
-          // If we already have found a candidate: We want the smallest
-          // allocation that has the required size so that larger allocations
-          // remain available for larger requests.
-          if (!found || allocation.size < out.size) {
-            out = allocation;
-            found_index = i;
-          }
-          found = true;
+    device_pool* pool = get_device_pool(dev);
+    if(pool) {
+      // We want the smallest allocation that has the required size so that
+      // larger allocations remain available for larger requests.
+      for (auto it = pool->allocations.lower_bound(min_size);
+           it != pool->allocations.end(); ++it) {
+        const allocation& candidate = *(it->second);
+        if (reinterpret_cast<std::size_t>(candidate.ptr) % min_alignment ==
+            0) {
+          out = candidate;
+          // The allocation is no longer available for other requests,
+          // so remove for now.
+          _lru_allocations.erase(it->second);
+          pool->allocations.erase(it);
+          _stats.cached_bytes -= out.size;
+          ++_stats.num_hits;
+          return true;
         }
       }
     }
-    if(found) {
-      // The allocation is no longer available for other requests,
-      // so remove for now.
-      _allocations.erase(_allocations.begin() + found_index);
-    }
-    return found;
+    ++_stats.num_misses;
+    return false;
   }
 
   void return_allocation(const allocation& alloc) {
-    std::lock_guard<std::mutex> lock{_mutex};
-    _allocations.push_back(alloc);
+    std::vector<allocation> evicted;
+    {
+      std::lock_guard<std::mutex> lock{_mutex};
+
+      device_pool* pool = get_device_pool(alloc.dev);
+      if(!pool) {
+        _device_pools.push_back(device_pool{alloc.dev, size_index{}});
+        pool = &(_device_pools.back());
+      }
+      auto pos = _lru_allocations.insert(_lru_allocations.end(), alloc);
+      pool->allocations.emplace(alloc.size, pos);
+      _stats.cached_bytes += alloc.size;
+
+      while(_stats.cached_bytes > _max_cached_bytes) {
+        evicted.push_back(evict_least_recently_used());
+        _stats.evicted_bytes += evicted.back().size;
+        ++_stats.num_evictions;
+      }
+    }
+
+    if(!evicted.empty()) {
+      // The allocations might still be used by operations in flight,
+      // so they can only be freed once those have completed. Operations
+      // may not have reached the executors yet, so flush them first.
+      _rt.get()->dag().flush_sync();
+
+      std::vector<evicted_allocation> pending;
+      for(const auto& e : evicted)
+        pending.push_back(evicted_allocation{
+            e, rt::inorder_executor::create_device_fence(e.dev)});
+
+      std::lock_guard<std::mutex> lock{_mutex};
+      _evicted_allocations.insert(_evicted_allocations.end(),
+                                  pending.begin(), pending.end());
+    }
+    release_completed_evictions();
+  }
+
+  // Frees evicted allocations whose operations have completed
+  void release_completed_evictions() {
+    std::vector<allocation> completed;
+    {
+      std::lock_guard<std::mutex> lock{_mutex};
+      auto first_completed = std::stable_partition(
+          _evicted_allocations.begin(), _evicted_allocations.end(),
+          [](const evicted_allocation &e) {
+            return e.free_after && !e.free_after->is_complete();
+          });
+      for(auto it = first_completed; it != _evicted_allocations.end(); ++it) {
+        completed.push_back(it->alloc);
+        _stats.evicted_bytes -= it->alloc.size;
+      }
+      _evicted_allocations.erase(first_completed, _evicted_allocations.end());
+    }
+    for(const auto& alloc : completed)
+      free_allocation(alloc);
+  }
+
+  // Assumes that _mutex is locked
+  allocation evict_least_recently_used() {
+    allocation alloc = _lru_allocations.front();
+    device_pool* pool = get_device_pool(alloc.dev);
+    auto candidates = pool->allocations.equal_range(alloc.size);
+    for(auto it = candidates.first; it != candidates.second; ++it) {
+      if(it->second == _lru_allocations.begin()) {
+        pool->allocations.erase(it);
+        break;
+      }
+    }
+    _lru_allocations.pop_front();
+    _stats.cached_bytes -= alloc.size;
+    return alloc;
+  }
+
+  // Assumes that _mutex is locked
+  device_pool* get_device_pool(rt::device_id dev) {
+    // There are only few devices, so linear search is fine here.
+    for(auto& pool : _device_pools) {
+      if(pool.dev == dev)
+        return &pool;
+    }
+    return nullptr;
+  }
+
+  void free_allocation(const allocation& alloc) {
+    _rt.get()->backends()
+        .get(alloc.dev.get_backend())
+        ->get_allocator(alloc.dev)
+        ->free(alloc.ptr);
   }
 
   rt::runtime_keep_alive_token _rt;
-  common::auto_small_vector<allocation> _allocations;
-  std::mutex _mutex;
+  // Least recently returned allocations first
+  lru_list _lru_allocations;
+  std::vector<device_pool> _device_pools;
+  std::vector<evicted_allocation> _evicted_allocations;
+  allocation_cache_statistics _stats;
+  mutable std::mutex _mutex;
   allocation_type _alloc_type;
+  std::size_t _max_cached_bytes;
 };
 
 /// allocation_group represents allocation requests that belong together
@@ -184,8 +363,13 @@ public:
 
   template<class T>
   T* obtain(std::size_t count) {
+    bool is_hit = false;
     allocation alloc =
-        _parent->find_or_alloc(count * sizeof(T), alignof(T), _dev);
+        _parent->find_or_alloc(count * sizeof(T), alignof(T), _dev, is_hit);
+    if(is_hit)
+      ++_num_hits;
+    else
+      ++_num_misses;
     _managed_allocations.push_back(alloc);
     return static_cast<T*>(alloc.ptr);
   }
@@ -193,9 +377,26 @@ public:
   rt::device_id get_device() const {
     return _dev;
   }
+
+  /// Number of requests of this group that were served from the parent
+  /// cache
+  std::size_t get_num_cache_hits() const {
+    return _num_hits;
+  }
+
+  /// Number of requests of this group that required a new allocation
+  std::size_t get_num_cache_misses() const {
+    return _num_misses;
+  }
+
+  allocation_cache* get_parent_cache() const {
+    return _parent;
+  }
 private:
   allocation_cache* _parent;
   rt::device_id _dev;
+  std::size_t _num_hits = 0;
+  std::size_t _num_misses = 0;
   common::auto_small_vector<allocation> _managed_allocations;
 };
 
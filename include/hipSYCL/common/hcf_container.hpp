@@ -29,9 +29,15 @@
 #define HIPSYCL_HCF_CONTAINER_HPP
 
 #include "debug.hpp"
+#include "stable_running_hash.hpp"
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 #include <sstream>
@@ -43,6 +49,298 @@
 namespace hipsycl {
 namespace common {
 
+/// Read-only access to HCF data in the binary format, see doc/hcf.md.
+///
+/// Nothing is parsed up front: Nodes, keys and values are read from the
+/// underlying memory when they are accessed, and all returned strings refer
+/// to that memory. Subnodes and values are found by hash lookup.
+class hcf_binary_view {
+public:
+  using node_index = uint32_t;
+  static constexpr node_index invalid_node = ~node_index{0};
+
+  static constexpr char magic[] = "ACPPHCFB";
+  static constexpr uint32_t version = 1;
+
+  static constexpr std::size_t header_size = 80;
+  static constexpr std::size_t node_record_size = 32;
+  static constexpr std::size_t entry_record_size = 24;
+
+  static bool is_binary_hcf(std::string_view data) {
+    std::size_t magic_size = sizeof(magic) - 1;
+    return data.size() >= magic_size &&
+           data.substr(0, magic_size) == std::string_view{magic, magic_size};
+  }
+
+  static uint64_t hash(std::string_view s) {
+    stable_running_hash h;
+    h(s.data(), s.size());
+    return h.get_current_hash();
+  }
+
+  hcf_binary_view() = default;
+
+  explicit hcf_binary_view(std::string_view data) : _data{data} {
+    if(!is_binary_hcf(data) || data.size() < header_size)
+      return;
+
+    if(read_u32(8) != version) {
+      HIPSYCL_DEBUG_ERROR << "hcf: Unsupported binary HCF version "
+                          << read_u32(8) << "\n";
+      return;
+    }
+
+    _num_nodes = read_u32(12);
+    _num_entries = read_u32(16);
+    _node_table = read_u64(24);
+    _node_lookup_table = read_u64(32);
+    _entry_table = read_u64(40);
+    _entry_lookup_table = read_u64(48);
+    _string_table = read_u64(56);
+    _binary_appendix = read_u64(64);
+    _binary_appendix_size = read_u64(72);
+
+    if (!in_bounds(_node_table, _num_nodes * node_record_size) ||
+        !in_bounds(_node_lookup_table, _num_nodes * sizeof(uint32_t)) ||
+        !in_bounds(_entry_table, _num_entries * entry_record_size) ||
+        !in_bounds(_entry_lookup_table, _num_entries * sizeof(uint32_t)) ||
+        !in_bounds(_string_table, 0) ||
+        !in_bounds(_binary_appendix, _binary_appendix_size) ||
+        _num_nodes == 0) {
+      HIPSYCL_DEBUG_ERROR << "hcf: Binary HCF is truncated or corrupted\n";
+      return;
+    }
+
+    _is_valid = true;
+  }
+
+  bool is_valid() const {
+    return _is_valid;
+  }
+
+  node_index root() const {
+    return 0;
+  }
+
+  std::size_t get_num_nodes() const {
+    return _num_nodes;
+  }
+
+  std::size_t get_num_entries() const {
+    return _num_entries;
+  }
+
+  std::string_view get_node_name(node_index n) const {
+    return read_string(node_record(n) + 8);
+  }
+
+  std::size_t get_num_subnodes(node_index n) const {
+    return read_u32(node_record(n) + 28);
+  }
+
+  // Returns the i-th subnode of n, in the order in which subnodes were added.
+  node_index get_subnode(node_index n, std::size_t i) const {
+    node_index child = read_u32(node_record(n) + 24) + i;
+    return child < _num_nodes ? child : invalid_node;
+  }
+
+  node_index get_subnode(node_index n, std::string_view name) const {
+    std::size_t record = node_record(n);
+    std::size_t first = read_u32(record + 24);
+    std::size_t count = read_u32(record + 28);
+
+    node_index result = invalid_node;
+    find_in_lookup_table(true, first, count, hash(name),
+                         [&](uint32_t candidate) {
+                           if (candidate >= _num_nodes ||
+                               get_node_name(candidate) != name)
+                             return false;
+                           result = candidate;
+                           return true;
+                         });
+    return result;
+  }
+
+  std::size_t get_num_values(node_index n) const {
+    return read_u32(node_record(n) + 20);
+  }
+
+  // Whether n exists and its values and subnodes lie within the entry
+  // and node tables.
+  bool has_valid_ranges(node_index n) const {
+    if(n >= _num_nodes)
+      return false;
+    std::size_t record = node_record(n);
+    std::size_t first_value = read_u32(record + 16);
+    std::size_t num_values = read_u32(record + 20);
+    std::size_t first_subnode = read_u32(record + 24);
+    std::size_t num_subnodes = read_u32(record + 28);
+    return first_value <= _num_entries &&
+           num_values <= _num_entries - first_value &&
+           first_subnode <= _num_nodes &&
+           num_subnodes <= _num_nodes - first_subnode;
+  }
+
+  // Returns the i-th key-value pair of n, in the order in which they were set.
+  std::pair<std::string_view, std::string_view>
+  get_key_value_pair(node_index n, std::size_t i) const {
+    std::size_t entry = read_u32(node_record(n) + 16) + i;
+    if(entry >= _num_entries)
+      return {};
+    std::size_t record = _entry_table + entry * entry_record_size;
+    return std::make_pair(read_string(record + 8), read_string(record + 16));
+  }
+
+  bool get_value(node_index n, std::string_view key,
+                 std::string_view &out) const {
+    std::size_t record = node_record(n);
+    std::size_t first = read_u32(record + 16);
+    std::size_t count = read_u32(record + 20);
+
+    return find_in_lookup_table(
+        false, first, count, hash(key), [&](uint32_t candidate) {
+          if(candidate >= _num_entries)
+            return false;
+          std::size_t entry = _entry_table + candidate * entry_record_size;
+          if(read_string(entry + 8) != key)
+            return false;
+          out = read_string(entry + 16);
+          return true;
+        });
+  }
+
+  bool get_binary_attachment(node_index n, std::string_view &out) const {
+    node_index descriptor = n;
+    if(get_node_name(n) != "__binary")
+      descriptor = get_subnode(n, "__binary");
+    if(descriptor == invalid_node)
+      return false;
+
+    std::string_view start_entry;
+    std::string_view size_entry;
+    if (!get_value(descriptor, "start", start_entry) ||
+        !get_value(descriptor, "size", size_entry))
+      return false;
+
+    std::size_t start = 0;
+    std::size_t size = 0;
+    if (!parse_size(std::string{start_entry}, start) ||
+        !parse_size(std::string{size_entry}, size) ||
+        start > _binary_appendix_size || size > _binary_appendix_size - start)
+      return false;
+
+    out = get_binary_appendix().substr(start, size);
+    return true;
+  }
+
+  std::string_view get_binary_appendix() const {
+    return _data.substr(_binary_appendix, _binary_appendix_size);
+  }
+
+  // Parses the start or size of a binary attachment. Returns false
+  // instead of throwing if the value is not a valid number.
+  static bool parse_size(const std::string &str, std::size_t &out) {
+    try {
+      out = std::stoull(str);
+      return true;
+    } catch(const std::invalid_argument &) {
+      return false;
+    } catch(const std::out_of_range &) {
+      return false;
+    }
+  }
+
+private:
+  // Lookup tables store, for the subnodes/values of each node, their
+  // indices sorted by the hash of their name/key. f is invoked for all
+  // candidates with the given hash in their original order, until it
+  // returns true.
+  template <class F>
+  bool find_in_lookup_table(bool is_node_table, std::size_t first,
+                            std::size_t count, uint64_t h, F &&f) const {
+    std::size_t table =
+        is_node_table ? _node_lookup_table : _entry_lookup_table;
+    auto hash_of = [&](std::size_t pos) {
+      uint32_t idx = read_u32(table + pos * sizeof(uint32_t));
+      std::size_t record =
+          is_node_table ? (_node_table + idx * node_record_size)
+                        : (_entry_table + idx * entry_record_size);
+      return read_u64(record);
+    };
+
+    std::size_t max_count = is_node_table ? _num_nodes : _num_entries;
+    if(first > max_count || count > max_count - first)
+      return false;
+
+    std::size_t begin = first;
+    std::size_t end = first + count;
+    while(begin < end) {
+      std::size_t mid = begin + (end - begin) / 2;
+      if(hash_of(mid) < h)
+        begin = mid + 1;
+      else
+        end = mid;
+    }
+
+    for(std::size_t pos = begin; pos < first + count && hash_of(pos) == h;
+        ++pos) {
+      if(f(read_u32(table + pos * sizeof(uint32_t))))
+        return true;
+    }
+    return false;
+  }
+
+  std::size_t node_record(node_index n) const {
+    // Invalid nodes map to the root node, so that accesses stay in bounds
+    if(n >= _num_nodes)
+      n = 0;
+    return _node_table + n * node_record_size;
+  }
+
+  std::string_view read_string(std::size_t offset) const {
+    std::size_t string_offset = read_u32(offset);
+    std::size_t string_size = read_u32(offset + 4);
+    if(!in_bounds(_string_table + string_offset, string_size))
+      return {};
+    return _data.substr(_string_table + string_offset, string_size);
+  }
+
+  bool in_bounds(uint64_t offset, uint64_t size) const {
+    return offset <= _data.size() && size <= _data.size() - offset;
+  }
+
+  uint64_t read_le(std::size_t offset, std::size_t num_bytes) const {
+    if(!in_bounds(offset, num_bytes))
+      return 0;
+    uint64_t result = 0;
+    for(std::size_t i = 0; i < num_bytes; ++i)
+      result |= static_cast<uint64_t>(
+                    static_cast<unsigned char>(_data[offset + i]))
+                << (8 * i);
+    return result;
+  }
+
+  uint32_t read_u32(std::size_t offset) const {
+    return static_cast<uint32_t>(read_le(offset, 4));
+  }
+
+  uint64_t read_u64(std::size_t offset) const {
+    return read_le(offset, 8);
+  }
+
+  std::string_view _data;
+  bool _is_valid = false;
+  std::size_t _num_nodes = 0;
+  std::size_t _num_entries = 0;
+  uint64_t _node_table = 0;
+  uint64_t _node_lookup_table = 0;
+  uint64_t _entry_table = 0;
+  uint64_t _entry_lookup_table = 0;
+  uint64_t _string_table = 0;
+  uint64_t _binary_appendix = 0;
+  uint64_t _binary_appendix_size = 0;
+};
+
 class hcf_container {
 public:
   struct node {
@@ -142,18 +440,19 @@ public:
     _root_node.node_id = "root";
   }
 
+  // Parses HCF data in text or binary format. The binary appendix is copied.
   hcf_container(const std::string& container) {
-    std::string appendix_id {_binary_appendix_id};
-
-    std::size_t appendix_begin = container.find(appendix_id);
-    if(appendix_begin != std::string::npos) {
-      _binary_appendix = container.substr(appendix_begin + appendix_id.length());
-    }
-
-    std::string parseable_data = container;
-    parseable_data.erase(appendix_begin);
+    load(container, true);
+  }
 
-    parse(parseable_data);
+  // Parses HCF data in text or binary format without copying the binary
+  // appendix. data must outlive the container and all of its copies, e.g.
+  // because it is the HCF data embedded in the application or a
+  // common::mapped_file.
+  static hcf_container from_static_data(std::string_view data) {
+    hcf_container result;
+    result.load(data, false);
+    return result;
   }
 
   const node* root_node() const {
@@ -164,7 +463,9 @@ public:
     return &_root_node;
   }
 
-  bool get_binary_attachment(const node* n, std::string& out) const {
+  // Returns a view of the attachment that remains valid as long as
+  // the container is not modified.
+  bool get_binary_attachment(const node* n, std::string_view& out) const {
     std::size_t start = 0;
     std::size_t size = 0;
 
@@ -197,10 +498,14 @@ public:
       return false;
     }
 
-    start = std::stoull(*start_entry);
-    size = std::stoull(*size_entry);
+    if (!hcf_binary_view::parse_size(*start_entry, start) ||
+        !hcf_binary_view::parse_size(*size_entry, size)) {
+      HIPSYCL_DEBUG_ERROR << "hcf: Invalid binary content address\n";
+      return false;
+    }
 
-    if(start + size > _binary_appendix.size()) {
+    if(start > _binary_appendix.size() ||
+       size > _binary_appendix.size() - start) {
       HIPSYCL_DEBUG_ERROR << "hcf: Binary content address is out-of-bounds\n";
       return false;
     }
@@ -210,7 +515,15 @@ public:
     return true;
   }
 
-  bool attach_binary_content(node* n, const std::string& binary_content) {
+  bool get_binary_attachment(const node* n, std::string& out) const {
+    std::string_view attachment;
+    if(!get_binary_attachment(n, attachment))
+      return false;
+    out = std::string{attachment};
+    return true;
+  }
+
+  bool attach_binary_content(node* n, std::string_view binary_content) {
     
     node* binary_node = n->add_subnode(_binary_marker);
     if(!binary_node)
@@ -219,7 +532,12 @@ public:
     std::size_t start = _binary_appendix.size();
     std::size_t length = binary_content.size();
 
-    _binary_appendix += binary_content;
+    // The appendix may be shared with copies of this container,
+    // or may not be owned by us at all.
+    if(!_owned_appendix || _owned_appendix.use_count() > 1)
+      _owned_appendix = std::make_shared<std::string>(_binary_appendix);
+    _owned_appendix->append(binary_content.data(), binary_content.size());
+    _binary_appendix = *_owned_appendix;
 
     binary_node->set("start", std::to_string(start));
     binary_node->set("size", std::to_string(length));
@@ -232,10 +550,214 @@ public:
     serialize_node(_root_node, sstr);
     sstr << _binary_appendix_id;
 
-    return sstr.str() + _binary_appendix;
+    std::string result = sstr.str();
+    result.append(_binary_appendix.data(), _binary_appendix.size());
+    return result;
+  }
+
+  // Serializes into the binary format, which can be accessed without
+  // parsing using hcf_binary_view.
+  std::string serialize_binary() const {
+    // Nodes are stored in breadth-first order, such that the subnodes of
+    // each node are contiguous.
+    std::vector<const node*> nodes {&_root_node};
+    std::vector<uint32_t> first_child {0};
+    std::vector<uint32_t> first_entry {0};
+    std::size_t num_entries = 0;
+    for(std::size_t i = 0; i < nodes.size(); ++i) {
+      first_entry[i] = num_entries;
+      num_entries += nodes[i]->key_value_pairs.size();
+      first_child[i] = nodes.size();
+      for(const auto& s : nodes[i]->subnodes) {
+        nodes.push_back(&s);
+        first_child.push_back(0);
+        first_entry.push_back(0);
+      }
+    }
+
+    std::string strings;
+    std::unordered_map<std::string, uint32_t> string_offsets;
+    std::string node_table;
+    std::string entry_table;
+
+    auto append_le = [](std::string& out, uint64_t value,
+                        std::size_t num_bytes) {
+      for(std::size_t i = 0; i < num_bytes; ++i)
+        out.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+    };
+    auto append_string = [&](std::string& out, const std::string& s) {
+      auto it = string_offsets.find(s);
+      if(it == string_offsets.end()) {
+        it = string_offsets.emplace(s, strings.size()).first;
+        strings += s;
+      }
+      append_le(out, it->second, 4);
+      append_le(out, s.size(), 4);
+    };
+    // Orders indices within [first, first+count) by hash, and by index
+    // for equal hashes.
+    auto append_lookup_table = [&](std::string& out, std::size_t first,
+                                   std::size_t count, auto&& hash_of) {
+      std::vector<std::pair<uint64_t, uint32_t>> order;
+      for(std::size_t i = first; i < first + count; ++i)
+        order.push_back(std::make_pair(hash_of(i), i));
+      std::sort(order.begin(), order.end());
+      for(const auto& entry : order)
+        append_le(out, entry.second, 4);
+    };
+
+    std::string node_lookup_table;
+    std::string entry_lookup_table;
+    // The root node is nobody's subnode
+    append_le(node_lookup_table, 0, 4);
+    for(std::size_t i = 0; i < nodes.size(); ++i) {
+      const node* n = nodes[i];
+      append_le(node_table, hcf_binary_view::hash(n->node_id), 8);
+      append_string(node_table, n->node_id);
+      append_le(node_table, first_entry[i], 4);
+      append_le(node_table, n->key_value_pairs.size(), 4);
+      append_le(node_table, first_child[i], 4);
+      append_le(node_table, n->subnodes.size(), 4);
+
+      for(const auto& kv : n->key_value_pairs) {
+        append_le(entry_table, hcf_binary_view::hash(kv.first), 8);
+        append_string(entry_table, kv.first);
+        append_string(entry_table, kv.second);
+      }
+
+      append_lookup_table(node_lookup_table, first_child[i],
+                          n->subnodes.size(), [&](std::size_t idx) {
+                            return hcf_binary_view::hash(nodes[idx]->node_id);
+                          });
+      append_lookup_table(
+          entry_lookup_table, first_entry[i], n->key_value_pairs.size(),
+          [&](std::size_t idx) {
+            return hcf_binary_view::hash(
+                n->key_value_pairs[idx - first_entry[i]].first);
+          });
+    }
+
+    std::size_t node_table_offset = hcf_binary_view::header_size;
+    std::size_t node_lookup_offset = node_table_offset + node_table.size();
+    std::size_t entry_table_offset =
+        node_lookup_offset + node_lookup_table.size();
+    std::size_t entry_lookup_offset = entry_table_offset + entry_table.size();
+    std::size_t string_table_offset =
+        entry_lookup_offset + entry_lookup_table.size();
+    std::size_t appendix_offset = string_table_offset + strings.size();
+
+    std::string result{hcf_binary_view::magic,
+                       sizeof(hcf_binary_view::magic) - 1};
+    append_le(result, hcf_binary_view::version, 4);
+    append_le(result, nodes.size(), 4);
+    append_le(result, num_entries, 4);
+    append_le(result, 0, 4);
+    append_le(result, node_table_offset, 8);
+    append_le(result, node_lookup_offset, 8);
+    append_le(result, entry_table_offset, 8);
+    append_le(result, entry_lookup_offset, 8);
+    append_le(result, string_table_offset, 8);
+    append_le(result, appendix_offset, 8);
+    append_le(result, _binary_appendix.size(), 8);
+    assert(result.size() == hcf_binary_view::header_size);
+
+    result.reserve(appendix_offset + _binary_appendix.size());
+    result += node_table;
+    result += node_lookup_table;
+    result += entry_table;
+    result += entry_lookup_table;
+    result += strings;
+    result.append(_binary_appendix.data(), _binary_appendix.size());
+    return result;
   }
 private:
 
+  bool load(std::string_view data, bool copy_binary_appendix) {
+    std::string_view appendix;
+    bool success = false;
+    _root_node = node{};
+    _root_node.node_id = "root";
+
+    if(hcf_binary_view::is_binary_hcf(data)) {
+      hcf_binary_view view{data};
+      if(view.is_valid()) {
+        std::size_t remaining_nodes = view.get_num_nodes();
+        std::size_t remaining_entries = view.get_num_entries();
+        success = materialize_node(view, view.root(), _root_node,
+                                   remaining_nodes, remaining_entries);
+      }
+      if(success) {
+        appendix = view.get_binary_appendix();
+      } else {
+        // Don't expose a partially materialized node tree
+        _root_node = node{};
+        _root_node.node_id = "root";
+      }
+    } else {
+      std::string_view appendix_id {_binary_appendix_id};
+
+      std::size_t appendix_begin = data.find(appendix_id);
+      if(appendix_begin != std::string_view::npos) {
+        appendix = data.substr(appendix_begin + appendix_id.length());
+      }
+
+      success = parse(data.substr(0, appendix_begin));
+    }
+
+    if(copy_binary_appendix) {
+      _owned_appendix = std::make_shared<std::string>(appendix);
+      _binary_appendix = *_owned_appendix;
+    } else {
+      _owned_appendix.reset();
+      _binary_appendix = appendix;
+    }
+    return success;
+  }
+
+  // remaining_nodes and remaining_entries limit how many nodes and values
+  // may still be materialized. A valid HCF materializes each node and
+  // value once, but a corrupted one could reference the same ranges from
+  // several nodes.
+  bool materialize_node(const hcf_binary_view &view,
+                        hcf_binary_view::node_index n, node &out,
+                        std::size_t &remaining_nodes,
+                        std::size_t &remaining_entries) const {
+    if(!view.has_valid_ranges(n) || remaining_nodes == 0) {
+      HIPSYCL_DEBUG_ERROR << "hcf: Binary HCF is truncated or corrupted\n";
+      return false;
+    }
+    --remaining_nodes;
+
+    out.node_id = std::string{view.get_node_name(n)};
+
+    std::size_t num_values = view.get_num_values(n);
+    std::size_t num_subnodes = view.get_num_subnodes(n);
+    if(num_values > remaining_entries || num_subnodes > remaining_nodes) {
+      HIPSYCL_DEBUG_ERROR << "hcf: Binary HCF is truncated or corrupted\n";
+      return false;
+    }
+    remaining_entries -= num_values;
+
+    out.key_value_pairs.reserve(num_values);
+    for(std::size_t i = 0; i < num_values; ++i) {
+      auto kv = view.get_key_value_pair(n, i);
+      out.key_value_pairs.push_back(
+          std::make_pair(std::string{kv.first}, std::string{kv.second}));
+    }
+
+    out.subnodes.resize(num_subnodes);
+    for(std::size_t i = 0; i < num_subnodes; ++i) {
+      hcf_binary_view::node_index s = view.get_subnode(n, i);
+      // Subnodes always come after their parent, which rules out cycles
+      if(s == hcf_binary_view::invalid_node || s <= n)
+        return false;
+      if(!materialize_node(view, s, out.subnodes[i], remaining_nodes,
+                           remaining_entries))
+        return false;
+    }
+    return true;
+  }
+
   void serialize_node(const node& n, std::ostream& out) const {
     for(const auto& p : n.key_value_pairs){
       out << p.first << "=" << p.second << "\n";
@@ -292,7 +814,7 @@ private:
     if(node_start_line == node_end_line)
       return true;
 
-    for(int i = node_start_line; i <  node_end_line; ++i) {
+    for(std::size_t i = node_start_line; i <  node_end_line; ++i) {
       assert(i < lines.size());
       const std::string& current = lines[i];
 
@@ -306,7 +828,7 @@ private:
         std::size_t num_node_lines = std::string::npos;
         std::string node_end_marker = _node_end_id + new_node.node_id;
         
-        for(int j = i + 1; j < node_end_line; ++j) {
+        for(std::size_t j = i + 1; j < node_end_line; ++j) {
           if(lines[j] == node_end_marker) {
             num_node_lines = j-i;
             break;
@@ -343,13 +865,14 @@ private:
     return true;
   }
 
-  bool parse(const std::string& data) {
-    std::stringstream ss(data);
-    std::string line;
-
+  bool parse(std::string_view data) {
     std::vector<std::string> lines;
-    
-    while(std::getline(ss,line)){
+
+    while(!data.empty()) {
+      std::size_t line_end = data.find('\n');
+      std::string line{data.substr(0, line_end)};
+      data.remove_prefix(line_end == std::string_view::npos ? data.size()
+                                                            : line_end + 1);
       trim_left(line);
       trim_right(line);
 
@@ -367,7 +890,10 @@ private:
   static constexpr char _binary_marker [] = "__binary";
 
   node _root_node;
-  std::string _binary_appendix;
+  // View of the binary appendix. It either points into _owned_appendix,
+  // or into data passed to from_static_data().
+  std::string_view _binary_appendix;
+  std::shared_ptr<std::string> _owned_appendix;
 };
 
 }
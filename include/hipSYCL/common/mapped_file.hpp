@@ -0,0 +1,113 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HIPSYCL_COMMON_MAPPED_FILE_HPP
+#define HIPSYCL_COMMON_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace hipsycl {
+namespace common {
+
+/// Read-only view of the content of a file. Where supported, the file is
+/// memory-mapped, so that only the parts that are accessed are read from
+/// disk. Otherwise, the file content is read into memory.
+class mapped_file {
+public:
+  mapped_file() = default;
+  mapped_file(const mapped_file&) = delete;
+  mapped_file& operator=(const mapped_file&) = delete;
+
+  ~mapped_file() {
+#ifndef _WIN32
+    if(_mapping)
+      munmap(_mapping, _size);
+#endif
+  }
+
+  bool open(const std::string& filename) {
+#ifndef _WIN32
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if(fd < 0)
+      return false;
+
+    struct stat file_stat;
+    if(fstat(fd, &file_stat) != 0) {
+      ::close(fd);
+      return false;
+    }
+    _size = static_cast<std::size_t>(file_stat.st_size);
+
+    if(_size > 0) {
+      void* mapping = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if(mapping != MAP_FAILED)
+        _mapping = mapping;
+    }
+    ::close(fd);
+
+    if(_mapping || _size == 0)
+      return true;
+#endif
+    // Fall back to reading the file
+    std::ifstream file{filename, std::ios::binary | std::ios::ate};
+    if(!file.is_open())
+      return false;
+
+    _content.resize(static_cast<std::size_t>(file.tellg()));
+    file.seekg(0, std::ios::beg);
+    file.read(_content.data(), _content.size());
+    _size = _content.size();
+    return static_cast<bool>(file);
+  }
+
+  std::string_view data() const {
+    if(_mapping)
+      return std::string_view{static_cast<const char *>(_mapping), _size};
+    return _content;
+  }
+
+private:
+  void* _mapping = nullptr;
+  std::size_t _size = 0;
+  std::string _content;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,67 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HIPSYCL_REGIONVECTORIZER_HPP
+#define HIPSYCL_REGIONVECTORIZER_HPP
+
+#include "llvm/IR/PassManager.h"
+#include "llvm/Pass.h"
+
+namespace hipsycl {
+namespace compiler {
+
+// vectorizes work-item loops containing divergent control flow across work-items.
+// The loop body is linearized and guarded by block masks, using the vector shapes from the
+// VectorizationAnalysis to keep uniform values scalar and to pick contiguous memory accesses
+// over gathers / scatters. Emits optimization remarks as a vectorization report.
+class RegionVectorizerPassLegacy : public llvm::FunctionPass {
+
+public:
+  static char ID;
+
+  explicit RegionVectorizerPassLegacy() : llvm::FunctionPass(ID) {}
+
+  llvm::StringRef getPassName() const override { return "hipSYCL region vectorization pass"; }
+
+  void getAnalysisUsage(llvm::AnalysisUsage &AU) const override;
+
+  bool runOnFunction(llvm::Function &F) override;
+};
+
+class RegionVectorizerPass : public llvm::PassInfoMixin<RegionVectorizerPass> {
+
+public:
+  explicit RegionVectorizerPass() {}
+
+  llvm::PreservedAnalyses run(llvm::Function &F, llvm::FunctionAnalysisManager &AM);
+  static bool isRequired() { return false; }
+};
+} // namespace compiler
+} // namespace hipsycl
+
+#endif // HIPSYCL_REGIONVECTORIZER_HPP
@@ -34,6 +34,7 @@
 // LLVM code into the hipSYCL runtime.
 #include <optional>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <unordered_map>
 #include <vector>
@@ -84,6 +85,12 @@ public:
 
   void setS2IRConstant(const std::string& name, const void* ValueBuffer);
 
+  // Replaces all uses of the parameter ParamIndex of the kernel KernelName
+  // with the integer or floating point constant stored in ValueBuffer.
+  // The parameter remains part of the kernel signature.
+  void specializeKernelArgument(const std::string &KernelName, std::size_t ParamIndex,
+                                const void *ValueBuffer, std::size_t ValueSize);
+
   bool setBuildFlag(const std::string &Flag);
   bool setBuildOption(const std::string &Option, const std::string &Value);
   bool setBuildToolArguments(const std::string &ToolName, const std::vector<std::string> &Args);
@@ -94,10 +101,10 @@ public:
   }
 
   // Does partial transformation to backend-flavored LLVM IR
-  bool partialTransformation(const std::string& LLVMIR, std::string& out);
+  bool partialTransformation(std::string_view LLVMIR, std::string& out);
 
   // Does full transformation to backend specific format
-  bool fullTransformation(const std::string& LLVMIR, std::string& out);
+  bool fullTransformation(std::string_view LLVMIR, std::string& out);
   bool prepareIR(llvm::Module& M);
   bool translatePreparedIR(llvm::Module& FlavoredModule, std::string& out);
 
@@ -125,6 +132,17 @@ public:
     return S2IRConstantBackendId;
   }
 
+  const std::vector<std::string>& getOutliningEntrypoints() const {
+    return OutliningEntrypoints;
+  }
+
+  // Returns all build flags, options and tool arguments in the order
+  // in which they were set. Together with the input IR and S2 IR constants,
+  // this identifies the result of the translation.
+  const std::vector<std::string>& getBuildConfiguration() const {
+    return BuildConfiguration;
+  }
+
   using SymbolListType = std::vector<std::string>;
 
   class ExternalSymbolResolver {
@@ -135,8 +153,10 @@ public:
     using SymbolsToModuleIdMapperType =
         std::function<std::vector<LLVMModuleId>(const SymbolListType &SymbolList)>;
     // BitcodeStringRetriever will return the IR bitcode string as well as the imported symbols,
-    // given a unique LLVM module id.
-    using BitcodeStringRetrieverType = std::function<std::string (LLVMModuleId, SymbolListType&)>;
+    // given a unique LLVM module id. The returned bitcode must remain valid until the
+    // translation has completed.
+    using BitcodeStringRetrieverType =
+        std::function<std::string_view(LLVMModuleId, SymbolListType &)>;
 
     ExternalSymbolResolver() = default;
     ExternalSymbolResolver(const SymbolsToModuleIdMapperType &SymbolMapper,
@@ -182,7 +202,7 @@ protected:
                        const std::string &ForcedTriple = "",
                        const std::string &ForcedDataLayout = "",
                        bool LinkOnlyNeeded = true);
-  bool linkBitcodeString(llvm::Module &M, const std::string &Bitcode,
+  bool linkBitcodeString(llvm::Module &M, std::string_view Bitcode,
                          const std::string &ForcedTriple = "",
                          const std::string &ForcedDataLayout = "",
                          bool LinkOnlyNeeded = true);
@@ -206,8 +226,10 @@ private:
 
   int S2IRConstantBackendId;
   std::vector<std::string> OutliningEntrypoints;
+  std::vector<std::string> BuildConfiguration;
   std::vector<std::string> Errors;
   std::unordered_map<std::string, std::function<void(llvm::Module &)>> S2IRConstantApplicators;
+  std::vector<std::function<void(llvm::Module &)>> KernelArgumentSpecializations;
   ExternalSymbolResolver SymbolResolver;
   bool HasExternalSymbolResolver = false;
 
@@ -35,6 +35,7 @@
 #include <functional>
 #include "LLVMToBackend.hpp"
 #include "hipSYCL/common/hcf_container.hpp"
+#include "hipSYCL/common/mapped_file.hpp"
 
 namespace hipsycl {
 namespace compiler {
@@ -65,28 +66,6 @@ inline void help() {
       << std::endl;
 }
 
-inline bool readFile(const std::string& Filename, std::string& Out) {
-  std::ifstream File{Filename, std::ios::binary|std::ios::ate};
-  if(!File.is_open())
-    return false;
-
-  auto size = File.tellg();
-
-  if (size == 0) {
-      Out = std::string{};
-      return true;
-  }
-
-  std::string result(size, '\0');
-
-  File.seekg(0, std::ios::beg);
-  File.read(result.data(), size);
-
-  Out = result;
-
-  return true;
-}
-
 inline bool writeFile(const std::string& Filename, const std::string& Data){
   std::ofstream File{Filename, std::ios::binary|std::ios::trunc};
   if(!File.is_open()){
@@ -178,12 +157,13 @@ inline int LLVMToBackendToolMain(int argc, char **argv, TranslatorFactory &&crea
   std::string OutputFile = argv[GeneralArgsStart+1];
   std::string ImageName = argv[GeneralArgsStart+2];
 
-  std::string HcfInput, Output;
-  if(!readFile(InputFile, HcfInput)) {
+  std::string Output;
+  common::mapped_file HcfFile;
+  if(!HcfFile.open(InputFile)) {
     std::cout << "Could not open file: " << InputFile << std::endl;
   }
 
-  common::hcf_container HCF{HcfInput};
+  auto HCF = common::hcf_container::from_static_data(HcfFile.data());
   auto* ImgNode = HCF.root_node()->get_subnode("images");
   if(!ImgNode) {
     std::cout << "Invalid HCF: Could not find 'images' node" << std::endl;
@@ -199,7 +179,7 @@ inline int LLVMToBackendToolMain(int argc, char **argv, TranslatorFactory &&crea
     return -1;
   }
 
-  std::string IR;
+  std::string_view IR;
   HCF.get_binary_attachment(ImgNode, IR);
   
   auto Translator = createTranslator(HCF);
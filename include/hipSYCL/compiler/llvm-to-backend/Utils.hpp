@@ -29,13 +29,18 @@
 #define HIPSYCL_LLVM_TO_BACKEND_UTILS_HPP
 
 #include <atomic>
+#include <functional>
 
 #include "hipSYCL/compiler/llvm-to-backend/LLVMToBackend.hpp"
 #include "hipSYCL/common/debug.hpp"
 #include <llvm/ADT/DenseMap.h>
 #include <llvm/IR/Attributes.h>
+#include <llvm/ADT/SmallPtrSet.h>
 #include <llvm/ADT/SmallSet.h>
+#include <llvm/IR/Constants.h>
 #include <llvm/IR/Function.h>
+#include <llvm/IR/GlobalAlias.h>
+#include <llvm/IR/GlobalVariable.h>
 #include <llvm/Support/Casting.h>
 #include <llvm/IR/Type.h>
 #include <llvm/IR/Instructions.h>
@@ -71,7 +76,7 @@ struct PassHandler {
   llvm::ModuleAnalysisManager* ModuleAnalysisManager;
 };
 
-inline llvm::Error loadModuleFromString(const std::string &LLVMIR, llvm::LLVMContext &ctx,
+inline llvm::Error loadModuleFromString(std::string_view LLVMIR, llvm::LLVMContext &ctx,
                                         std::unique_ptr<llvm::Module> &out) {
 
   auto buff = llvm::MemoryBuffer::getMemBuffer(LLVMIR, "", false);
@@ -86,6 +91,104 @@ inline llvm::Error loadModuleFromString(const std::string &LLVMIR, llvm::LLVMCon
   return llvm::Error::success();
 }
 
+// Loads the module lazily, i.e. function bodies are only parsed when they
+// are materialized, e.g. by the linker. LLVMIR must remain valid until
+// the module has been fully materialized or destroyed.
+inline llvm::Error loadLazyModuleFromString(std::string_view LLVMIR,
+                                            llvm::LLVMContext &ctx,
+                                            std::unique_ptr<llvm::Module> &out) {
+  llvm::MemoryBufferRef Buff{llvm::StringRef{LLVMIR.data(), LLVMIR.size()}, ""};
+  auto BC = llvm::getLazyBitcodeModule(Buff, ctx);
+
+  if(auto err = BC.takeError()) {
+    return err;
+  }
+
+  out = std::move(BC.get());
+
+  return llvm::Error::success();
+}
+
+// Like loadModuleFromString(), but only parses the bodies of functions that
+// are referenced - directly or indirectly - by the given entrypoints. All other
+// functions are removed from the module. For device images containing many
+// kernels, this avoids parsing the code of all other kernels when only
+// some of them are compiled.
+inline llvm::Error loadModuleFromString(std::string_view LLVMIR, llvm::LLVMContext &ctx,
+                                        const std::vector<std::string> &Entrypoints,
+                                        std::unique_ptr<llvm::Module> &out) {
+  std::unique_ptr<llvm::Module> M;
+  if(auto err = loadLazyModuleFromString(LLVMIR, ctx, M))
+    return err;
+
+  llvm::SmallPtrSet<llvm::Function *, 32> ReachableFunctions;
+  llvm::SmallPtrSet<const llvm::Constant *, 32> VisitedConstants;
+  llvm::SmallVector<llvm::Function *, 32> Worklist;
+
+  // Global initializers are available without materialization
+  std::function<void(const llvm::Constant *)> VisitConstant =
+      [&](const llvm::Constant *C) {
+        if(!VisitedConstants.insert(C).second)
+          return;
+        if(auto *F = llvm::dyn_cast<llvm::Function>(C)) {
+          auto *MutableF = const_cast<llvm::Function *>(F);
+          if(ReachableFunctions.insert(MutableF).second)
+            Worklist.push_back(MutableF);
+        } else if(auto *GV = llvm::dyn_cast<llvm::GlobalVariable>(C)) {
+          if(GV->hasInitializer())
+            VisitConstant(GV->getInitializer());
+        } else if(auto *GA = llvm::dyn_cast<llvm::GlobalAlias>(C)) {
+          if(GA->getAliasee())
+            VisitConstant(GA->getAliasee());
+        } else {
+          for(const auto &Op : C->operands())
+            if(auto *OpC = llvm::dyn_cast<llvm::Constant>(Op))
+              VisitConstant(OpC);
+        }
+      };
+
+  for(const auto &Name : Entrypoints)
+    if(auto *F = M->getFunction(Name))
+      VisitConstant(F);
+
+  while(!Worklist.empty()) {
+    llvm::Function *F = Worklist.pop_back_val();
+    if(auto err = F->materialize())
+      return err;
+
+    if(F->hasPersonalityFn())
+      VisitConstant(F->getPersonalityFn());
+    for(auto &BB : *F)
+      for(auto &I : BB)
+        for(const auto &Op : I.operands())
+          if(auto *C = llvm::dyn_cast<llvm::Constant>(Op))
+            VisitConstant(C);
+  }
+
+  // Turn all other functions into declarations, so that their bodies
+  // are never parsed
+  llvm::SmallVector<llvm::Function *, 32> UnreachableFunctions;
+  for(auto &F : *M) {
+    if(F.isMaterializable() && !ReachableFunctions.contains(&F)) {
+      F.deleteBody();
+      UnreachableFunctions.push_back(&F);
+    }
+  }
+
+  if(auto err = M->materializeAll())
+    return err;
+
+  // Only unreachable functions and globals can still refer to them
+  for(auto *F : UnreachableFunctions) {
+    F->replaceAllUsesWith(llvm::UndefValue::get(F->getType()));
+    F->eraseFromParent();
+  }
+
+  out = std::move(M);
+
+  return llvm::Error::success();
+}
+
 template<class F>
 inline void constructPassBuilder(F&& handler) {
   llvm::LoopAnalysisManager LAM;
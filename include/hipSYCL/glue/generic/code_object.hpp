@@ -32,6 +32,7 @@
 #include <vector>
 #include <array>
 #include <string>
+#include <string_view>
 #include "hipSYCL/runtime/device_id.hpp"
 #include "hipSYCL/runtime/kernel_cache.hpp"
 #include "hipSYCL/common/hcf_container.hpp"
@@ -47,8 +48,9 @@
   public:                                                                      \
     __hipsycl_hcf_registration##hcf_obj() {                             \
       this->_id = ::hipsycl::rt::hcf_cache::get().register_hcf_object(         \
-          ::hipsycl::common::hcf_container{std::string{                        \
-              reinterpret_cast<const char *>(hcf_string), hcf_size}});         \
+          ::hipsycl::common::hcf_container::from_static_data(               \
+              std::string_view{reinterpret_cast<const char *>(hcf_string),     \
+                               hcf_size}));                                    \
     }                                                                          \
     ~__hipsycl_hcf_registration##hcf_obj() {                            \
       ::hipsycl::rt::hcf_cache::get().unregister_hcf_object(this->_id);        \
@@ -41,7 +41,10 @@
 
 #ifdef HIPSYCL_HAS_FIBERS
 
+#include <algorithm>
 #include <functional>
+#include <memory>
+#include <vector>
 
 #include <boost/fiber/fiber.hpp>
 #include <boost/fiber/barrier.hpp>
@@ -69,11 +72,19 @@ public:
       sycl::range<Dim> num_groups, sycl::range<Dim> local_size,
       sycl::id<Dim> offset,
       const static_range_decomposition<Dim> &group_range_decomposition,
-      int my_group_region)
+      int my_group_region, std::size_t sub_group_size = 1)
       : _num_groups{num_groups}, _local_size{local_size}, _offset{offset},
         _group_barrier{local_size.size()}, _fibers_spawned{false},
         _fibers(local_size.size()), _groups{group_range_decomposition},
-        _my_group_region{my_group_region} {}
+        _my_group_region{my_group_region},
+        _sub_group_size{std::max(sub_group_size, std::size_t{1})} {
+    if(_sub_group_size > 1) {
+      const std::size_t group_size = local_size.size();
+      for(std::size_t begin = 0; begin < group_size; begin += _sub_group_size)
+        _sub_group_barriers.push_back(std::make_unique<boost::fibers::barrier>(
+            std::min(_sub_group_size, group_size - begin)));
+    }
+  }
 
   template <class WorkItemFunction>
   void run_kernel(WorkItemFunction f) {
@@ -81,6 +92,13 @@ public:
     _fibers_spawned = false;
     _master_group_position = 0;
 
+    // Sub-groups may synchronize without the rest of the work group, e.g.
+    // in a branch on the sub-group id. Sequential processing cannot cope
+    // with this, since it would have executed the work items of other
+    // sub-groups already when the first sub-group barrier is reached.
+    if(!_sub_group_barriers.empty() && _fibers.size() > 1)
+      spawn_fibers();
+
     // Try sequential processing (using only one fiber) - if
     // other fibers need to be spawned, only process first work item
     // as other work items will be processed by other fibers
@@ -126,6 +144,17 @@ public:
     _group_barrier.wait();
   }
 
+  /// Synchronizes the sub-group of the work item with the given linear id
+  /// in the work group. Only waits for the work group if the sub-groups
+  /// consist of single work items.
+  void sub_group_barrier(std::size_t local_linear_id) {
+    if(_sub_group_barriers.empty()) {
+      barrier();
+      return;
+    }
+    _sub_group_barriers[local_linear_id / _sub_group_size]->wait();
+  }
+
 private:
   // Spawn remaining fibers
   void spawn_fibers() {
@@ -168,6 +197,8 @@ private:
   std::size_t _master_group_position;
   const static_range_decomposition<Dim> &_groups;
   int _my_group_region;
+  std::size_t _sub_group_size;
+  std::vector<std::unique_ptr<boost::fibers::barrier>> _sub_group_barriers;
 };
 
 }
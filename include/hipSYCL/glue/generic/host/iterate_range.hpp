@@ -28,6 +28,7 @@
 #ifndef HIPSYCL_ITERATE_RANGE_HPP
 #define HIPSYCL_ITERATE_RANGE_HPP
 
+#include <algorithm>
 #include <cstdint>
 
 #include "hipSYCL/sycl/libkernel/range.hpp"
@@ -212,6 +213,44 @@ void iterate_partial_range(const sycl::range<Dim> whole_range,
     }
   }
 }
+
+template <int Dim>
+sycl::id<Dim> get_id_from_linear_id(const sycl::range<Dim> r,
+                                    const std::size_t linear_id) noexcept {
+  sycl::id<Dim> result;
+  if constexpr (Dim == 1) {
+    result[0] = linear_id;
+  } else if constexpr (Dim == 2) {
+    result[1] = linear_id % r[1];
+    result[0] = linear_id / r[1];
+  } else if constexpr (Dim == 3) {
+    std::size_t surface_id = linear_id / (r[2] * r[1]);
+    std::size_t index2d    = linear_id % (r[2] * r[1]);
+
+    result[2] = index2d % r[2];
+    result[1] = index2d / r[2];
+    result[0] = surface_id;
+  }
+  return result;
+}
+
+// Splits the range into num_partitions contiguous parts of (almost) equal
+// size, and iterates over the part with the given index.
+template <int Dim, class Function>
+void iterate_range_partition(const sycl::range<Dim> r, const int partition,
+                             const int num_partitions, Function f) noexcept {
+  const std::size_t total_num_elements = r.size();
+  const std::size_t remainder = total_num_elements % num_partitions;
+  const std::size_t partition_size = total_num_elements / num_partitions;
+
+  const std::size_t p = static_cast<std::size_t>(partition);
+  const std::size_t begin = p * partition_size + std::min(p, remainder);
+  const std::size_t num_elements = partition_size + (p < remainder ? 1 : 0);
+
+  if (num_elements > 0)
+    iterate_partial_range(r, get_id_from_linear_id(r, begin), num_elements, f);
+}
+
 }
 }
 } // namespace hipsycl
@@ -0,0 +1,168 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HIPSYCL_WORK_STEALING_SCHEDULER_HPP
+#define HIPSYCL_WORK_STEALING_SCHEDULER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include "hipSYCL/sycl/libkernel/id.hpp"
+#include "hipSYCL/sycl/libkernel/range.hpp"
+
+#include "iterate_range.hpp"
+
+namespace hipsycl {
+namespace glue {
+namespace host {
+
+/// Distributes the elements of a range dynamically across workers.
+///
+/// Each worker initially owns a contiguous part of the range and processes
+/// it in chunks that shrink geometrically as its part is used up. Workers
+/// that run out of work steal the upper half of the remaining elements of
+/// another worker. This keeps all workers busy until the end even if the
+/// cost per element is very irregular, while preserving locality as long as
+/// the load is balanced.
+///
+/// run() must be invoked concurrently by the workers. Workers that never
+/// call run() are not a problem, their elements are stolen by others.
+template<int Dim>
+class work_stealing_range_scheduler {
+public:
+  static_assert(Dim >= 1 && Dim <= 3, "Dimension must be 1,2 or 3");
+
+  work_stealing_range_scheduler(sycl::range<Dim> r, int num_workers)
+      : _range{r}, _num_workers{std::max(num_workers, 1)},
+        _workers{new worker_state[std::max(num_workers, 1)]} {
+
+    std::size_t total_num_elements = _range.size();
+    std::size_t remainder = total_num_elements % _num_workers;
+    std::size_t region_size = total_num_elements / _num_workers;
+
+    std::size_t begin = 0;
+    for(int i = 0; i < _num_workers; ++i) {
+      std::size_t size = region_size;
+      if(static_cast<std::size_t>(i) < remainder)
+        ++size;
+      _workers[i].begin = begin;
+      _workers[i].end = begin + size;
+      begin += size;
+    }
+  }
+
+  template <class F> void run(int worker_id, F f) {
+    worker_state& self = _workers[worker_id % _num_workers];
+
+    std::size_t chunk_begin = 0;
+    std::size_t chunk_size = 0;
+    for(;;) {
+      if(!take_chunk(self, chunk_begin, chunk_size)) {
+        if(!steal(worker_id % _num_workers))
+          return;
+        continue;
+      }
+      iterate_partial_range(_range, get_id_from_linear_id(_range, chunk_begin),
+                            chunk_size, f);
+    }
+  }
+
+private:
+  // Fraction of the remaining elements of its own part that a worker
+  // takes as the next chunk
+  static constexpr std::size_t chunk_divisor = 4;
+
+  struct alignas(64) worker_state {
+    std::atomic<bool> is_locked{false};
+    std::size_t begin = 0;
+    std::size_t end = 0;
+
+    void lock() {
+      for(;;) {
+        if(!is_locked.exchange(true, std::memory_order_acquire))
+          return;
+        while(is_locked.load(std::memory_order_relaxed))
+          ;
+      }
+    }
+
+    void unlock() {
+      is_locked.store(false, std::memory_order_release);
+    }
+  };
+
+  bool take_chunk(worker_state& w, std::size_t& chunk_begin,
+                  std::size_t& chunk_size) {
+    w.lock();
+    std::size_t remaining = w.end - w.begin;
+    if(remaining == 0) {
+      w.unlock();
+      return false;
+    }
+    chunk_size = std::max(std::size_t{1}, remaining / chunk_divisor);
+    chunk_begin = w.begin;
+    w.begin += chunk_size;
+    w.unlock();
+    return true;
+  }
+
+  bool steal(int thief) {
+    for(int i = 1; i < _num_workers; ++i) {
+      worker_state& victim = _workers[(thief + i) % _num_workers];
+      victim.lock();
+      std::size_t remaining = victim.end - victim.begin;
+      if(remaining == 0) {
+        victim.unlock();
+        continue;
+      }
+      std::size_t stolen_end = victim.end;
+      victim.end -= (remaining + 1) / 2;
+      std::size_t stolen_begin = victim.end;
+      victim.unlock();
+
+      worker_state& self = _workers[thief];
+      self.lock();
+      self.begin = stolen_begin;
+      self.end = stolen_end;
+      self.unlock();
+      return true;
+    }
+    return false;
+  }
+
+  sycl::range<Dim> _range;
+  int _num_workers;
+  std::unique_ptr<worker_state[]> _workers;
+};
+
+}
+}
+}
+
+#endif
@@ -96,6 +96,37 @@ class kernel_configuration {
       return _name;
     }
   };
+
+  class specialized_argument {
+    static constexpr std::size_t buffer_size = 8;
+
+    std::size_t _param_index;
+    std::array<int8_t, buffer_size> _value;
+    std::size_t _data_size;
+
+  public:
+    specialized_argument(std::size_t param_index, const void *data,
+                         std::size_t data_size)
+        : _param_index{param_index}, _data_size{data_size} {
+      assert(data_size <= buffer_size);
+      for(std::size_t i = 0; i < _value.size(); ++i)
+        _value[i] = 0;
+
+      memcpy(_value.data(), data, data_size);
+    }
+
+    std::size_t get_param_index() const {
+      return _param_index;
+    }
+
+    const void* get_data_buffer() const {
+      return _value.data();
+    }
+
+    std::size_t get_data_size() const {
+      return _data_size;
+    }
+  };
 public:
   using id_type = std::array<uint64_t, 2>;
 
@@ -111,6 +142,23 @@ public:
     _configurations.push_back(entry);
   }
 
+  // Requests that the kernel is compiled for a specific value of the
+  // kernel function parameter with index param_index. The value is
+  // folded into the kernel as a constant, so the kernel must only be
+  // launched with exactly this value. Values of more than 8 bytes
+  // are not supported.
+  void set_specialized_argument(std::size_t param_index, const void *data,
+                                std::size_t data_size) {
+    specialized_argument arg{param_index, data, data_size};
+    for(std::size_t i = 0; i < _specialized_arguments.size(); ++i) {
+      if(_specialized_arguments[i].get_param_index() == param_index) {
+        _specialized_arguments[i] = arg;
+        return;
+      }
+    }
+    _specialized_arguments.push_back(arg);
+  }
+
   id_type generate_id() const {
     id_type result {};
 
@@ -124,6 +172,18 @@ public:
       result[entry_hash % result.size()] ^= entry_hash;
     }
 
+    for(const auto& arg : _specialized_arguments) {
+      common::stable_running_hash h;
+      std::size_t param_index = arg.get_param_index();
+      h("specialized-argument", sizeof("specialized-argument"));
+      h(&param_index, sizeof(param_index));
+      h(arg.get_data_buffer(), arg.get_data_size());
+
+      auto entry_hash = h.get_current_hash();
+
+      result[entry_hash % result.size()] ^= entry_hash;
+    }
+
     return result;
   }
 
@@ -131,7 +191,12 @@ public:
     return _configurations;
   }
 
+  const std::vector<specialized_argument>& specialized_arguments() const {
+    return _specialized_arguments;
+  }
+
   std::vector<configuration_entry> _configurations;
+  std::vector<specialized_argument> _specialized_arguments;
 };
 
 }
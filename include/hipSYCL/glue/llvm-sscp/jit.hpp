@@ -35,6 +35,7 @@
 #include "hipSYCL/compiler/llvm-to-backend/LLVMToBackend.hpp"
 #include "hipSYCL/runtime/error.hpp"
 #include "hipSYCL/runtime/kernel_cache.hpp"
+#include "hipSYCL/runtime/persistent_kernel_cache.hpp"
 #include "hipSYCL/glue/kernel_configuration.hpp"
 #include "hipSYCL/runtime/application.hpp"
 #include <cstddef>
@@ -42,6 +43,7 @@
 #include <atomic>
 #include <fstream>
 #include <string>
+#include <string_view>
 
 namespace hipsycl {
 namespace glue {
@@ -129,6 +131,30 @@ std::string select_image(const rt::hcf_kernel_info* kernel_info,
   return image_name;
 }
 
+// Selects the image that kernel_name is compiled from, as well as the
+// kernels from this image that are compiled together with it.
+template <class ImageSelector = default_llvm_image_selector>
+std::string select_image_and_kernels(const rt::hcf_kernel_info *kernel_info,
+                                     const std::string &kernel_name,
+                                     const kernel_configuration &config,
+                                     std::vector<std::string> &kernels_out,
+                                     const ImageSelector &sel = ImageSelector{}) {
+  // Compiling each kernel on its own when it is first needed avoids
+  // compiling kernels that are never launched, and allows independent
+  // kernels to be compiled in parallel. Variants specialized for argument
+  // values always only contain the kernel that they were specialized for.
+  bool compile_single_kernel =
+      !config.specialized_arguments().empty() ||
+      rt::application::get_settings()
+          .get<rt::setting::sscp_jit_per_kernel_compilation>();
+
+  std::string image_name = select_image(
+      kernel_info, compile_single_kernel ? nullptr : &kernels_out, sel);
+  if(compile_single_kernel)
+    kernels_out = {kernel_name};
+  return image_name;
+}
+
 using symbol_list_t = compiler::LLVMToBackendTranslator::SymbolListType;
 
 class runtime_linker {
@@ -182,7 +208,7 @@ private:
     return ir_modules_to_link;
   }
 
-  std::string retrieve_bitcode(llvm_module_id id, symbol_list_t& imported_symbols) const {
+  std::string_view retrieve_bitcode(llvm_module_id id, symbol_list_t& imported_symbols) const {
 
     const auto* hcf_image_node = reinterpret_cast<common::hcf_container::node*>(id);
 
@@ -196,7 +222,9 @@ private:
     rt::hcf_object_id hcf_id = v->second;
     imported_symbols = hcf_image_node->get_as_list("imported-symbols");
 
-    std::string bitcode;
+    // The HCF object remains registered during compilation, so we can
+    // refer to the bitcode in place.
+    std::string_view bitcode;
     rt::hcf_cache::get().get_hcf(hcf_id)->get_binary_attachment(hcf_image_node, bitcode);
 
     return bitcode;
@@ -209,7 +237,7 @@ private:
 };
 
 inline rt::result compile(compiler::LLVMToBackendTranslator *translator,
-                          const std::string &source,
+                          std::string_view source,
                           const glue::kernel_configuration &config,
                           const symbol_list_t& imported_symbol_names,
                           std::string &output) {
@@ -224,6 +252,15 @@ inline rt::result compile(compiler::LLVMToBackendTranslator *translator,
   for(const auto& entry : config.entries()) {
     translator->setS2IRConstant(entry.get_name(), entry.get_data_buffer());
   }
+  // Specialized arguments are only used when compiling single kernels
+  if(translator->getOutliningEntrypoints().size() == 1) {
+    const std::string& kernel_name = translator->getOutliningEntrypoints()[0];
+    for(const auto& arg : config.specialized_arguments()) {
+      translator->specializeKernelArgument(kernel_name, arg.get_param_index(),
+                                           arg.get_data_buffer(),
+                                           arg.get_data_size());
+    }
+  }
 
   // Transform code
   if(!translator->fullTransformation(source, output)) {
@@ -257,6 +294,48 @@ inline rt::result compile(compiler::LLVMToBackendTranslator *translator,
 }
 
 
+// Generates the key under which the result of compiling the given HCF image
+// is stored in the persistent kernel cache.
+inline std::string
+generate_persistent_cache_key(compiler::LLVMToBackendTranslator *translator,
+                              const common::hcf_container *hcf,
+                              const std::string &image_name,
+                              const glue::kernel_configuration &config,
+                              const symbol_list_t &imported_symbol_names) {
+  rt::persistent_kernel_cache::key_builder key;
+
+  // HCF object ids are generated randomly by the compiler, so
+  // any recompilation of the application invalidates the entry.
+  const std::string* object_id = hcf->root_node()->get_value("object-id");
+  key(object_id ? *object_id : std::string{});
+  key(image_name);
+
+  key(translator->getBackendId());
+  for(const auto& kernel : translator->getOutliningEntrypoints())
+    key(kernel);
+  // This includes the target architecture
+  for(const auto& build_config_entry : translator->getBuildConfiguration())
+    key(build_config_entry);
+
+  auto config_id = config.generate_id();
+  key(config_id.data(), sizeof(config_id));
+
+  // Objects that we might link against at runtime are part of the result
+  // as well.
+  rt::hcf_cache::get().symbol_lookup(
+      imported_symbol_names,
+      [&](const std::string &symbol_name,
+          const rt::hcf_cache::symbol_resolver_list &images) {
+        key(symbol_name);
+        for(const auto& img : images) {
+          key(img.hcf_id);
+          key(img.image_node->node_id);
+        }
+      });
+
+  return key.get_key();
+}
+
 inline rt::result compile(compiler::LLVMToBackendTranslator* translator,
                           const common::hcf_container* hcf,
                           const std::string& image_name,
@@ -288,7 +367,21 @@ inline rt::result compile(compiler::LLVMToBackendTranslator* translator,
         rt::error_info{"jit::compile: Image " + image_name +
                        " was defined in HCF without data"});
   }
-  std::string source;
+
+  symbol_list_t imported_symbol_names =
+      target_image_node->get_as_list("imported-symbols");
+
+  rt::persistent_kernel_cache &persistent_cache =
+      rt::persistent_kernel_cache::get();
+  std::string persistent_cache_key;
+  if(persistent_cache.is_enabled()) {
+    persistent_cache_key = generate_persistent_cache_key(
+        translator, hcf, image_name, config, imported_symbol_names);
+    if(persistent_cache.retrieve(persistent_cache_key, output))
+      return rt::make_success();
+  }
+
+  std::string_view source;
   if(!hcf->get_binary_attachment(target_image_node, source)) {
     return rt::make_error(
         __hipsycl_here(),
@@ -297,10 +390,12 @@ inline rt::result compile(compiler::LLVMToBackendTranslator* translator,
             image_name});
   }
 
-  symbol_list_t imported_symbol_names =
-      target_image_node->get_as_list("imported-symbols");
+  auto err = compile(translator, source, config, imported_symbol_names, output);
+
+  if(err.is_success() && !persistent_cache_key.empty())
+    persistent_cache.store(persistent_cache_key, output);
 
-  return compile(translator, source, config, imported_symbol_names, output);
+  return err;
 }
 
 inline rt::result compile(compiler::LLVMToBackendTranslator* translator,
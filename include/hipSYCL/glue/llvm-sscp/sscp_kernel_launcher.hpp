@@ -84,8 +84,8 @@ namespace glue {
 
 namespace sscp {
 
-static std::string get_local_hcf_object() {
-  return std::string{
+static std::string_view get_local_hcf_object() {
+  return std::string_view{
       reinterpret_cast<const char *>(__hipsycl_local_sscp_hcf_content),
       __hipsycl_local_sscp_hcf_object_size};
 }
@@ -94,9 +94,11 @@ static std::string get_local_hcf_object() {
 // macro. We cannot use this macro directly because it expects
 // the object id to be constexpr, which it is not for the SSCP case.
 struct static_hcf_registration {
-  static_hcf_registration(const std::string& hcf_data) {
+  // hcf_data is embedded in the application, so device images
+  // do not need to be copied.
+  static_hcf_registration(std::string_view hcf_data) {
     this->_hcf_object = rt::hcf_cache::get().register_hcf_object(
-        common::hcf_container{hcf_data});
+        common::hcf_container::from_static_data(hcf_data));
   }
 
   ~static_hcf_registration() {
@@ -243,6 +245,29 @@ public:
             Kernel k, Reductions... reductions) {
 
     this->_type = type;
+    this->_local_mem_size = dynamic_local_memory;
+
+    // Remember which kernel will be launched, so that prepare() can request
+    // its code object before the kernel is invoked.
+    if constexpr(type == rt::kernel_type::single_task) {
+      _kernel_name_generator =
+          &get_kernel_name<__sscp_dispatch::single_task<Kernel>>;
+    } else if constexpr (type == rt::kernel_type::basic_parallel_for) {
+      if(offset == sycl::id<Dim>{})
+        _kernel_name_generator =
+            &get_kernel_name<__sscp_dispatch::basic_parallel_for<Kernel, Dim>>;
+      else
+        _kernel_name_generator = &get_kernel_name<
+            __sscp_dispatch::basic_parallel_for_offset<Kernel, Dim>>;
+    } else if constexpr (type == rt::kernel_type::ndrange_parallel_for) {
+      if(offset == sycl::id<Dim>{})
+        _kernel_name_generator = &get_kernel_name<
+            __sscp_dispatch::ndrange_parallel_for<Kernel, Dim>>;
+      else
+        _kernel_name_generator = &get_kernel_name<
+            __sscp_dispatch::ndrange_parallel_for_offset<Kernel, Dim>>;
+    }
+
     this->_invoker = [=] (rt::dag_node* node) mutable {
 
       static_cast<rt::kernel_operation *>(node->get_operation())
@@ -321,6 +346,18 @@ public:
     _invoker(node);
   }
 
+  virtual bool prepare(rt::dag_node *node,
+                       const kernel_configuration &config) final override {
+    auto sscp_invoker = this->get_launch_capabilities().get_sscp_invoker();
+    if(!sscp_invoker || !_kernel_name_generator)
+      return true;
+
+    return sscp_invoker.value()->prepare_kernel(
+        *static_cast<rt::kernel_operation *>(node->get_operation()),
+        __hipsycl_local_sscp_hcf_object_id, _kernel_name_generator(),
+        _local_mem_size, config);
+  }
+
   virtual rt::kernel_type get_kernel_type() const final override {
     return _type;
   }
@@ -415,6 +452,11 @@ private:
       __hipsycl_sscp_kernel(k);
     }
 
+    return get_kernel_name<Kernel>();
+  }
+
+  template<class Kernel>
+  static std::string get_kernel_name() {
     // Compiler will change the number of elements to the kernel name length
     static char __hipsycl_sscp_kernel_name [] = "kernel-name-extraction-failed";
 
@@ -427,6 +469,8 @@ private:
   std::function<void (rt::dag_node*)> _invoker;
   rt::kernel_type _type;
   const kernel_configuration* _configuration = nullptr;
+  std::string (*_kernel_name_generator)() = nullptr;
+  unsigned _local_mem_size = 0;
 };
 
 
@@ -30,12 +30,15 @@
 
 #include "hipSYCL/glue/kernel_configuration.hpp"
 #include <cassert>
+#include <memory>
 #include <tuple>
+#include <utility>
 #ifdef _OPENMP
 #include <omp.h>
 #endif
 
 #include "hipSYCL/common/debug.hpp"
+#include "hipSYCL/runtime/application.hpp"
 #include "hipSYCL/runtime/error.hpp"
 #include "hipSYCL/runtime/dag_node.hpp"
 #include "hipSYCL/runtime/hints.hpp"
@@ -60,12 +63,31 @@
 #include "../generic/host/collective_execution_engine.hpp"
 #include "../generic/host/iterate_range.hpp"
 #include "../generic/host/sequential_reducer.hpp"
+#include "../generic/host/work_stealing_scheduler.hpp"
 
 namespace hipsycl {
 namespace glue {
 namespace omp_dispatch {
 
+// If kernels are executed on the backend's thread pool instead of
+// in OpenMP parallel regions, this describes the current thread.
+struct thread_pool_state {
+  // Set on the thread that launches kernels
+  rt::host_thread_pool* pool = nullptr;
+  // Set on all threads while they execute a kernel
+  int thread_id = -1;
+  int num_threads = 1;
+};
+
+inline thread_local thread_pool_state current_thread_pool_state;
+
+inline bool is_thread_pool_thread() {
+  return current_thread_pool_state.thread_id >= 0;
+}
+
 inline int get_my_thread_id() {
+  if(is_thread_pool_thread())
+    return current_thread_pool_state.thread_id;
 #ifdef _OPENMP
   return omp_get_thread_num();
 #else
@@ -74,6 +96,8 @@ inline int get_my_thread_id() {
 }
 
 inline int get_max_num_threads() {
+  if(current_thread_pool_state.pool)
+    return current_thread_pool_state.pool->get_num_threads();
 #ifdef _OPENMP
   return omp_get_max_threads();
 #else
@@ -82,6 +106,8 @@ inline int get_max_num_threads() {
 }
 
 inline int get_num_threads() {
+  if(is_thread_pool_thread())
+    return current_thread_pool_state.num_threads;
 #ifdef _OPENMP
   return omp_get_num_threads();
 #else
@@ -89,6 +115,32 @@ inline int get_num_threads() {
 #endif
 }
 
+// Executes f on all threads, either on the thread pool of the
+// current queue or in an OpenMP parallel region.
+template<class Function>
+void parallel_invocation(Function f) noexcept {
+  if(rt::host_thread_pool* pool = current_thread_pool_state.pool) {
+    pool->run(
+        [](void *data, int thread_id, int num_threads) {
+          thread_pool_state previous_state = current_thread_pool_state;
+          current_thread_pool_state.thread_id = thread_id;
+          current_thread_pool_state.num_threads = num_threads;
+
+          (*static_cast<Function *>(data))();
+
+          current_thread_pool_state = previous_state;
+        },
+        &f);
+  } else {
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+      f();
+    }
+  }
+}
+
 template <class ReductionDescriptor> class omp_reducer {
 public:
   omp_reducer(host::sequential_reducer<ReductionDescriptor>& seq_reducer)
@@ -121,10 +173,8 @@ void reducible_parallel_invocation(Function kernel,
 
   auto sequential_reducers =
       std::make_tuple(host::sequential_reducer{max_threads, reductions}...);
-#ifdef _OPENMP
-#pragma omp parallel shared(sequential_reducers)
-#endif
-  {
+
+  parallel_invocation([&]() {
     auto make_omp_reducers = [&](auto &... seq_reducers) {
       return std::make_tuple(omp_reducer{seq_reducers}...);
     };
@@ -136,7 +186,7 @@ void reducible_parallel_invocation(Function kernel,
     auto sycl_reducers = std::apply(make_sycl_reducers, omp_reducers);
 
     std::apply(kernel, sycl_reducers);
-  }
+  });
 
   auto finalize_all = [&](auto &... seq_reducers) {
     (finalize_reduction(seq_reducers), ...);
@@ -147,6 +197,14 @@ void reducible_parallel_invocation(Function kernel,
 template <int Dim, class Function>
 void iterate_range_omp_for(sycl::range<Dim> r, Function f) noexcept {
 
+  if (is_thread_pool_thread()) {
+    // Same static schedule as omp for, without requiring
+    // an OpenMP parallel region
+    host::iterate_range_partition(r, get_my_thread_id(), get_num_threads(),
+                                  f);
+    return;
+  }
+
   if constexpr (Dim == 1) {
 #ifdef _OPENMP
     #pragma omp for
@@ -181,6 +239,13 @@ template <int Dim, class Function>
 void iterate_range_omp_for(sycl::id<Dim> offset, sycl::range<Dim> r,
                            Function f) noexcept {
 
+  if (is_thread_pool_thread()) {
+    host::iterate_range_partition(
+        r, get_my_thread_id(), get_num_threads(),
+        [&](sycl::id<Dim> idx) { f(idx + offset); });
+    return;
+  }
+
   const std::size_t min_i = offset.get(0);
   const std::size_t max_i = offset.get(0) + r.get(0);
 
@@ -220,37 +285,188 @@ void iterate_range_omp_for(sycl::id<Dim> offset, sycl::range<Dim> r,
   }
 }
 
+// Returns nullptr if the range should be iterated using
+// a static schedule
+template <int Dim>
+std::unique_ptr<host::work_stealing_range_scheduler<Dim>>
+make_range_scheduler(rt::omp_schedule_type schedule, sycl::range<Dim> r) {
+  if(schedule == rt::omp_schedule_type::work_stealing)
+    return std::make_unique<host::work_stealing_range_scheduler<Dim>>(
+        r, get_max_num_threads());
+  return nullptr;
+}
+
+// Must be called from within an OpenMP parallel region. If a
+// work stealing scheduler is provided, it must have been constructed
+// for the range r.
+template <int Dim, class Function>
+void iterate_range_omp(sycl::range<Dim> r,
+                       host::work_stealing_range_scheduler<Dim> *scheduler,
+                       Function f) noexcept {
+  if(scheduler)
+    scheduler->run(get_my_thread_id(), f);
+  else
+    iterate_range_omp_for(r, f);
+}
+
+template <int Dim, class Function>
+void iterate_range_omp(sycl::id<Dim> offset, sycl::range<Dim> r,
+                       host::work_stealing_range_scheduler<Dim> *scheduler,
+                       Function f) noexcept {
+  if(scheduler)
+    scheduler->run(get_my_thread_id(),
+                   [&](sycl::id<Dim> idx) { f(idx + offset); });
+  else
+    iterate_range_omp_for(offset, r, f);
+}
+
 #ifdef __HIPSYCL_USE_ACCELERATED_CPU__
 extern "C" size_t __hipsycl_local_id_x;
 extern "C" size_t __hipsycl_local_id_y;
 extern "C" size_t __hipsycl_local_id_z;
 
-template <int Dim, class Function, class ...Reducers>
+// Work group sizes for which nd_range kernels are additionally compiled with
+// the local size as compile-time constant. The CBS pipeline then emits the
+// work item loops with constant trip counts and statically sized arrays for
+// values that live across barriers, which allows the loops to be vectorized
+// and unrolled. 2D and 3D shapes are given as consecutive 2 or 3 sizes,
+// in the order of the dimensions of sycl::range. Each entry adds one kernel
+// version: with the defaults, 1D nd_range kernels are compiled 4 times and
+// 2D ones 3 times, which increases compile time and binary size accordingly.
+// Define a list as empty to avoid compiling the additional kernel versions.
+#ifndef HIPSYCL_CBS_LOCAL_SIZE_SPECIALIZATIONS_1D
+#define HIPSYCL_CBS_LOCAL_SIZE_SPECIALIZATIONS_1D 64, 128, 256
+#endif
+#ifndef HIPSYCL_CBS_LOCAL_SIZE_SPECIALIZATIONS_2D
+#define HIPSYCL_CBS_LOCAL_SIZE_SPECIALIZATIONS_2D 8, 8, 16, 16
+#endif
+#ifndef HIPSYCL_CBS_LOCAL_SIZE_SPECIALIZATIONS_3D
+#define HIPSYCL_CBS_LOCAL_SIZE_SPECIALIZATIONS_3D
+#endif
+
+template<int Dim> struct local_size_specializations {};
+
+// The first entry is a placeholder, so that the lists may be empty.
+template<> struct local_size_specializations<1> {
+  static constexpr std::size_t sizes[] = {
+      0, HIPSYCL_CBS_LOCAL_SIZE_SPECIALIZATIONS_1D};
+};
+
+template<> struct local_size_specializations<2> {
+  static constexpr std::size_t sizes[] = {
+      0, HIPSYCL_CBS_LOCAL_SIZE_SPECIALIZATIONS_2D};
+};
+
+template<> struct local_size_specializations<3> {
+  static constexpr std::size_t sizes[] = {
+      0, HIPSYCL_CBS_LOCAL_SIZE_SPECIALIZATIONS_3D};
+};
+
+template <int Dim>
+constexpr std::size_t get_num_local_size_specializations() {
+  constexpr std::size_t num_sizes =
+      sizeof(local_size_specializations<Dim>::sizes) / sizeof(std::size_t) - 1;
+  static_assert(num_sizes % Dim == 0,
+                "Local size specializations must consist of Dim sizes each");
+  return num_sizes / Dim;
+}
+
+// Returns the size in dimension dim of the i-th specialization, 0 if the
+// specialization has fewer dimensions.
+template <int Dim>
+constexpr std::size_t get_local_size_specialization(std::size_t i, int dim) {
+  if (dim >= Dim)
+    return 0;
+  return local_size_specializations<Dim>::sizes[1 + i * Dim + dim];
+}
+
+// Invokes f with the static local size, i.e. a
+// std::index_sequence<Size0, Size1, Size2>, of the specialization that
+// matches local_size. If there is none, the static local size is all zero.
+template <int Dim, std::size_t I = 0, class Function>
+void dispatch_local_size_specialization(const sycl::range<Dim> &local_size,
+                                        Function f) {
+  if constexpr (I == get_num_local_size_specializations<Dim>()) {
+    f(std::index_sequence<0, 0, 0>{});
+  } else {
+    constexpr std::size_t size0 = get_local_size_specialization<Dim>(I, 0);
+    constexpr std::size_t size1 = get_local_size_specialization<Dim>(I, 1);
+    constexpr std::size_t size2 = get_local_size_specialization<Dim>(I, 2);
+    static_assert(size0 > 0 && (Dim < 2 || size1 > 0) && (Dim < 3 || size2 > 0),
+                  "Local size specializations must not be zero");
+
+    bool matches = local_size[0] == size0;
+    if constexpr (Dim > 1)
+      matches = matches && local_size[1] == size1;
+    if constexpr (Dim > 2)
+      matches = matches && local_size[2] == size2;
+
+    if (matches)
+      f(std::index_sequence<size0, size1, size2>{});
+    else
+      dispatch_local_size_specialization<Dim, I + 1>(local_size, f);
+  }
+}
+
+// StaticLocalSize0-2 are either 0, or the local size that the kernel is
+// launched with. The CBS pipeline reads them from the mangled name of the
+// function and uses them instead of local_size.
+template <int Dim, std::size_t StaticLocalSize0, std::size_t StaticLocalSize1,
+          std::size_t StaticLocalSize2, class Function, class... Reducers>
 HIPSYCL_LOOP_SPLIT_ND_KERNEL __attribute__((noinline))
 inline void iterate_nd_range_omp(Function f, const sycl::id<Dim> &&group_id, const sycl::range<Dim> num_groups,
   HIPSYCL_LOOP_SPLIT_ND_KERNEL_LOCAL_SIZE_ARG const sycl::range<Dim> local_size, const sycl::id<Dim> offset,
   size_t num_local_mem_bytes, void* group_shared_memory_ptr,
-  std::function<void()> &barrier_impl,
+  std::function<void()> &barrier_impl, std::size_t sub_group_size,
   Reducers& ... reducers) noexcept {
+  sycl::range<Dim> item_local_size = local_size;
+  if constexpr (StaticLocalSize0 > 0) {
+    if constexpr (Dim == 1)
+      item_local_size = sycl::range<Dim>{StaticLocalSize0};
+    else if constexpr (Dim == 2)
+      item_local_size = sycl::range<Dim>{StaticLocalSize0, StaticLocalSize1};
+    else
+      item_local_size = sycl::range<Dim>{StaticLocalSize0, StaticLocalSize1,
+                                         StaticLocalSize2};
+  }
+
   if constexpr (Dim == 1) {
     sycl::id<Dim> local_id{__hipsycl_local_id_x};
     sycl::nd_item<Dim> this_item{&offset,    group_id,   local_id,
-      local_size, num_groups, &barrier_impl, group_shared_memory_ptr};
+      item_local_size, num_groups, &barrier_impl, group_shared_memory_ptr,
+      static_cast<sycl::sub_group::linear_range_type>(sub_group_size)};
     f(this_item, reducers...);
   } else if constexpr (Dim == 2) {
     sycl::id<Dim> local_id{__hipsycl_local_id_x, __hipsycl_local_id_y};
     sycl::nd_item<Dim> this_item{&offset, group_id,
-      local_id, local_size, num_groups,
-      &barrier_impl, group_shared_memory_ptr};
+      local_id, item_local_size, num_groups,
+      &barrier_impl, group_shared_memory_ptr,
+      static_cast<sycl::sub_group::linear_range_type>(sub_group_size)};
     f(this_item, reducers...);
   } else if constexpr (Dim == 3) {
     sycl::id<Dim> local_id{__hipsycl_local_id_x, __hipsycl_local_id_y, __hipsycl_local_id_z};
     sycl::nd_item<Dim> this_item{&offset,    group_id,
-      local_id,   local_size,
-      num_groups, &barrier_impl, group_shared_memory_ptr};
+      local_id,   item_local_size,
+      num_groups, &barrier_impl, group_shared_memory_ptr,
+      static_cast<sycl::sub_group::linear_range_type>(sub_group_size)};
     f(this_item, reducers...);
   }
 }
+
+template <int Dim, std::size_t... StaticLocalSize, class Function,
+          class... Reducers>
+inline void run_specialized_nd_range_omp(
+    std::index_sequence<StaticLocalSize...>, const Function &f,
+    sycl::id<Dim> &&group_id, const sycl::range<Dim> num_groups,
+    const sycl::range<Dim> local_size, const sycl::id<Dim> offset,
+    size_t num_local_mem_bytes, void *group_shared_memory_ptr,
+    std::function<void()> &barrier_impl, std::size_t sub_group_size,
+    Reducers &...reducers) noexcept {
+  iterate_nd_range_omp<Dim, StaticLocalSize...>(
+      f, std::move(group_id), num_groups, local_size, offset,
+      num_local_mem_bytes, group_shared_memory_ptr, barrier_impl,
+      sub_group_size, reducers...);
+}
 #endif
 
 template<class Function>
@@ -263,12 +479,15 @@ void single_task_kernel(Function f) noexcept
 template <int Dim, class Function, typename... Reductions>
 inline void parallel_for_kernel(Function f,
                                 const sycl::range<Dim> execution_range,
+                                rt::omp_schedule_type schedule,
                                 Reductions... reductions) noexcept
 {
   static_assert(Dim > 0 && Dim <= 3, "Only dimensions 1,2,3 are supported");
 
+  auto scheduler = make_range_scheduler(schedule, execution_range);
+
   reducible_parallel_invocation([&, f](auto& ... reducers){
-    iterate_range_omp_for(execution_range, [&](sycl::id<Dim> idx) {
+    iterate_range_omp(execution_range, scheduler.get(), [&](sycl::id<Dim> idx) {
       auto this_item =
         sycl::detail::make_item<Dim>(idx, execution_range);
 
@@ -281,11 +500,15 @@ template <int Dim, class Function, typename... Reductions>
 inline void parallel_for_kernel_offset(Function f,
                                        const sycl::range<Dim> execution_range,
                                        const sycl::id<Dim> offset,
+                                       rt::omp_schedule_type schedule,
                                        Reductions... reductions) noexcept {
   static_assert(Dim > 0 && Dim <= 3, "Only dimensions 1,2,3 are supported");
 
+  auto scheduler = make_range_scheduler(schedule, execution_range);
+
   reducible_parallel_invocation([&, f](auto& ... reducers){
-    iterate_range_omp_for(offset, execution_range, [&](sycl::id<Dim> idx) {
+    iterate_range_omp(offset, execution_range, scheduler.get(),
+                      [&](sycl::id<Dim> idx) {
       auto this_item =
         sycl::detail::make_item<Dim>(idx, execution_range, offset);
 
@@ -298,38 +521,59 @@ template <int Dim, class Function, typename... Reductions>
 inline void parallel_for_ndrange_kernel(
     Function f, const sycl::range<Dim> num_groups,
     const sycl::range<Dim> local_size, const sycl::id<Dim> offset,
-    size_t num_local_mem_bytes, Reductions... reductions) noexcept
+    size_t num_local_mem_bytes, std::size_t sub_group_size,
+    bool use_local_size_specializations, rt::omp_schedule_type schedule,
+    Reductions... reductions) noexcept
 {
   static_assert(Dim > 0 && Dim <= 3, "Only dimensions 1 - 3 are supported.");
 
+#ifdef __HIPSYCL_USE_ACCELERATED_CPU__
+  auto scheduler = make_range_scheduler(schedule, num_groups);
+#endif
+
   reducible_parallel_invocation([&, f](auto& ... reducers){
     if(num_groups.size() == 0 || local_size.size() == 0)
       return;
 
     sycl::detail::host_local_memory::request_from_threadprivate_pool(
-        num_local_mem_bytes);
-
-    // 128 kiB as local memory for group algorithms
-    std::aligned_storage_t<128*1024, sizeof(double) * 16> group_shared_memory_ptr{};
+        num_local_mem_bytes,
+        sycl::detail::host_local_memory::get_group_scratch_size(
+            local_size.size()));
+    void *group_scratch =
+        sycl::detail::host_local_memory::get_group_scratch_ptr();
 #ifdef __HIPSYCL_USE_ACCELERATED_CPU__
     std::function<void()> barrier_impl = [] () noexcept {
       assert(false && "splitting seems to have failed");
       std::terminate();
     };
 
-    iterate_range_omp_for(num_groups, [&](sycl::id<Dim> &&group_id) {
-      iterate_nd_range_omp(f, std::move(group_id), num_groups, local_size, offset,
-        num_local_mem_bytes, &group_shared_memory_ptr, barrier_impl, reducers...);
-    });
+    auto run_groups = [&](auto static_local_size) {
+      iterate_range_omp(num_groups, scheduler.get(), [&](sycl::id<Dim> &&group_id) {
+        run_specialized_nd_range_omp(static_local_size, f, std::move(group_id),
+          num_groups, local_size, offset, num_local_mem_bytes,
+          group_scratch, barrier_impl, sub_group_size, reducers...);
+      });
+    };
+
+    if(use_local_size_specializations)
+      dispatch_local_size_specialization(local_size, run_groups);
+    else
+      run_groups(std::index_sequence<0, 0, 0>{});
 #elif defined(HIPSYCL_HAS_FIBERS)
+    // Fibers of a group replay the group sequence of the master fiber,
+    // so groups cannot be assigned dynamically here.
     host::static_range_decomposition<Dim> group_decomposition{
         num_groups, get_num_threads()};
 
-    host::collective_execution_engine<Dim> engine{num_groups, local_size,
-                                                  offset, group_decomposition,
-                                                  get_my_thread_id()};
+    host::collective_execution_engine<Dim> engine{
+        num_groups,          local_size,         offset,
+        group_decomposition, get_my_thread_id(), sub_group_size};
 
     std::function<void()> barrier_impl = [&]() { engine.barrier(); };
+    std::function<void(std::size_t)> sub_group_barrier_impl =
+        [&](std::size_t local_linear_id) {
+          engine.sub_group_barrier(local_linear_id);
+        };
 
     engine.run_kernel([&](sycl::id<Dim> local_id, sycl::id<Dim> group_id) {
 
@@ -342,7 +586,10 @@ inline void parallel_for_ndrange_kernel(
                                     local_size,
                                     num_groups,
                                     &barrier_impl,
-                                    &group_shared_memory_ptr};
+                                    group_scratch,
+                                    static_cast<sycl::sub_group::linear_range_type>(
+                                        sub_group_size),
+                                    &sub_group_barrier_impl};
 
       f(this_item, reducers...);
     });
@@ -358,17 +605,21 @@ inline void parallel_for_workgroup(Function f,
                                    const sycl::range<Dim> num_groups,
                                    const sycl::range<Dim> local_size,
                                    size_t num_local_mem_bytes,
+                                   rt::omp_schedule_type schedule,
                                    Reductions... reductions) noexcept
 {
   static_assert(Dim > 0 && Dim <= 3, "Only dimensions 1,2,3 are supported");
 
+  auto scheduler = make_range_scheduler(schedule, num_groups);
+
   reducible_parallel_invocation(
       [&, f, num_groups, local_size](auto &... reducers) {
 
         sycl::detail::host_local_memory::request_from_threadprivate_pool(
             num_local_mem_bytes);
 
-        iterate_range_omp_for(num_groups, [&, f](sycl::id<Dim> group_id) {
+        iterate_range_omp(num_groups, scheduler.get(),
+                          [&, f](sycl::id<Dim> group_id) {
           sycl::group<Dim> this_group{group_id, local_size, num_groups};
 
           f(this_group, reducers...);
@@ -385,18 +636,22 @@ inline void parallel_region(Function f,
                             const sycl::range<dimensions> num_groups,
                             const sycl::range<dimensions> group_size,
                             std::size_t num_local_mem_bytes,
+                            rt::omp_schedule_type schedule,
                             Reductions... reductions)
 {
   static_assert(dimensions > 0 && dimensions <= 3,
                 "Only dimensions 1,2,3 are supported");
 
+  auto scheduler = make_range_scheduler(schedule, num_groups);
+
   reducible_parallel_invocation(
       [&, f, num_groups, group_size](auto &... reducers) {
 
         sycl::detail::host_local_memory::request_from_threadprivate_pool(
             num_local_mem_bytes);
 
-        iterate_range_omp_for(num_groups, [&](sycl::id<dimensions> group_id) {
+        iterate_range_omp(num_groups, scheduler.get(),
+                          [&](sycl::id<dimensions> group_id) {
 
           using group_properties =
               sycl::detail::sp_property_descriptor<dimensions, 0,
@@ -467,7 +722,9 @@ public:
   omp_kernel_launcher() {}
   virtual ~omp_kernel_launcher(){}
 
-  virtual void set_params(void*) override {}
+  virtual void set_params(void* q) override {
+    _queue = static_cast<rt::omp_queue*>(q);
+  }
 
   template <class KernelNameTraits, rt::kernel_type type, int Dim, class Kernel,
             typename... Reductions>
@@ -502,6 +759,17 @@ public:
       static_cast<rt::kernel_operation *>(node->get_operation())
           ->initialize_embedded_pointers(k, reductions...);
 
+      omp_dispatch::thread_pool_state previous_thread_pool_state =
+          omp_dispatch::current_thread_pool_state;
+      omp_dispatch::current_thread_pool_state.pool =
+          _queue ? _queue->get_thread_pool() : nullptr;
+
+      rt::omp_schedule_type schedule =
+          rt::application::get_settings().get<rt::setting::omp_schedule>();
+      if (const auto *schedule_hint =
+              node->get_execution_hints().get_hint<rt::hints::omp_schedule>())
+        schedule = schedule_hint->get_schedule();
+
       bool is_with_offset = false;
       for (std::size_t i = 0; i < Dim; ++i)
         if (offset[i] != 0)
@@ -526,21 +794,27 @@ public:
       } else if constexpr (type == rt::kernel_type::basic_parallel_for) {
 
         if(!is_with_offset) {
-          omp_dispatch::parallel_for_kernel(k, global_range, reductions...);
+          omp_dispatch::parallel_for_kernel(k, global_range, schedule,
+                                            reductions...);
         } else {
-          omp_dispatch::parallel_for_kernel_offset(k, global_range, offset, reductions...);
+          omp_dispatch::parallel_for_kernel_offset(k, global_range, offset,
+                                                   schedule, reductions...);
         }
 
       } else if constexpr (type == rt::kernel_type::ndrange_parallel_for) {
 
         omp_dispatch::parallel_for_ndrange_kernel(
             k, get_grid_range(), local_range, offset, dynamic_local_memory,
-            reductions...);
+            _queue ? _queue->get_sub_group_size() : 1,
+            rt::application::get_settings()
+                .get<rt::setting::omp_local_size_specialization>(),
+            schedule, reductions...);
 
       } else if constexpr (type == rt::kernel_type::hierarchical_parallel_for) {
 
         omp_dispatch::parallel_for_workgroup(k, get_grid_range(), local_range,
-                                             dynamic_local_memory, reductions...);
+                                             dynamic_local_memory, schedule,
+                                             reductions...);
       } else if constexpr( type == rt::kernel_type::scoped_parallel_for) {
 
         auto local_range_is_divisible_by = [&](int x) -> bool {
@@ -558,7 +832,7 @@ public:
 
           omp_dispatch::parallel_region<decomposition_type>(
               k, get_grid_range(), local_range, dynamic_local_memory,
-              reductions...);
+              schedule, reductions...);
         } else if(local_range_is_divisible_by(32)) {
           using decomposition_type =
               decltype(omp_dispatch::determine_hierarchical_decomposition<
@@ -566,7 +840,7 @@ public:
 
           omp_dispatch::parallel_region<decomposition_type>(
               k, get_grid_range(), local_range, dynamic_local_memory,
-              reductions...);
+              schedule, reductions...);
         } else if(local_range_is_divisible_by(16)) {
           using decomposition_type =
               decltype(omp_dispatch::determine_hierarchical_decomposition<
@@ -574,7 +848,7 @@ public:
 
           omp_dispatch::parallel_region<decomposition_type>(
               k, get_grid_range(), local_range, dynamic_local_memory,
-              reductions...);
+              schedule, reductions...);
         } else if(local_range_is_divisible_by(8)) {
           using decomposition_type =
               decltype(omp_dispatch::determine_hierarchical_decomposition<Dim,
@@ -582,7 +856,7 @@ public:
 
           omp_dispatch::parallel_region<decomposition_type>(
               k, get_grid_range(), local_range, dynamic_local_memory,
-              reductions...);
+              schedule, reductions...);
         } else {
           using decomposition_type =
               decltype(omp_dispatch::determine_hierarchical_decomposition<Dim,
@@ -590,13 +864,15 @@ public:
 
           omp_dispatch::parallel_region<decomposition_type>(
               k, get_grid_range(), local_range, dynamic_local_memory,
-              reductions...);
+              schedule, reductions...);
         }
       } else if constexpr (type == rt::kernel_type::custom) {
         sycl::interop_handle handle{
-            rt::device_id{rt::backend_descriptor{rt::hardware_platform::cpu,
-                                                 rt::api_platform::omp},
-                          0},
+            _queue ? _queue->get_device()
+                   : rt::device_id{rt::backend_descriptor{
+                                       rt::hardware_platform::cpu,
+                                       rt::api_platform::omp},
+                                   0},
             static_cast<void*>(nullptr)};
 
         k(handle);
@@ -605,6 +881,7 @@ public:
         assert(false && "Unsupported kernel type");
       }
 
+      omp_dispatch::current_thread_pool_state = previous_thread_pool_state;
     };
   }
 
@@ -625,6 +902,7 @@ private:
 
   std::function<void (rt::dag_node*)> _invoker;
   rt::kernel_type _type;
+  rt::omp_queue* _queue = nullptr;
 };
 
 }
@@ -0,0 +1,134 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HIPSYCL_BATCH_COMPLETION_EVENT_HPP
+#define HIPSYCL_BATCH_COMPLETION_EVENT_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+#include "hipSYCL/runtime/event.hpp"
+#include "inorder_queue_event.hpp"
+#include "inorder_queue.hpp"
+
+namespace hipsycl {
+namespace rt {
+
+class batch_completion_event_base {
+public:
+  /// Inserts the backend event into the queue. All operations that
+  /// share this event must have been submitted at this point;
+  /// operations submitted afterwards are not covered by the event.
+  ///
+  /// May be invoked from any thread, e.g. when the event is queried.
+  virtual void resolve() = 0;
+  virtual bool is_resolved() const = 0;
+  /// Returns a lock that prevents the event from being resolved while
+  /// it is held, or a lock that does not own the mutex if the event has
+  /// already been resolved. Operations that are submitted to the queue
+  /// while holding the lock are covered by the event.
+  virtual std::unique_lock<std::mutex> lock_unresolved() = 0;
+
+  virtual ~batch_completion_event_base() {}
+};
+
+/// An event that is shared by multiple consecutive operations in an inorder
+/// queue. Instead of inserting a backend event after each operation, a single
+/// backend event is inserted once the last operation of the batch
+/// has been submitted.
+///
+/// Until then, the event is not complete, and waiting on it blocks
+/// until it has been resolved.
+template <class FineGrainedBackendEventT>
+class batch_completion_event
+    : public inorder_queue_event<FineGrainedBackendEventT>,
+      public batch_completion_event_base {
+public:
+  batch_completion_event(inorder_queue* q)
+  : _q{q}, _is_resolved{false} {}
+
+  virtual ~batch_completion_event(){}
+
+  virtual bool is_complete() const override {
+    if(!_is_resolved)
+      return false;
+    return _fine_grained_event->is_complete();
+  }
+
+  virtual void wait() override {
+    if(!_is_resolved) {
+      std::unique_lock<std::mutex> lock{_mutex};
+      _resolved_cv.wait(lock, [this]() { return _is_resolved.load(); });
+    }
+    _fine_grained_event->wait();
+  }
+
+  virtual FineGrainedBackendEventT request_backend_event() override {
+    resolve();
+    return static_cast<inorder_queue_event<FineGrainedBackendEventT> *>(
+               _fine_grained_event.get())
+        ->request_backend_event();
+  }
+
+  virtual void resolve() override {
+    if(_is_resolved)
+      return;
+
+    {
+      std::lock_guard<std::mutex> lock{_mutex};
+      // Another thread might have resolved the event in the meantime
+      if(_is_resolved)
+        return;
+      _fine_grained_event = _q->insert_event();
+      _is_resolved = true;
+    }
+    _resolved_cv.notify_all();
+  }
+
+  virtual bool is_resolved() const override {
+    return _is_resolved;
+  }
+
+  virtual std::unique_lock<std::mutex> lock_unresolved() override {
+    std::unique_lock<std::mutex> lock{_mutex};
+    if(_is_resolved)
+      lock.unlock();
+    return lock;
+  }
+private:
+  inorder_queue* _q;
+  std::atomic<bool> _is_resolved;
+  std::shared_ptr<dag_node_event> _fine_grained_event;
+  std::mutex _mutex;
+  std::condition_variable _resolved_cv;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,181 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HIPSYCL_RT_CACHING_ALLOCATOR_HPP
+#define HIPSYCL_RT_CACHING_ALLOCATOR_HPP
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "allocator.hpp"
+#include "device_id.hpp"
+#include "event.hpp"
+
+namespace hipsycl {
+namespace rt {
+
+struct caching_allocator_statistics {
+  // Size of all blocks currently in use, rounded up to their size class
+  std::size_t allocated_bytes = 0;
+  // Size that was actually requested for all blocks currently in use
+  std::size_t requested_bytes = 0;
+  std::size_t peak_allocated_bytes = 0;
+  // Size of all blocks that are retained for reuse
+  std::size_t cached_bytes = 0;
+  std::size_t num_hits = 0;
+  std::size_t num_misses = 0;
+  std::size_t num_trims = 0;
+
+  // Fraction of allocated memory that is wasted due to rounding
+  // to size classes
+  double get_fragmentation() const {
+    if(allocated_bytes == 0)
+      return 0.0;
+    return 1.0 - static_cast<double>(requested_bytes) / allocated_bytes;
+  }
+};
+
+/// Pooling allocator that sits in front of a backend_allocator.
+///
+/// Requests are rounded up to power-of-two size classes. Freed blocks are
+/// not returned to the backend, but kept in free lists (one per size class
+/// and kind of memory) from where they can serve later requests.
+///
+/// Like freeing memory with the driver, freeing a block must not invalidate
+/// operations that still use it. Blocks released with \c free() are therefore
+/// only reused once all operations that were submitted to the device before
+/// have completed. Blocks released with \c free_after() are only reused
+/// once the given event has completed.
+///
+/// The total size of retained blocks is bounded; if it is exceeded, or the
+/// backend fails to serve an allocation, cached blocks are released to the
+/// backend again (trimming).
+///
+/// Requests larger than the largest size class bypass the pool.
+/// One caching_allocator should be used per device. This class is thread-safe.
+class caching_allocator : public backend_allocator
+{
+public:
+  static constexpr int min_size_class = 9;  // 512 bytes
+  static constexpr int max_size_class = 30; // 1 GiB
+
+  caching_allocator(backend_allocator *underlying, device_id dev,
+                    std::size_t max_cached_bytes);
+  virtual ~caching_allocator();
+
+  /// Returns a caching_allocator wrapping underlying if allocation
+  /// pooling was enabled in the runtime settings, nullptr otherwise.
+  static std::unique_ptr<caching_allocator>
+  create_if_enabled(backend_allocator *underlying, device_id dev);
+
+  virtual void *allocate(size_t min_alignment, size_t size_bytes) override;
+  virtual void *allocate_optimized_host(size_t min_alignment,
+                                        size_t bytes) override;
+  virtual void free(void *mem) override;
+  virtual void *allocate_usm(size_t bytes) override;
+
+  virtual bool is_usm_accessible_from(backend_descriptor b) const override;
+  virtual result query_pointer(const void *ptr,
+                               pointer_info &out) const override;
+  virtual result mem_advise(const void *addr, std::size_t num_bytes,
+                            int advise) const override;
+
+  /// Returns mem to the pool, but does not hand it out again
+  /// before reuse_after has completed.
+  void free_after(void *mem, std::shared_ptr<dag_node_event> reuse_after);
+
+  /// Releases all retained blocks that can be released to the backend.
+  void trim();
+
+  caching_allocator_statistics get_statistics() const;
+
+  backend_allocator *get_underlying_allocator() const {
+    return _underlying;
+  }
+
+private:
+  enum class memory_kind : int {
+    device = 0,
+    optimized_host = 1,
+    usm = 2
+  };
+  static constexpr int num_memory_kinds = 3;
+  static constexpr int num_size_classes = max_size_class - min_size_class + 1;
+
+  struct live_block_info {
+    memory_kind kind;
+    int size_class;
+    std::size_t requested_size;
+  };
+
+  struct pending_block {
+    void *ptr;
+    memory_kind kind;
+    int size_class;
+    std::shared_ptr<dag_node_event> reuse_after;
+  };
+
+  void *allocate_block(memory_kind kind, std::size_t min_alignment,
+                       std::size_t size);
+  void *allocate_from_backend(memory_kind kind, std::size_t min_alignment,
+                              std::size_t size);
+  // The following functions assume that _mutex is locked
+  bool release_to_pool(void *mem,
+                       const std::shared_ptr<dag_node_event> &reuse_after);
+  void reclaim_completed_blocks();
+  void trim_to(std::size_t max_cached_bytes);
+
+  static int get_size_class(std::size_t size);
+  static std::size_t get_size_class_bytes(int size_class);
+
+  std::vector<void *> &get_free_list(memory_kind kind, int size_class) {
+    return _free_lists[static_cast<int>(kind)][size_class - min_size_class];
+  }
+
+  backend_allocator *_underlying;
+  device_id _dev;
+  std::size_t _max_cached_bytes;
+
+  std::array<std::array<std::vector<void *>, num_size_classes>,
+             num_memory_kinds>
+      _free_lists;
+  // Blocks that have been released, but may still be in use
+  std::vector<pending_block> _pending_blocks;
+  std::unordered_map<void *, live_block_info> _live_blocks;
+
+  caching_allocator_statistics _stats;
+  mutable std::mutex _mutex;
+};
+
+}
+}
+
+#endif
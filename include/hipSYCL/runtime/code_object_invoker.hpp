@@ -61,6 +61,16 @@ public:
                                std::size_t *arg_sizes, std::size_t num_args,
                                const std::string &kernel_name,
                                const glue::kernel_configuration& config) = 0;
+  // Starts constructing the code object for the kernel in the background
+  // if it is not yet available. Returns true if submit_kernel() can
+  // launch the kernel without waiting for the code object.
+  virtual bool prepare_kernel(const kernel_operation &op,
+                              hcf_object_id hcf_object,
+                              const std::string &kernel_name,
+                              unsigned local_mem_size,
+                              const glue::kernel_configuration &config) {
+    return true;
+  }
   virtual ~sscp_code_object_invoker(){}
 };
 
@@ -33,6 +33,7 @@
 #include <memory>
 
 #include "../hardware.hpp"
+#include "../caching_allocator.hpp"
 
 struct cudaDeviceProp;
 
@@ -72,13 +73,14 @@ public:
 
   virtual ~cuda_hardware_context();
 
-  cuda_allocator* get_allocator() const;
+  backend_allocator* get_allocator() const;
   cuda_event_pool* get_event_pool() const;
 
   unsigned get_compute_capability() const;
 private:
   std::unique_ptr<cudaDeviceProp> _properties;
   std::unique_ptr<cuda_allocator> _allocator;
+  std::unique_ptr<caching_allocator> _caching_allocator;
   std::unique_ptr<cuda_event_pool> _event_pool;
   int _dev;
 };
@@ -48,6 +48,13 @@ private:
   runtime* _rt;
 };
 
+/// Starts preparations for the submission of a node that is bound to
+/// a device, e.g. JIT compilation of its kernel, without waiting for them.
+/// \return whether the node can be submitted without blocking on
+/// preparations that are still running. Nodes that are not bound to
+/// a device are always reported as ready.
+bool prepare_for_submission(runtime* rt, const dag_node_ptr& node);
+
 }
 }
 
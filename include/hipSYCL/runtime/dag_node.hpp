@@ -30,6 +30,7 @@
 
 #include <memory>
 #include <atomic>
+#include <cstdint>
 
 #include "hints.hpp"
 #include "event.hpp"
@@ -131,6 +132,10 @@ public:
   }
 
   runtime* get_runtime() const;
+
+  /// \return A unique id of the node if runtime tracing is enabled,
+  /// 0 otherwise.
+  std::uint64_t get_node_id() const;
 private:
   execution_hints _hints;
   weak_node_list_t _requirements;
@@ -154,7 +159,7 @@ private:
   std::atomic<bool> _is_cancelled;
 
   runtime* _rt;
-
+  std::uint64_t _node_id;
 };
 
 }
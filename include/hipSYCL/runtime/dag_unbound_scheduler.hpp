@@ -29,21 +29,45 @@
 #ifndef HIPSYCL_DAG_UNBOUND_SCHEDULER_HPP
 #define HIPSYCL_DAG_UNBOUND_SCHEDULER_HPP
 
+#include <vector>
+
 #include "dag_node.hpp"
 #include "dag_direct_scheduler.hpp"
+#include "hw_model/cost.hpp"
 
 namespace hipsycl {
 namespace rt {
 
 class runtime;
 
+/// Assigns devices to DAG nodes that are not bound to a particular
+/// device, and then hands them to the direct scheduler.
+///
+/// Placement is driven by a cost model: For each eligible device,
+/// the scheduler estimates the cost of migrating all data accessed
+/// by the node to that device (based on the current validity state of
+/// the data regions and the memcpy hardware model), and adds a penalty
+/// for the number of operations that are still pending on the device,
+/// as reported by its executor.
+/// The device with the lowest cost is selected.
+///
+/// This class is not thread-safe; it is expected to be only used
+/// from the dag_manager worker thread.
 class dag_unbound_scheduler {
 public:
   dag_unbound_scheduler(runtime* rt);
 
   void submit(dag_node_ptr node);
 private:
+  device_id select_device(dag_node_ptr node,
+                          const std::vector<device_id> &eligible_devices);
+
+  cost_type estimate_migration_cost(dag_node_ptr node,
+                                    const device_id &dev) const;
+  std::size_t get_queue_depth(const device_id &dev) const;
+
   std::vector<device_id> _devices;
+  std::size_t _round_robin_counter;
   rt::dag_direct_scheduler _direct_scheduler;
   runtime* _rt;
 };
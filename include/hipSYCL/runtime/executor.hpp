@@ -59,6 +59,29 @@ public:
   virtual bool can_execute_on_device(const device_id& dev) const = 0;
   virtual bool is_submitted_by_me(dag_node_ptr node) const = 0;
 
+  /// Starts long-running preparations for the submission of an operation
+  /// to the given device, such as JIT compilation of kernels, without
+  /// waiting for them. Returns whether submit_directly() can submit the
+  /// operation without blocking on those preparations.
+  virtual bool prepare_operation(const device_id &dev, operation *op,
+                                 dag_node_ptr node) {
+    return true;
+  }
+
+  /// Invoked at the end of a submission_batch for all executors that
+  /// have registered with it. Operations submitted before must have events
+  /// that can complete without further submissions.
+  virtual void finalize_submission_batch() {}
+
+  /// Returns the number of operations that have been submitted to the
+  /// given device through this executor and are not yet known to have
+  /// completed. This is only an estimate of the device backlog: executors
+  /// may track a bounded number of operations only, in which case the
+  /// result saturates (see inorder_executor::max_tracked_pending_operations).
+  virtual std::size_t get_num_pending_operations(const device_id &dev) const {
+    return 0;
+  }
+
   virtual ~backend_executor(){}
 };
 
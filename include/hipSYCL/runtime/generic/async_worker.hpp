@@ -32,19 +32,97 @@
 #include <atomic>
 #include <condition_variable>
 #include <mutex>
-#include <functional>
-#include <queue>
+#include <memory>
+#include <new>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <deque>
 
 
 namespace hipsycl {
 namespace rt {
 
+/// A type-erased callable of signature void() that stores small
+/// closures inline and only falls back to a heap allocation if the closure
+/// does not fit into the inline storage.
+///
+/// Unlike std::function, worker_task is neither copyable nor movable;
+/// it is intended to be constructed in place inside the worker queue.
+class worker_task
+{
+public:
+  static constexpr std::size_t inline_capacity = 112;
+
+  worker_task() = default;
+  worker_task(const worker_task&) = delete;
+  worker_task& operator=(const worker_task&) = delete;
+
+  ~worker_task() { reset(); }
+
+  template<class F>
+  void emplace(F&& f) {
+    using closure_type = std::decay_t<F>;
+    reset();
+
+    if constexpr (sizeof(closure_type) <= inline_capacity &&
+                  alignof(closure_type) <= alignof(std::max_align_t)) {
+      new (&_storage) closure_type(std::forward<F>(f));
+      _invoke = [](void* storage) {
+        (*std::launder(reinterpret_cast<closure_type *>(storage)))();
+      };
+      _destroy = [](void* storage) {
+        std::launder(reinterpret_cast<closure_type *>(storage))->~closure_type();
+      };
+    } else {
+      closure_type *heap_closure = new closure_type(std::forward<F>(f));
+      new (&_storage) closure_type*(heap_closure);
+      _invoke = [](void* storage) {
+        (**reinterpret_cast<closure_type **>(storage))();
+      };
+      _destroy = [](void* storage) {
+        delete *reinterpret_cast<closure_type **>(storage);
+      };
+    }
+  }
+
+  void operator()() {
+    if(_invoke)
+      _invoke(&_storage);
+  }
+
+  void reset() {
+    if(_destroy)
+      _destroy(&_storage);
+    _invoke = nullptr;
+    _destroy = nullptr;
+  }
+private:
+  using invoke_function = void (*)(void *);
+  using destroy_function = void (*)(void *);
+
+  alignas(std::max_align_t) unsigned char _storage[inline_capacity];
+  invoke_function _invoke = nullptr;
+  destroy_function _destroy = nullptr;
+};
+
 /// A worker thread that processes a queue in the background.
+///
+/// Tasks are stored in a bounded lock-free multi-producer/single-consumer
+/// ring buffer. The worker spins for a short time when it runs out of work
+/// before going to sleep, so that bursts of submissions do not pay
+/// for a wakeup per task. Producers only touch a mutex if the worker
+/// or a thread in wait() is asleep.
+///
+/// Producers never block: If the ring is full, tasks are appended to a
+/// mutex-protected overflow list instead, which the worker processes
+/// once all tasks that were already in the ring have completed. Blocking
+/// would deadlock if a task running on this worker (directly or indirectly)
+/// submits more tasks than the ring can hold.
 class worker_thread
 {
 public:
-  using async_function = std::function<void ()>;
-
   /// Construct object
   worker_thread();
 
@@ -58,29 +136,122 @@ public:
 
   /// Enqueues a user-specified function for asynchronous
   /// execution in the worker thread.
-  /// \param f The function to enqueue for execution
-  void operator()(async_function f);
+  /// \param f The function to enqueue for execution. Must be
+  /// invocable with signature void().
+  template<class F>
+  void operator()(F&& f) {
+    if(_is_overflow_active.load(std::memory_order_acquire)) {
+      std::unique_lock<std::mutex> lock{_overflow_mutex};
+      // The worker might have drained the overflow list in the meantime,
+      // in which case we can go back to using the ring.
+      if(_is_overflow_active.load(std::memory_order_relaxed)) {
+        push_overflow(std::forward<F>(f));
+        lock.unlock();
+        notify_worker();
+        return;
+      }
+    }
 
-  /// \return The number of enqueued operations
+    std::size_t pos = _enqueue_pos.load(std::memory_order_relaxed);
+    slot *s = nullptr;
+    bool has_waited_for_free_slot = false;
+
+    for(;;) {
+      s = &_slots[pos & slot_mask];
+      std::size_t seq = s->sequence.load(std::memory_order_acquire);
+      std::intptr_t diff =
+          static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+
+      if(diff == 0) {
+        if (_enqueue_pos.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed))
+          break;
+      } else if (diff < 0 && !has_waited_for_free_slot) {
+        // Ring is full; give the worker a chance to catch up
+        // before falling back to the overflow list.
+        has_waited_for_free_slot = true;
+        spin_until_slot_is_free(pos);
+        pos = _enqueue_pos.load(std::memory_order_relaxed);
+      } else if (diff < 0) {
+        std::unique_lock<std::mutex> lock{_overflow_mutex};
+        _is_overflow_active.store(true, std::memory_order_release);
+        push_overflow(std::forward<F>(f));
+        lock.unlock();
+        notify_worker();
+        return;
+      } else {
+        pos = _enqueue_pos.load(std::memory_order_relaxed);
+      }
+    }
+
+    s->task.emplace(std::forward<F>(f));
+    s->sequence.store(pos + 1, std::memory_order_release);
+
+    notify_worker();
+  }
+
+  /// \return The number of enqueued operations, including
+  /// an operation that is currently being executed.
   std::size_t queue_size() const;
 
   /// Stop the worker thread
   void halt();
 private:
+  static constexpr std::size_t num_slots = 256;
+  static constexpr std::size_t slot_mask = num_slots - 1;
+  static_assert((num_slots & slot_mask) == 0,
+                "Number of slots must be a power of two");
+
+  struct slot {
+    std::atomic<std::size_t> sequence;
+    worker_task task;
+  };
 
   /// Starts the worker thread, which will execute the supplied
   /// tasks. If no tasks are available, waits until a new task is
   /// supplied.
   void work();
 
-  std::thread _worker_thread;
+  /// Waits until the task at ring position \c pos has been published,
+  /// or the overflow list has become active.
+  /// \return false if the worker should shut down instead.
+  bool wait_for_work(std::size_t pos);
+  void spin_until_slot_is_free(std::size_t pos) const;
+  void drain_overflow();
+  void notify_worker();
+  void notify_waiters();
+
+  /// Must be called with _overflow_mutex locked
+  template<class F>
+  void push_overflow(F&& f) {
+    _overflow.emplace_back();
+    _overflow.back().emplace(std::forward<F>(f));
+    _num_overflow_enqueued.fetch_add(1, std::memory_order_release);
+  }
+
+  std::unique_ptr<slot[]> _slots;
 
-  std::atomic<bool> _continue;
+  alignas(64) std::atomic<std::size_t> _enqueue_pos;
+  alignas(64) std::atomic<std::size_t> _num_completed;
 
-  std::condition_variable _condition_wait;
-  mutable std::mutex _mutex;
+  alignas(64) std::atomic<bool> _continue;
+  std::atomic<bool> _is_worker_sleeping;
+  std::atomic<std::size_t> _num_waiters;
 
-  std::queue<async_function> _enqueued_operations;
+  std::atomic<bool> _is_overflow_active;
+  std::atomic<std::size_t> _num_overflow_enqueued;
+  std::atomic<std::size_t> _num_overflow_completed;
+  std::mutex _overflow_mutex;
+  std::deque<worker_task> _overflow;
+
+  // Only used for putting the worker to sleep
+  std::mutex _worker_mutex;
+  std::condition_variable _worker_condition;
+  // Used for threads waiting on the worker to make progress
+  std::mutex _wait_mutex;
+  std::condition_variable _wait_condition;
+
+  std::thread _worker_thread;
 };
 
 }
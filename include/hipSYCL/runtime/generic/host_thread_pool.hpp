@@ -0,0 +1,101 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HIPSYCL_HOST_THREAD_POOL_HPP
+#define HIPSYCL_HOST_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hipsycl {
+namespace rt {
+
+/// A pool of persistent worker threads that execute a task collectively,
+/// similar to an OpenMP parallel region, but without entering the OpenMP
+/// runtime for each launch.
+///
+/// The thread calling run() participates in the execution as thread 0,
+/// so that a launch only requires waking up the workers and waiting for
+/// them to finish. Idle workers spin for a short time before going to
+/// sleep, so that back-to-back launches are served with low latency.
+///
+/// Concurrent calls to run() from different threads are serialized.
+class host_thread_pool
+{
+public:
+  using task_function = void (*)(void *data, int thread_id, int num_threads);
+
+  /// \param num_threads The number of threads that execute a task,
+  /// including the thread that calls run().
+  /// \param cpus If not empty, worker thread i is pinned to
+  /// cpus[i % cpus.size()]. cpus[0] is left for the thread calling run().
+  host_thread_pool(int num_threads, const std::vector<int> &cpus = {});
+  ~host_thread_pool();
+
+  host_thread_pool(const host_thread_pool&) = delete;
+  host_thread_pool& operator=(const host_thread_pool&) = delete;
+
+  int get_num_threads() const;
+
+  /// Invokes f(data, thread_id, num_threads) on all threads of the pool
+  /// and returns once all of them have finished.
+  void run(task_function f, void *data);
+
+private:
+  void work(int thread_id);
+
+  int _num_threads;
+  std::vector<std::thread> _workers;
+
+  std::mutex _launch_mutex;
+  task_function _task = nullptr;
+  void *_task_data = nullptr;
+
+  alignas(64) std::atomic<std::uint64_t> _generation;
+  alignas(64) std::atomic<int> _num_pending;
+  alignas(64) std::atomic<int> _num_sleeping;
+  std::atomic<bool> _is_shutting_down;
+
+  std::mutex _sleep_mutex;
+  std::condition_variable _sleep_cv;
+};
+
+/// \return The CPUs that the calling process is allowed to run on,
+/// or an empty vector if this information is unavailable.
+std::vector<int> get_process_cpus();
+
+/// Restricts the calling thread to run on the given CPUs.
+bool bind_current_thread_to_cpus(const std::vector<int> &cpus);
+
+}
+}
+
+#endif
@@ -35,6 +35,7 @@
 #include <cstring>
 
 #include "device_id.hpp"
+#include "settings.hpp"
 #include "util.hpp"
 
 namespace hipsycl {
@@ -145,6 +146,20 @@ private:
 
 class instant_execution : public execution_hint {};
 
+class omp_schedule : public execution_hint
+{
+public:
+  omp_schedule() = default;
+  omp_schedule(omp_schedule_type schedule)
+      : _schedule{schedule} {}
+
+  omp_schedule_type get_schedule() const {
+    return _schedule;
+  }
+private:
+  omp_schedule_type _schedule;
+};
+
 class request_instrumentation_submission_timestamp : public execution_hint {};
 class request_instrumentation_start_timestamp : public execution_hint {};
 class request_instrumentation_finish_timestamp : public execution_hint {};
@@ -210,6 +225,8 @@ private:
       _request_instrumentation_finish_timestamp;
 
   hints::instant_execution _instant_execution;
+
+  hints::omp_schedule _omp_schedule;
 };
 
 #define HIPSYCL_RT_HINTS_MAP_GETTER(name, member)                              \
@@ -236,6 +253,7 @@ HIPSYCL_RT_HINTS_MAP_GETTER(request_instrumentation_finish_timestamp,
                             _request_instrumentation_finish_timestamp);
 HIPSYCL_RT_HINTS_MAP_GETTER(instant_execution,
                             _instant_execution);
+HIPSYCL_RT_HINTS_MAP_GETTER(omp_schedule, _omp_schedule);
 }
 }
 
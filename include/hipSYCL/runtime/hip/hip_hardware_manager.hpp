@@ -33,6 +33,7 @@
 #include <memory>
 
 #include "../hardware.hpp"
+#include "../caching_allocator.hpp"
 #include "hip_target.hpp"
 
 struct hipDeviceProp_t;
@@ -73,11 +74,12 @@ public:
 
   virtual ~hip_hardware_context() {}
 
-  hip_allocator* get_allocator() const;
+  backend_allocator* get_allocator() const;
   hip_event_pool* get_event_pool() const;
 private:
   std::unique_ptr<hipDeviceProp_t> _properties;
   std::unique_ptr<hip_allocator> _allocator;
+  std::unique_ptr<caching_allocator> _caching_allocator;
   std::unique_ptr<hip_event_pool> _event_pool;
   int _dev;
 };
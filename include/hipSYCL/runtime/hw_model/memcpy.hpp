@@ -28,20 +28,46 @@
 #ifndef HIPSYCL_MEMCPY_HPP
 #define HIPSYCL_MEMCPY_HPP
 
+#include <mutex>
+#include <string>
 #include <vector>
 #include "../operations.hpp"
 #include "../util.hpp"
+#include "../error.hpp"
 
 namespace hipsycl {
 namespace rt {
 
 class backend_manager;
+class runtime;
 
+struct memcpy_link_parameters
+{
+  // Fixed cost of a transfer in seconds
+  cost_type latency;
+  // Sustained bandwidth in bytes per second
+  cost_type bandwidth;
+  // Additional cost in seconds for each contiguous chunk beyond the
+  // first one, if the transferred region is strided
+  cost_type chunk_overhead;
+};
+
+/// Estimates the runtime of data transfers between devices from the
+/// latency and bandwidth of the link between them.
+///
+/// Link parameters can be measured with calibrate() and persisted to a file.
+/// If the setting rt_memcpy_model_file is set, parameters are loaded from
+/// this file on construction. Device pairs without measured parameters
+/// use defaults that only distinguish between same device, same
+/// hardware platform and different hardware platforms.
+///
+/// This class is thread-safe.
 class memcpy_model
 {
 public:
-  memcpy_model(backend_manager* mgr){}
+  memcpy_model(backend_manager* mgr);
 
+  /// \return The estimated runtime of the transfer in seconds
   cost_type estimate_runtime_cost(const memory_location &source,
                                   const memory_location &dest,
                                   range<3> num_elements) const;
@@ -50,6 +76,33 @@ public:
   choose_source(const std::vector<memory_location> &candidate_sources,
                 const memory_location &target, range<3> num_elements) const;
 
+  memcpy_link_parameters get_link_parameters(const device_id &source,
+                                             const device_id &dest) const;
+  void set_link_parameters(const device_id &source, const device_id &dest,
+                           const memcpy_link_parameters &params);
+
+  /// Measures link parameters between all pairs of devices for which
+  /// the runtime can carry out transfers. This allocates memory on all
+  /// devices and must not be invoked concurrently with other work.
+  result calibrate(runtime* rt);
+
+  bool load(const std::string& filename);
+  bool store(const std::string& filename) const;
+
+private:
+  struct link {
+    backend_id source_backend;
+    int source_device;
+    backend_id dest_backend;
+    int dest_device;
+    memcpy_link_parameters params;
+  };
+
+  // Assumes that _mutex is locked
+  const link *find_link(const device_id &source, const device_id &dest) const;
+
+  std::vector<link> _links;
+  mutable std::mutex _mutex;
 };
 
 
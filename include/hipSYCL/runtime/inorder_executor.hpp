@@ -30,10 +30,14 @@
 #define HIPSYCL_INORDER_EXECUTOR_HPP
 
 #include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
 
 #include "executor.hpp"
 #include "hipSYCL/runtime/operations.hpp"
 #include "inorder_queue.hpp"
+#include "batch_completion_event.hpp"
 
 namespace hipsycl {
 namespace rt {
@@ -46,6 +50,11 @@ namespace rt {
 class inorder_executor : public backend_executor
 {
 public:
+  /// Upper bound for the number of operations that are tracked for
+  /// get_num_pending_operations(). Beyond it, the oldest ones are dropped,
+  /// so the reported number of pending operations never exceeds it.
+  static constexpr std::size_t max_tracked_pending_operations = 1024;
+
   inorder_executor(std::unique_ptr<inorder_queue> q);
 
   virtual ~inorder_executor();
@@ -62,9 +71,35 @@ public:
 
   bool can_execute_on_device(const device_id& dev) const override;
   bool is_submitted_by_me(dag_node_ptr node) const override;
+
+  virtual bool prepare_operation(const device_id &dev, operation *op,
+                                 dag_node_ptr node) override;
+
+  virtual void finalize_submission_batch() override;
+
+  virtual std::size_t
+  get_num_pending_operations(const device_id &dev) const override;
+
+  /// Returns an event that completes once all operations that have been
+  /// submitted to dev through any inorder_executor so far have completed,
+  /// or nullptr if all of them are known to have completed.
+  static std::shared_ptr<dag_node_event>
+  create_device_fence(const device_id &dev);
 private:
+  void prune_pending_operations() const;
+
   std::unique_ptr<inorder_queue> _q;
   std::atomic<std::size_t> _num_submitted_operations;
+  // Event shared by the operations submitted in the current
+  // submission_batch. Only accessed from the runtime thread.
+  std::shared_ptr<dag_node_event> _batch_event;
+  batch_completion_event_base* _batch_event_control = nullptr;
+  // Operations submitted to _q that have not been observed to complete,
+  // in submission order. Since _q is in-order, they complete front-first.
+  mutable std::deque<std::weak_ptr<dag_node>> _pending_operations;
+  // Event of the operation submitted last to _q
+  std::shared_ptr<dag_node_event> _last_event;
+  mutable std::mutex _pending_operations_mutex;
 };
 
 }
@@ -63,11 +63,21 @@ public:
   /// Inserts an event into the stream
   virtual std::shared_ptr<dag_node_event> insert_event() = 0;
   virtual std::shared_ptr<dag_node_event> create_queue_completion_event() = 0;
+  /// Creates an event that can be shared by multiple consecutively
+  /// submitted operations, see batch_completion_event
+  virtual std::shared_ptr<dag_node_event> create_batch_completion_event() = 0;
 
   virtual result submit_memcpy(memcpy_operation&, dag_node_ptr) = 0;
   virtual result submit_kernel(kernel_operation&, dag_node_ptr) = 0;
   virtual result submit_prefetch(prefetch_operation &, dag_node_ptr) = 0;
   virtual result submit_memset(memset_operation&, dag_node_ptr) = 0;
+
+  /// Starts preparing the submission of a kernel, e.g. by JIT-compiling
+  /// it in the background. Returns whether submit_kernel() can submit
+  /// the kernel without waiting for the preparations to complete.
+  virtual bool prepare_kernel(kernel_operation&, dag_node_ptr) {
+    return true;
+  }
   
   /// Causes the queue to wait until an event on another queue has occured.
   /// the other queue must be from the same backend
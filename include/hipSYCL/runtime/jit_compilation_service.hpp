@@ -0,0 +1,85 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HIPSYCL_JIT_COMPILATION_SERVICE_HPP
+#define HIPSYCL_JIT_COMPILATION_SERVICE_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hipsycl {
+namespace rt {
+
+/// Runs JIT compilations in the background, so that neither the threads
+/// submitting work nor the DAG worker have to wait for the compiler.
+///
+/// Compilation jobs are executed in submission order by at most
+/// ACPP_SSCP_JIT_MAX_CONCURRENT_COMPILATIONS threads. Threads are only
+/// created once compilation jobs arrive, such that applications that
+/// never JIT-compile do not pay for them.
+///
+/// This class is thread-safe.
+class jit_compilation_service
+{
+public:
+  static jit_compilation_service& get();
+
+  /// Waits for all outstanding compilation jobs and joins the
+  /// compilation threads.
+  ~jit_compilation_service();
+
+  jit_compilation_service(const jit_compilation_service&) = delete;
+  jit_compilation_service& operator=(const jit_compilation_service&) = delete;
+
+  /// Enqueues a compilation job. The job must not throw.
+  void submit(std::function<void()> job);
+
+  std::size_t get_max_concurrent_compilations() const;
+private:
+  jit_compilation_service();
+
+  void work();
+
+  std::size_t _max_concurrent_compilations;
+  std::vector<std::thread> _threads;
+  std::deque<std::function<void()>> _jobs;
+  std::size_t _num_idle_threads = 0;
+  bool _is_shutting_down = false;
+
+  std::mutex _mutex;
+  std::condition_variable _cv;
+};
+
+}
+}
+
+#endif
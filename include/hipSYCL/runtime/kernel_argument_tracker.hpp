@@ -0,0 +1,115 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HIPSYCL_KERNEL_ARGUMENT_TRACKER_HPP
+#define HIPSYCL_KERNEL_ARGUMENT_TRACKER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "hipSYCL/glue/kernel_configuration.hpp"
+#include "error.hpp"
+#include "kernel_cache.hpp"
+
+namespace hipsycl {
+namespace rt {
+
+/// Tracks the values of integer and floating point arguments of SSCP
+/// kernel launches, such that kernels can be specialized for arguments
+/// that do not change between launches.
+///
+/// An argument becomes a specialization candidate once it has had the
+/// same value for ACPP_SSCP_JIT_ARGUMENT_SPECIALIZATION_THRESHOLD launches
+/// in a row. Tracking is disabled if the threshold is 0.
+///
+/// This class is thread-safe.
+class kernel_argument_tracker {
+public:
+  static kernel_argument_tracker& get();
+
+  bool is_enabled() const {
+    return _threshold > 0;
+  }
+
+  /// Records the argument values of a launch of kernel_name. args and
+  /// arg_sizes must describe the arguments of the kernel function as
+  /// described by kernel_info, i.e. after mapping from C++ arguments.
+  ///
+  /// If some arguments have been stable for at least the threshold
+  /// number of launches, returns true and stores a copy of config
+  /// in specialized_config_out to which these arguments with their
+  /// values of *this* launch have been added. The result can therefore
+  /// only be used to select code objects for the launch that it was
+  /// returned for.
+  bool record_launch(const hcf_kernel_info &kernel_info,
+                     const std::string &kernel_name, void **args,
+                     const std::size_t *arg_sizes,
+                     const glue::kernel_configuration &config,
+                     glue::kernel_configuration &specialized_config_out);
+
+  /// Reports that compiling kernel_name with config has failed.
+  /// Specialized variants are only an optimization, so their failures are
+  /// not registered as errors; launches fall back to the generic kernel
+  /// and the variant is not requested again. Failures of generic kernels
+  /// are registered as asynchronous errors.
+  void report_failed_compilation(hcf_object_id hcf_object,
+                                 const std::string &kernel_name,
+                                 const glue::kernel_configuration &config,
+                                 const result &err);
+
+private:
+  kernel_argument_tracker();
+
+  // Bounds the number of compilations that a kernel
+  // with frequently changing arguments can cause.
+  static constexpr std::size_t max_variants_per_kernel = 16;
+
+  struct argument_state {
+    uint64_t value = 0;
+    std::size_t num_stable_launches = 0;
+  };
+
+  struct kernel_state {
+    std::vector<argument_state> arguments;
+    std::vector<glue::kernel_configuration::id_type> variants;
+    std::vector<glue::kernel_configuration::id_type> failed_variants;
+  };
+
+  std::size_t _threshold;
+  std::map<std::pair<hcf_object_id, std::string>, kernel_state> _kernels;
+  std::mutex _mutex;
+};
+
+}
+}
+
+#endif
@@ -25,16 +25,21 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <atomic>
+#include <deque>
+#include <exception>
 #include <string>
 #include <unordered_map>
 #include <mutex>
 #include <cassert>
 #include <memory>
+#include <future>
 #include "hipSYCL/common/hcf_container.hpp"
 #include "hipSYCL/common/small_map.hpp"
 #include "hipSYCL/glue/kernel_configuration.hpp"
 #include "hipSYCL/runtime/device_id.hpp"
 #include "hipSYCL/runtime/error.hpp"
+#include "hipSYCL/runtime/jit_compilation_service.hpp"
 
 #ifndef HIPSYCL_RT_KERNEL_CACHE_HPP
 #define HIPSYCL_RT_KERNEL_CACHE_HPP
@@ -102,6 +107,8 @@ public:
 
   enum argument_type {
     pointer,
+    integer,
+    floating_point,
     other
   };
 
@@ -147,7 +154,10 @@ private:
 // Stores all HCF data, and also extracts information for data
 // in the SSCP format.
 //
-// This class is thread-safe.
+// This class is thread-safe. Lookups are performed on an immutable snapshot
+// of the cache state and do not take any locks, since they happen on
+// every SSCP kernel launch. Registering or unregistering HCF objects
+// publishes a new snapshot.
 class hcf_cache {
 public:
   static hcf_cache& get();
@@ -163,56 +173,133 @@ public:
   };
 
   using symbol_resolver_list = std::vector<device_image_id>;
+
+  // Kernel and image names are interned when HCF objects are registered.
+  // The id of a name remains valid for the lifetime of the cache.
+  using name_id = std::size_t;
+  static constexpr name_id invalid_name_id = ~name_id{0};
+
+  // Returns invalid_name_id if no registered HCF object
+  // contains a kernel or image of this name.
+  name_id get_name_id(const std::string& name) const;
   
   template<class Handler>
   void symbol_lookup(const std::vector<std::string>& names, Handler&& h) const {
-    std::lock_guard<std::mutex> lock{_mutex};
+    // Hold a reference, since the handler may trigger
+    // publication of a new snapshot.
+    std::shared_ptr<const snapshot> s = get_snapshot();
 
     for(const auto& symbol_name : names) {
       HIPSYCL_DEBUG_INFO << "hcf_cache: Looking up symbol " << symbol_name
                          << std::endl;
-      auto it = _exported_symbol_providers.find(symbol_name);
-      if(it == _exported_symbol_providers.end()) {
+      // Providers are reported in the order in which their HCF objects
+      // were registered.
+      symbol_resolver_list providers;
+      for(const auto& exporter : s->symbol_exporters) {
+        auto it = exporter->exported_symbols.find(symbol_name);
+        if(it != exporter->exported_symbols.end())
+          providers.insert(providers.end(), it->second.begin(),
+                           it->second.end());
+      }
+      if(providers.empty()) {
         HIPSYCL_DEBUG_INFO << "hcf_cache: (Symbol not found)\n";
-        h(symbol_name, {});
       } else {
         HIPSYCL_DEBUG_INFO << "hcf_cache: Symbol found\n";
-        h(symbol_name, it->second);
       }
+      h(symbol_name, providers);
     }
   }
 
   const hcf_kernel_info *get_kernel_info(hcf_object_id obj,
                                          const std::string &kernel_name) const;
+  const hcf_kernel_info *get_kernel_info(hcf_object_id obj,
+                                         name_id kernel_name) const;
 
   const hcf_image_info *get_image_info(hcf_object_id obj,
                                        const std::string &image_name) const;
+  const hcf_image_info *get_image_info(hcf_object_id obj,
+                                       name_id image_name) const;
 
 private:
   hcf_cache() = default;
 
-  std::unordered_map<hcf_object_id, std::unique_ptr<common::hcf_container>>
-      _hcf_objects;
-  std::unordered_map<std::string, symbol_resolver_list> _exported_symbol_providers;
+  // Kernel, image and symbol info extracted from a single HCF object.
+  // Shared between snapshots, so that publishing a new snapshot does not
+  // need to copy the info of all registered objects.
+  struct hcf_object_info {
+    std::unordered_map<name_id, std::unique_ptr<hcf_kernel_info>> kernels;
+    std::unordered_map<name_id, std::unique_ptr<hcf_image_info>> images;
+    std::unordered_map<std::string, symbol_resolver_list> exported_symbols;
+  };
 
-    
-  struct stable_running_pair_hash {
-    size_t operator()(const std::pair<hcf_object_id, std::string> &p) const
-    {
-      common::stable_running_hash h;
-      h(reinterpret_cast<const void*>(&p.first), sizeof(hcf_object_id));
-      h(static_cast<const void*>(p.second.c_str()), p.second.size());
-      return h.get_current_hash();
-    }
+  // Maps kernel and image names to their ids. Since names are never
+  // removed, the table is append-only and not part of the snapshots:
+  // Lookups traverse immutable entries without taking locks, and
+  // registering an HCF object only adds its new names.
+  class name_table {
+  public:
+    name_table();
+
+    name_id find(const std::string& name) const;
+    // Returns the id of an already interned name, or assigns a new one.
+    // Must not be called concurrently with itself.
+    name_id insert(const std::string& name);
+  private:
+    struct entry {
+      std::string name;
+      std::size_t hash;
+      name_id id;
+    };
+    struct link {
+      const entry* e;
+      const link* next;
+    };
+    struct bucket_array {
+      explicit bucket_array(std::size_t size);
+
+      std::size_t mask;
+      std::unique_ptr<std::atomic<const link*>[]> buckets;
+    };
+
+    const entry* find(const std::string& name, std::size_t hash) const;
+    void add_link(bucket_array& buckets, const entry* e);
+
+    // deques keep the addresses of their elements stable on insertion
+    std::deque<entry> _entries;
+    std::deque<link> _links;
+    // Replaced bucket arrays are retained, since readers might
+    // still traverse them.
+    std::vector<std::unique_ptr<bucket_array>> _bucket_arrays;
+    std::atomic<bucket_array*> _current_buckets;
   };
 
-  std::unordered_map<std::pair<hcf_object_id, std::string>,
-                     std::unique_ptr<hcf_kernel_info>, stable_running_pair_hash>
-      _hcf_kernel_info;
-  std::unordered_map<std::pair<hcf_object_id, std::string>,
-                     std::unique_ptr<hcf_image_info>, stable_running_pair_hash>
-      _hcf_image_info;
+  struct snapshot {
+    std::unordered_map<hcf_object_id,
+                       std::shared_ptr<const common::hcf_container>>
+        hcf_objects;
+    // Info of unregistered objects is retained, since just maintaining it
+    // won't have any side effects as long as the HCF object is no longer
+    // selected for execution.
+    std::unordered_map<hcf_object_id, std::shared_ptr<const hcf_object_info>>
+        object_info;
+    // Info of the registered objects that export symbols, in the order
+    // in which they were registered.
+    std::vector<std::shared_ptr<const hcf_object_info>> symbol_exporters;
+  };
 
+  // Returns the current snapshot. The calling thread keeps it alive until
+  // it observes that a newer snapshot has been published.
+  const std::shared_ptr<const snapshot>& get_snapshot() const;
+  // Must be called with _mutex locked
+  void publish(std::shared_ptr<const snapshot> s);
+
+  std::shared_ptr<const snapshot> _snapshot = std::make_shared<snapshot>();
+  // Incremented whenever a new snapshot is published
+  std::atomic<std::size_t> _version{1};
+  // Insertions are serialized by _mutex
+  name_table _names;
+
+  // Serializes modifications
   mutable std::mutex _mutex;
 };
 
@@ -221,6 +308,7 @@ public:
   using code_object_ptr = std::unique_ptr<const code_object>;
   using code_object_index_t = std::size_t;
   using kernel_name_index_t = std::size_t;
+  using code_object_future = std::shared_future<const code_object*>;
 
   static std::shared_ptr<kernel_cache> get();
 
@@ -341,7 +429,106 @@ public:
         kernel_index, backend_kernel_name, b, pred, c);
   }
 
+  // Like get_or_construct_code_object(), but if the object does not exist
+  // yet, it is constructed on the jit_compilation_service and the returned
+  // future becomes ready once construction has completed. The cache is not
+  // locked during construction, so lookups of other code objects and
+  // other constructions are not held up.
+  //
+  // construction_key must uniquely identify the code object that
+  // the constructor creates. Requests with the same key that arrive while
+  // the object is under construction share the pending construction instead
+  // of constructing the object again. The constructor is invoked on
+  // a compilation thread and must therefore not capture anything by
+  // reference that may not outlive the request. If construction fails
+  // or throws, the future yields nullptr. The constructor is responsible for reporting
+  // the failure, since not every failure is an error (e.g. of optional
+  // specialized variants).
+  template <class Constructor, class Predicate>
+  code_object_future get_or_construct_code_object_async(
+      kernel_name_index_t kernel_index, const std::string &backend_kernel_name,
+      backend_id b, hcf_object_id source_object,
+      const std::string &construction_key, Predicate &&object_selector,
+      Constructor c) {
+
+    auto pred = [&](const code_object *obj) {
+      if (obj->hcf_source() != source_object)
+        return false;
+
+      return object_selector(obj);
+    };
+
+    auto construction = std::make_shared<std::promise<const code_object*>>();
+    code_object_future result = construction->get_future().share();
+    {
+      std::lock_guard<std::mutex> lock{_mutex};
+
+      const code_object *obj =
+          get_code_object_impl(kernel_index, backend_kernel_name, b, pred);
+      if(obj) {
+        construction->set_value(obj);
+        return result;
+      }
+
+      auto it = _pending_constructions.find(construction_key);
+      if(it != _pending_constructions.end()) {
+        HIPSYCL_DEBUG_INFO << "kernel_cache: cache MISS for kernel index "
+                           << kernel_index
+                           << ", joining pending construction" << std::endl;
+        return it->second;
+      }
+
+      HIPSYCL_DEBUG_INFO << "kernel_cache: cache MISS; constructing new object "
+                            "in the background for kernel index "
+                         << kernel_index << " and backend kernel name "
+                         << backend_kernel_name << std::endl;
+      _pending_constructions[construction_key] = result;
+    }
+
+    jit_compilation_service::get().submit(
+        [this, kernel_index, b, construction_key, construction,
+         c = std::move(c)]() mutable {
+          // Jobs must not throw, and waiters must not be left without
+          // a result if the constructor does.
+          const code_object *new_obj = nullptr;
+          try {
+            new_obj = c();
+          } catch (const std::exception &e) {
+            register_error(
+                __hipsycl_here(),
+                error_info{std::string{"kernel_cache: code object "
+                                       "construction threw an exception: "} +
+                           e.what()});
+          } catch (...) {
+            register_error(__hipsycl_here(),
+                           error_info{"kernel_cache: code object construction "
+                                      "threw an unknown exception"});
+          }
+          {
+            std::lock_guard<std::mutex> lock{_mutex};
+            if(new_obj)
+              add_code_object(kernel_index, b, new_obj);
+            _pending_constructions.erase(construction_key);
+          }
+          construction->set_value(new_obj);
+        });
+
+    return result;
+  }
+
+  // Builds a construction key for get_or_construct_code_object_async()
+  // for code objects compiled from a device image for a device.
+  // kernel_names are the kernels from the image that the code object
+  // contains.
+  static std::string
+  make_construction_key(backend_id b, std::size_t device_index,
+                        hcf_object_id source_object,
+                        const std::string &image_name,
+                        const std::vector<std::string> &kernel_names,
+                        const glue::kernel_configuration::id_type &config_id);
+
   // Unload entire cache and release resources to prepare runtime shutdown.
+  // Waits for pending constructions first.
   void unload();
 private:
 
@@ -417,6 +604,14 @@ private:
     
     // We haven't found the requested object: Construct new code object
     const code_object* new_obj = c();
+    add_code_object(kernel_index, b, new_obj);
+
+    return new_obj;
+  }
+
+  // Must be called with locked mutex
+  void add_code_object(kernel_name_index_t kernel_index, backend_id b,
+                       const code_object *new_obj) {
     if(new_obj) {
       _code_objects.emplace_back(code_object_ptr{new_obj});
       code_object_index_t new_cidx = _code_objects.size() - 1;
@@ -427,8 +622,6 @@ private:
           __hipsycl_here(),
           error_info{"kernel_cache: code object creation has failed"});
     }
-
-    return new_obj;
   }
 
   // These objects should only be written to during startup - they
@@ -443,6 +636,9 @@ private:
   common::small_map<rt::backend_id, std::vector<std::vector<code_object_index_t>>> _kernel_code_objects;
 
   std::vector<code_object_ptr> _code_objects;
+  // Code objects that are currently constructed in the background,
+  // by construction key
+  std::unordered_map<std::string, code_object_future> _pending_constructions;
 
   kernel_cache() = default;
 
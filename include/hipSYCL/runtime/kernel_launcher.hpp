@@ -95,6 +95,13 @@ public:
   virtual void set_params(void*) = 0;
   virtual void invoke(dag_node *node,
                       const glue::kernel_configuration &config) = 0;
+  // Starts preparations for invoke() that may take a long time,
+  // e.g. JIT compilation, without waiting for them to complete.
+  // Returns whether invoke() can be called without waiting.
+  virtual bool prepare(dag_node *node,
+                       const glue::kernel_configuration &config) {
+    return true;
+  }
 
   void set_backend_capabilities(const backend_kernel_launch_capabilities& cap) {
     _capabilities = cap;
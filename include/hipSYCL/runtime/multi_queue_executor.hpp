@@ -156,6 +156,12 @@ public:
   virtual bool can_execute_on_device(const device_id& dev) const override;
   virtual bool is_submitted_by_me(dag_node_ptr node) const override;
 
+  virtual bool prepare_operation(const device_id &dev, operation *op,
+                                 dag_node_ptr node) override;
+
+  virtual std::size_t
+  get_num_pending_operations(const device_id &dev) const override;
+
   bool find_assigned_lane_index(dag_node_ptr node, std::size_t& index_out) const;
 private:
   
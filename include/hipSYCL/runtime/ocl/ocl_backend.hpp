@@ -29,6 +29,7 @@
 
 #include "../backend.hpp"
 #include "../multi_queue_executor.hpp"
+#include "../caching_allocator.hpp"
 
 #include "ocl_allocator.hpp"
 #include "ocl_queue.hpp"
@@ -62,6 +63,8 @@ public:
 private:
   mutable ocl_hardware_manager _hw_manager;
   mutable multi_queue_executor _executor;
+  // One per device; empty if allocation pooling is disabled
+  std::vector<std::unique_ptr<caching_allocator>> _caching_allocators;
 };
 
 }
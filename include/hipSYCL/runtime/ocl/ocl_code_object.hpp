@@ -57,6 +57,12 @@ public:
                                std::size_t *arg_sizes, std::size_t num_args,
                                const std::string &kernel_name,
                                const glue::kernel_configuration& config) override;
+
+  virtual bool prepare_kernel(const kernel_operation &op,
+                              hcf_object_id hcf_object,
+                              const std::string &kernel_name,
+                              unsigned local_mem_size,
+                              const glue::kernel_configuration &config) override;
 private:
   ocl_queue* _queue;
 };
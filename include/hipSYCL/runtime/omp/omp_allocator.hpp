@@ -28,15 +28,33 @@
 #ifndef HIPSYCL_OMP_ALLOCATOR_HPP
 #define HIPSYCL_OMP_ALLOCATOR_HPP
 
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 #include "../allocator.hpp"
+#include "../settings.hpp"
+#include "omp_numa.hpp"
 
 namespace hipsycl {
 namespace rt {
 
+class host_thread_pool;
+class omp_hardware_manager;
+
+/// Allocator for the OpenMP host device.
+///
+/// On NUMA systems, large allocations are placed according to the
+/// rt_omp_numa_placement setting, or on the NUMA node of the device if
+/// NUMA domains are exposed as individual devices.
 class omp_allocator : public backend_allocator 
 {
 public:
-  omp_allocator(const device_id &my_device);
+  /// \param thread_pool The thread pool that executes kernels on this device,
+  /// or nullptr if kernels use OpenMP parallel regions. Used to place pages
+  /// in first-touch mode.
+  omp_allocator(const device_id &my_device, host_thread_pool *thread_pool,
+                const omp_hardware_manager &hw);
   
   virtual void* allocate(size_t min_alignment, size_t size_bytes) override;
 
@@ -54,7 +72,20 @@ public:
   virtual result mem_advise(const void *addr, std::size_t num_bytes,
                             int advise) const override;
 private:
+  bool is_numa_placed(std::size_t min_alignment, std::size_t size_bytes) const;
+  void *allocate_numa_placed(std::size_t size_bytes);
+  void first_touch(void *ptr, std::size_t size_bytes);
+
   device_id _my_device;
+  host_thread_pool *_thread_pool;
+
+  // Empty if allocations are not placed explicitly
+  std::vector<numa_domain> _numa_domains;
+  bool _is_numa_device;
+  omp_numa_placement _numa_placement;
+
+  std::mutex _mapped_allocations_mutex;
+  std::unordered_map<void *, std::size_t> _mapped_allocations;
 };
 
 }
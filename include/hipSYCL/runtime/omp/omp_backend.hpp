@@ -30,6 +30,8 @@
 
 #include "../backend.hpp"
 #include "../multi_queue_executor.hpp"
+#include "../caching_allocator.hpp"
+#include "../generic/host_thread_pool.hpp"
 #include "omp_allocator.hpp"
 #include "omp_hardware_manager.hpp"
 
@@ -57,9 +59,13 @@ public:
   std::unique_ptr<backend_executor>
   create_inorder_executor(device_id dev, int priority) override;
 private:
-  mutable omp_allocator _allocator;
   mutable omp_hardware_manager _hw;
+  // One per device, may be nullptr. Must outlive the executor, whose
+  // queues execute kernels on them, and the allocators.
+  std::vector<std::unique_ptr<host_thread_pool>> _thread_pools;
   mutable multi_queue_executor _executor;
+  std::vector<std::unique_ptr<omp_allocator>> _allocators;
+  std::vector<std::unique_ptr<caching_allocator>> _caching_allocators;
 }; 
 
 }
@@ -28,14 +28,26 @@
 #ifndef HIPSYCL_OMP_HARDWARE_MANAGER_HPP
 #define HIPSYCL_OMP_HARDWARE_MANAGER_HPP
 
+#include <vector>
+
 #include "../hardware.hpp"
+#include "omp_numa.hpp"
 
 namespace hipsycl {
 namespace rt {
 
+/// \return The sub-group size of nd_range kernels on host devices as set by
+/// ACPP_RT_OMP_SUB_GROUP_SIZE. A setting of 0 selects the number of 32-bit
+/// lanes of the widest vector registers that the CPU supports.
+std::size_t get_omp_sub_group_size();
+
 class omp_hardware_context : public hardware_context
 {
 public:
+  omp_hardware_context() = default;
+  /// Constructs a device that represents a single NUMA domain
+  omp_hardware_context(const numa_domain& domain);
+
   virtual bool is_cpu() const override;
   virtual bool is_gpu() const override;
 
@@ -58,18 +70,31 @@ public:
   virtual std::string get_profile() const override;
 
   virtual ~omp_hardware_context() {}
+private:
+  int _numa_node = -1;
+  std::size_t _num_cpus = 0;
 };
 
 class omp_hardware_manager : public backend_hardware_manager
 {
 public:
+  omp_hardware_manager();
+
   virtual std::size_t get_num_devices() const override;
   virtual hardware_context *get_device(std::size_t index) override;
   virtual device_id get_device_id(std::size_t index) const override;
 
+  /// \return The NUMA domain that the device represents, or nullptr if
+  /// NUMA domains are not exposed as individual devices.
+  const numa_domain* get_device_numa_domain(std::size_t index) const;
+  /// \return All NUMA domains of the system
+  const std::vector<numa_domain>& get_numa_domains() const;
+
   virtual ~omp_hardware_manager(){}
 private:
-  omp_hardware_context _device;
+  std::vector<numa_domain> _numa_domains;
+  bool _has_numa_devices;
+  std::vector<omp_hardware_context> _devices;
 };
 
 } // namespace rt
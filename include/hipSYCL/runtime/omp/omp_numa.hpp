@@ -0,0 +1,62 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HIPSYCL_OMP_NUMA_HPP
+#define HIPSYCL_OMP_NUMA_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace hipsycl {
+namespace rt {
+
+struct numa_domain {
+  int node;
+  // CPUs of this NUMA node that the process may run on
+  std::vector<int> cpus;
+};
+
+/// \return The NUMA nodes that have CPUs on which the process may run.
+/// Contains at most one entry if the system is not a NUMA system or if
+/// no NUMA information is available.
+std::vector<numa_domain> get_numa_domains();
+
+/// Sets the memory policy of the pages in the given range such that they
+/// are preferably allocated on the given NUMA node when first touched.
+/// \c ptr must be aligned to the page size.
+bool numa_prefer_node(void *ptr, std::size_t bytes, const numa_domain &domain);
+
+/// Sets the memory policy of the pages in the given range such that they
+/// are distributed round-robin across the given NUMA nodes when first
+/// touched. \c ptr must be aligned to the page size.
+bool numa_interleave(void *ptr, std::size_t bytes,
+                     const std::vector<numa_domain> &domains);
+
+}
+}
+
+#endif
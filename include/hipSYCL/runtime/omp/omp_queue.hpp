@@ -29,6 +29,7 @@
 #define HIPSYCL_OMP_QUEUE_HPP
 
 #include "../generic/async_worker.hpp"
+#include "../generic/host_thread_pool.hpp"
 #include "../executor.hpp"
 #include "../inorder_queue.hpp"
 #include "hipSYCL/runtime/device_id.hpp"
@@ -39,12 +40,13 @@ namespace rt {
 class omp_queue : public inorder_queue
 {
 public:
-  omp_queue(backend_id id);
+  omp_queue(device_id dev, host_thread_pool *thread_pool = nullptr);
   virtual ~omp_queue();
 
   /// Inserts an event into the stream
   virtual std::shared_ptr<dag_node_event> insert_event() override;
   virtual std::shared_ptr<dag_node_event> create_queue_completion_event() override;
+  virtual std::shared_ptr<dag_node_event> create_batch_completion_event() override;
 
   virtual result submit_memcpy(memcpy_operation&, dag_node_ptr) override;
   virtual result submit_kernel(kernel_operation&, dag_node_ptr) override;
@@ -64,9 +66,23 @@ public:
   virtual result query_status(inorder_queue_status& status) override;
   
   worker_thread& get_worker();
+
+  /// \return The thread pool on which kernels should be executed, or nullptr
+  /// if kernels should use OpenMP parallel regions.
+  host_thread_pool* get_thread_pool() const {
+    return _thread_pool;
+  }
+
+  /// \return The sub-group size of nd_range kernels
+  std::size_t get_sub_group_size() const {
+    return _sub_group_size;
+  }
 private:
   const backend_id _backend_id;
+  const device_id _dev;
   worker_thread _worker;
+  host_thread_pool* _thread_pool;
+  std::size_t _sub_group_size;
 };
 
 }
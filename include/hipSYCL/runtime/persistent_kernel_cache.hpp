@@ -0,0 +1,124 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef HIPSYCL_RT_PERSISTENT_KERNEL_CACHE_HPP
+#define HIPSYCL_RT_PERSISTENT_KERNEL_CACHE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+#include "hipSYCL/common/stable_running_hash.hpp"
+
+namespace hipsycl {
+namespace rt {
+
+/// Stores compiled device binaries on disk, such that they can be reused
+/// across application runs instead of running the JIT again.
+///
+/// Entries are stored as individual files in the directory given by
+/// \c setting::sscp_jit_cache_directory. Writes go to a temporary file first
+/// which is then atomically renamed to its final name, so multiple processes
+/// can safely share one cache directory. If the directory grows beyond
+/// \c setting::sscp_jit_cache_max_size, the least recently used entries
+/// are evicted, using the file modification time as access time stamp.
+/// Temporary files are not evicted unless they are old enough to have been
+/// abandoned by a crashed writer.
+///
+/// This class is thread-safe.
+class persistent_kernel_cache {
+public:
+  /// Accumulates all data that uniquely identifies a cache entry.
+  class key_builder {
+  public:
+    void operator()(const void* data, std::size_t size) {
+      _low(data, size);
+      _high(data, size);
+    }
+
+    void operator()(const std::string& s) {
+      // Include the size so that a sequence of strings is
+      // hashed unambiguously
+      std::uint64_t size = s.size();
+      (*this)(&size, sizeof(size));
+      (*this)(s.data(), s.size());
+    }
+
+    template<class T>
+    void operator()(const T& value) {
+      (*this)(static_cast<const void*>(&value), sizeof(T));
+    }
+
+    std::string get_key() const;
+  private:
+    common::stable_running_hash _low;
+    // Second hash is seeded differently to obtain 128 bits in total
+    common::stable_running_hash _high = [](){
+      common::stable_running_hash h;
+      const char seed [] = "acpp-persistent-kernel-cache";
+      h(seed, sizeof(seed));
+      return h;
+    }();
+  };
+
+  static persistent_kernel_cache& get();
+
+  /// Creates a cache in the given directory. Most code should use the
+  /// instance configured from the runtime settings, obtained with get().
+  persistent_kernel_cache(const std::string& directory, std::size_t max_size);
+
+  bool is_enabled() const;
+
+  /// Attempts to load the entry with the given key into \c out.
+  /// Returns whether the entry was found.
+  bool retrieve(const std::string& key, std::string& out);
+  /// Stores \c data under the given key, and evicts old entries
+  /// if the maximum cache size is exceeded.
+  void store(const std::string& key, const std::string& data);
+
+  std::size_t get_num_hits() const;
+  std::size_t get_num_misses() const;
+private:
+  persistent_kernel_cache();
+
+  std::string get_entry_path(const std::string& key) const;
+  void evict_entries();
+
+  std::string _directory;
+  std::size_t _max_size;
+  bool _is_enabled;
+
+  std::atomic<std::size_t> _num_hits;
+  std::atomic<std::size_t> _num_misses;
+  std::mutex _eviction_mutex;
+};
+
+}
+}
+
+#endif
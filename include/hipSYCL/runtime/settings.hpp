@@ -42,7 +42,10 @@ namespace hipsycl {
 namespace rt {
 
 enum class scheduler_type { direct, unbound };
+enum class placement_strategy { cost_model, round_robin };
 enum class default_selector_behavior { strict, multigpu, system };
+enum class omp_schedule_type { static_schedule, work_stealing };
+enum class omp_numa_placement { none, interleave, first_touch };
 
 struct device_visibility_condition{
   int device_index_equality = -1;
@@ -67,8 +70,11 @@ bool device_matches(const visibility_mask_t::mapped_type &visibility_conditions,
 bool has_device_visibility_mask(const visibility_mask_t& mask, backend_id backend);
 
 std::istream &operator>>(std::istream &istr, scheduler_type &out);
+std::istream &operator>>(std::istream &istr, placement_strategy &out);
 std::istream &operator>>(std::istream &istr, visibility_mask_t &out);
 std::istream &operator>>(std::istream &istr, default_selector_behavior& out);
+std::istream &operator>>(std::istream &istr, omp_schedule_type& out);
+std::istream &operator>>(std::istream &istr, omp_numa_placement& out);
 
 template <class T>
 bool try_get_environment_variable(const std::string& name, T& out) {
@@ -119,7 +125,27 @@ enum class setting {
   sscp_failed_ir_dump_directory,
   gc_trigger_batch_size,
   ocl_no_shared_context,
-  ocl_show_all_devices
+  ocl_show_all_devices,
+  placement_strategy,
+  placement_queue_depth_cost,
+  sscp_jit_cache_directory,
+  sscp_jit_cache_max_size,
+  sscp_jit_max_concurrent_compilations,
+  sscp_jit_argument_specialization_threshold,
+  sscp_jit_per_kernel_compilation,
+  allocation_pooling,
+  allocation_pool_max_cached_size,
+  batch_submission,
+  memcpy_model_file,
+  omp_schedule,
+  omp_thread_pool,
+  omp_pin_threads,
+  omp_numa_placement,
+  omp_numa_devices,
+  omp_sub_group_size,
+  omp_local_size_specialization,
+  trace_file,
+  trace_buffer_size
 };
 
 template <setting S> struct setting_trait {};
@@ -151,6 +177,46 @@ HIPSYCL_RT_MAKE_SETTING_TRAIT(setting::sscp_failed_ir_dump_directory,
 HIPSYCL_RT_MAKE_SETTING_TRAIT(setting::gc_trigger_batch_size, "rt_gc_trigger_batch_size", std::size_t)
 HIPSYCL_RT_MAKE_SETTING_TRAIT(setting::ocl_no_shared_context, "rt_ocl_no_shared_context", bool)
 HIPSYCL_RT_MAKE_SETTING_TRAIT(setting::ocl_show_all_devices, "rt_ocl_show_all_devices", bool)
+HIPSYCL_RT_MAKE_SETTING_TRAIT(setting::placement_strategy, "rt_placement_strategy", placement_strategy)
+HIPSYCL_RT_MAKE_SETTING_TRAIT(setting::placement_queue_depth_cost,
+                              "rt_placement_queue_depth_cost", double)
+HIPSYCL_RT_MAKE_SETTING_TRAIT(setting::sscp_jit_cache_directory,
+                              "sscp_jit_cache_directory", std::string)
+HIPSYCL_RT_MAKE_SETTING_TRAIT(setting::sscp_jit_cache_max_size,
+                              "sscp_jit_cache_max_size", std::size_t)
+HIPSYCL_RT_MAKE_SETTING_TRAIT(setting::sscp_jit_max_concurrent_compilations,
+                              "sscp_jit_max_concurrent_compilations",
+                              std::size_t)
+HIPSYCL_RT_MAKE_SETTING_TRAIT(
+    setting::sscp_jit_argument_specialization_threshold,
+    "sscp_jit_argument_specialization_threshold", std::size_t)
+HIPSYCL_RT_MAKE_SETTING_TRAIT(setting::sscp_jit_per_kernel_compilation,
+                              "sscp_jit_per_kernel_compilation", bool)
+HIPSYCL_RT_MAKE_SETTING_TRAIT(setting::allocation_pooling,
+                              "rt_allocation_pooling", bool)
+HIPSYCL_RT_MAKE_SETTING_TRAIT(setting::allocation_pool_max_cached_size,
+                              "rt_allocation_pool_max_cached_size", std::size_t)
+HIPSYCL_RT_MAKE_SETTING_TRAIT(setting::batch_submission,
+                              "rt_batch_submission", bool)
+HIPSYCL_RT_MAKE_SETTING_TRAIT(setting::memcpy_model_file,
+                              "rt_memcpy_model_file", std::string)
+HIPSYCL_RT_MAKE_SETTING_TRAIT(setting::omp_schedule, "rt_omp_schedule",
+                              omp_schedule_type)
+HIPSYCL_RT_MAKE_SETTING_TRAIT(setting::omp_thread_pool, "rt_omp_thread_pool",
+                              bool)
+HIPSYCL_RT_MAKE_SETTING_TRAIT(setting::omp_pin_threads, "rt_omp_pin_threads",
+                              bool)
+HIPSYCL_RT_MAKE_SETTING_TRAIT(setting::omp_numa_placement,
+                              "rt_omp_numa_placement", omp_numa_placement)
+HIPSYCL_RT_MAKE_SETTING_TRAIT(setting::omp_numa_devices, "rt_omp_numa_devices",
+                              bool)
+HIPSYCL_RT_MAKE_SETTING_TRAIT(setting::omp_sub_group_size,
+                              "rt_omp_sub_group_size", std::size_t)
+HIPSYCL_RT_MAKE_SETTING_TRAIT(setting::omp_local_size_specialization,
+                              "rt_omp_local_size_specialization", bool)
+HIPSYCL_RT_MAKE_SETTING_TRAIT(setting::trace_file, "rt_trace_file", std::string)
+HIPSYCL_RT_MAKE_SETTING_TRAIT(setting::trace_buffer_size,
+                              "rt_trace_buffer_size", std::size_t)
 
 class settings
 {
@@ -185,6 +251,47 @@ public:
       return _ocl_no_shared_context;
     } else if constexpr(S == setting::ocl_show_all_devices) {
       return _ocl_show_all_devices;
+    } else if constexpr(S == setting::placement_strategy) {
+      return _placement_strategy;
+    } else if constexpr(S == setting::placement_queue_depth_cost) {
+      return _placement_queue_depth_cost;
+    } else if constexpr(S == setting::sscp_jit_cache_directory) {
+      return _sscp_jit_cache_directory;
+    } else if constexpr(S == setting::sscp_jit_cache_max_size) {
+      return _sscp_jit_cache_max_size;
+    } else if constexpr(S == setting::sscp_jit_max_concurrent_compilations) {
+      return _sscp_jit_max_concurrent_compilations;
+    } else if constexpr(S ==
+                        setting::sscp_jit_argument_specialization_threshold) {
+      return _sscp_jit_argument_specialization_threshold;
+    } else if constexpr(S == setting::sscp_jit_per_kernel_compilation) {
+      return _sscp_jit_per_kernel_compilation;
+    } else if constexpr(S == setting::allocation_pooling) {
+      return _allocation_pooling;
+    } else if constexpr(S == setting::allocation_pool_max_cached_size) {
+      return _allocation_pool_max_cached_size;
+    } else if constexpr(S == setting::batch_submission) {
+      return _batch_submission;
+    } else if constexpr(S == setting::memcpy_model_file) {
+      return _memcpy_model_file;
+    } else if constexpr(S == setting::omp_schedule) {
+      return _omp_schedule;
+    } else if constexpr(S == setting::omp_thread_pool) {
+      return _omp_thread_pool;
+    } else if constexpr(S == setting::omp_pin_threads) {
+      return _omp_pin_threads;
+    } else if constexpr(S == setting::omp_numa_placement) {
+      return _omp_numa_placement;
+    } else if constexpr(S == setting::omp_numa_devices) {
+      return _omp_numa_devices;
+    } else if constexpr(S == setting::omp_sub_group_size) {
+      return _omp_sub_group_size;
+    } else if constexpr(S == setting::omp_local_size_specialization) {
+      return _omp_local_size_specialization;
+    } else if constexpr(S == setting::trace_file) {
+      return _trace_file;
+    } else if constexpr(S == setting::trace_buffer_size) {
+      return _trace_buffer_size;
     }
     return typename setting_trait<S>::type{};
   }
@@ -226,6 +333,56 @@ public:
         get_environment_variable_or_default<setting::ocl_no_shared_context>(false);
     _ocl_show_all_devices =
         get_environment_variable_or_default<setting::ocl_show_all_devices>(false);
+    _placement_strategy =
+        get_environment_variable_or_default<setting::placement_strategy>(
+            placement_strategy::cost_model);
+    _placement_queue_depth_cost = get_environment_variable_or_default<
+        setting::placement_queue_depth_cost>(1e-5);
+    _sscp_jit_cache_directory = get_environment_variable_or_default<
+        setting::sscp_jit_cache_directory>(std::string{});
+    // Maximum cache size in MiB
+    _sscp_jit_cache_max_size = get_environment_variable_or_default<
+        setting::sscp_jit_cache_max_size>(1024);
+    // 0 selects the number of hardware threads
+    _sscp_jit_max_concurrent_compilations = get_environment_variable_or_default<
+        setting::sscp_jit_max_concurrent_compilations>(0);
+    // 0 disables argument specialization
+    _sscp_jit_argument_specialization_threshold =
+        get_environment_variable_or_default<
+            setting::sscp_jit_argument_specialization_threshold>(0);
+    _sscp_jit_per_kernel_compilation = get_environment_variable_or_default<
+        setting::sscp_jit_per_kernel_compilation>(true);
+    _allocation_pooling =
+        get_environment_variable_or_default<setting::allocation_pooling>(false);
+    // Maximum size of cached, currently unused allocations per device in MiB
+    _allocation_pool_max_cached_size = get_environment_variable_or_default<
+        setting::allocation_pool_max_cached_size>(1024);
+    _batch_submission =
+        get_environment_variable_or_default<setting::batch_submission>(false);
+    _memcpy_model_file =
+        get_environment_variable_or_default<setting::memcpy_model_file>(
+            std::string{});
+    _omp_schedule = get_environment_variable_or_default<setting::omp_schedule>(
+        omp_schedule_type::static_schedule);
+    _omp_thread_pool =
+        get_environment_variable_or_default<setting::omp_thread_pool>(false);
+    _omp_pin_threads =
+        get_environment_variable_or_default<setting::omp_pin_threads>(false);
+    _omp_numa_placement =
+        get_environment_variable_or_default<setting::omp_numa_placement>(
+            omp_numa_placement::none);
+    _omp_numa_devices =
+        get_environment_variable_or_default<setting::omp_numa_devices>(false);
+    // 0 selects the native vector width of the CPU
+    _omp_sub_group_size =
+        get_environment_variable_or_default<setting::omp_sub_group_size>(1);
+    _omp_local_size_specialization = get_environment_variable_or_default<
+        setting::omp_local_size_specialization>(true);
+    _trace_file =
+        get_environment_variable_or_default<setting::trace_file>(std::string{});
+    // Number of events retained per thread
+    _trace_buffer_size =
+        get_environment_variable_or_default<setting::trace_buffer_size>(65536);
   }
 
 private:
@@ -252,6 +409,26 @@ private:
   visibility_mask_t _visibility_mask;
   bool _ocl_no_shared_context;
   bool _ocl_show_all_devices;
+  placement_strategy _placement_strategy;
+  double _placement_queue_depth_cost;
+  std::string _sscp_jit_cache_directory;
+  std::size_t _sscp_jit_cache_max_size;
+  std::size_t _sscp_jit_max_concurrent_compilations;
+  std::size_t _sscp_jit_argument_specialization_threshold;
+  bool _sscp_jit_per_kernel_compilation;
+  bool _allocation_pooling;
+  std::size_t _allocation_pool_max_cached_size;
+  bool _batch_submission;
+  std::string _memcpy_model_file;
+  omp_schedule_type _omp_schedule;
+  bool _omp_thread_pool;
+  bool _omp_pin_threads;
+  omp_numa_placement _omp_numa_placement;
+  bool _omp_numa_devices;
+  std::size_t _omp_sub_group_size;
+  bool _omp_local_size_specialization;
+  std::string _trace_file;
+  std::size_t _trace_buffer_size;
 };
 
 }
@@ -0,0 +1,67 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HIPSYCL_SUBMISSION_BATCH_HPP
+#define HIPSYCL_SUBMISSION_BATCH_HPP
+
+#include "hipSYCL/common/small_vector.hpp"
+
+namespace hipsycl {
+namespace rt {
+
+class backend_executor;
+
+/// Marks a scope in the runtime thread in which a batch of nodes is
+/// submitted. While a submission_batch is active, executors may defer
+/// creating completion events and let consecutive operations share them.
+/// Executors that make use of this register with the active batch, and are
+/// finalized when the batch goes out of scope.
+///
+/// Batches are thread-local; nesting is allowed, in which case the
+/// outermost batch is used.
+class submission_batch {
+public:
+  submission_batch();
+  ~submission_batch();
+
+  submission_batch(const submission_batch&) = delete;
+  submission_batch& operator=(const submission_batch&) = delete;
+
+  void register_executor(backend_executor* executor);
+
+  /// \return The active batch of the calling thread, or nullptr
+  /// if no batch is active.
+  static submission_batch* get_current();
+private:
+  bool _is_outermost;
+  common::auto_small_vector<backend_executor*> _executors;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,82 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HIPSYCL_RT_TRACING_HPP
+#define HIPSYCL_RT_TRACING_HPP
+
+#include <cstdint>
+
+#include "device_id.hpp"
+
+namespace hipsycl {
+namespace rt {
+
+class dag_node;
+class memcpy_operation;
+
+/// Opt-in tracing of the lifecycle of DAG nodes, enabled by setting
+/// ACPP_RT_TRACE_FILE. Each thread records events into its own ring buffer
+/// of bounded size, so that recording an event does not need to synchronize
+/// with other threads. All buffers are written to the trace file in the
+/// Chrome trace event format at exit, which can be viewed with Perfetto or
+/// chrome://tracing.
+///
+/// Execution of nodes on the device is derived from the start and finish
+/// timestamp instrumentations, which are requested for all nodes while
+/// tracing is enabled. It is recorded once the node is destroyed, and shown
+/// on one track per execution lane.
+namespace tracing {
+
+/// Must be invoked before any events are recorded. Subsequent invocations
+/// have no effect.
+void initialize();
+
+bool is_enabled();
+
+/// \return A new unique node id. Ids start at 1, 0 denotes untraced nodes.
+std::uint64_t make_node_id();
+/// \return The current time in profiler_clock ticks
+std::uint64_t now();
+
+/// The following functions may only be invoked if is_enabled() is true.
+/// Timestamps are in profiler_clock ticks as returned by now().
+
+void record_build(const dag_node *node, std::uint64_t begin);
+void record_requirement_resolution(const dag_node *node, std::uint64_t begin);
+void record_lane_assignment(const dag_node *node, device_id dev,
+                            const void *lane);
+void record_submission(const dag_node *node, std::uint64_t begin);
+void record_migration(const dag_node *node, const memcpy_operation &op);
+/// Records the execution of the node on the device if it has completed.
+/// Blocks until the instrumentations are available.
+void record_execution(dag_node *node);
+
+}
+}
+}
+
+#endif
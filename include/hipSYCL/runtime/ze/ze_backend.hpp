@@ -37,6 +37,7 @@
 #include "../multi_queue_executor.hpp"
 
 #include "ze_allocator.hpp"
+#include "../caching_allocator.hpp"
 #include "ze_hardware_manager.hpp"
 
 namespace hipsycl {
@@ -66,6 +67,8 @@ private:
   std::unique_ptr<ze_hardware_manager> _hardware_manager;
   std::unique_ptr<multi_queue_executor> _executor;
   mutable std::vector<ze_allocator> _allocators;
+  // One per device; empty if allocation pooling is disabled
+  std::vector<std::unique_ptr<caching_allocator>> _caching_allocators;
 };
 
 
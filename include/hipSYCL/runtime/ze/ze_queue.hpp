@@ -56,11 +56,14 @@ public:
   /// Inserts an event into the stream
   virtual std::shared_ptr<dag_node_event> insert_event() override;
   virtual std::shared_ptr<dag_node_event> create_queue_completion_event() override;
+  virtual std::shared_ptr<dag_node_event> create_batch_completion_event() override;
 
   virtual result submit_memcpy(memcpy_operation&, dag_node_ptr) override;
   virtual result submit_kernel(kernel_operation&, dag_node_ptr) override;
   virtual result submit_prefetch(prefetch_operation &, dag_node_ptr) override;
   virtual result submit_memset(memset_operation&, dag_node_ptr) override;
+
+  virtual bool prepare_kernel(kernel_operation&, dag_node_ptr) override;
   
   /// Causes the queue to wait until an event on another queue has occured.
   /// the other queue must be from the same backend
@@ -96,7 +99,22 @@ public:
       std::size_t *arg_sizes, std::size_t num_args,
       const glue::kernel_configuration &config);
 
+  // Starts compiling the SSCP kernel in the background if necessary.
+  // Returns true if the code object is available.
+  bool prepare_sscp_kernel(const kernel_operation &op, hcf_object_id hcf_object,
+                           const std::string &kernel_name,
+                           unsigned local_mem_size,
+                           const glue::kernel_configuration &config);
+
 private:
+  result request_sscp_code_object(const kernel_operation &op,
+                                  hcf_object_id hcf_object,
+                                  const std::string &kernel_name,
+                                  unsigned local_mem_size,
+                                  const glue::kernel_configuration &config,
+                                  kernel_cache::code_object_future &code_object_out,
+                                  const hcf_kernel_info *&kernel_info_out);
+
   const std::vector<std::shared_ptr<dag_node_event>>&
   get_enqueued_synchronization_ops() const;
   
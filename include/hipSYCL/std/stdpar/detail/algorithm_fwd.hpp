@@ -29,6 +29,8 @@
 #define HIPSYCL_PSTL_ALGORITHM_FWD_HPP
 
 
+#include <utility>
+
 #include "execution_fwd.hpp"
 #include "stdpar_defs.hpp"
 
@@ -67,6 +69,29 @@ HIPSYCL_STDPAR_ENTRYPOINT ForwardIt2 copy_if(hipsycl::stdpar::par_unseq,
                                              ForwardIt2 d_first,
                                              UnaryPredicate pred);
 
+template <class ForwardIt1, class ForwardIt2, class UnaryPredicate>
+HIPSYCL_STDPAR_ENTRYPOINT ForwardIt2
+remove_copy_if(hipsycl::stdpar::par_unseq, ForwardIt1 first, ForwardIt1 last,
+               ForwardIt2 d_first, UnaryPredicate pred);
+
+template <class ForwardIt1, class ForwardIt2, class ForwardIt3,
+          class UnaryPredicate>
+HIPSYCL_STDPAR_ENTRYPOINT std::pair<ForwardIt2, ForwardIt3>
+partition_copy(hipsycl::stdpar::par_unseq, ForwardIt1 first, ForwardIt1 last,
+               ForwardIt2 d_first_true, ForwardIt3 d_first_false,
+               UnaryPredicate p);
+
+template <class ForwardIt1, class ForwardIt2>
+HIPSYCL_STDPAR_ENTRYPOINT ForwardIt2 unique_copy(hipsycl::stdpar::par_unseq,
+                                                 ForwardIt1 first,
+                                                 ForwardIt1 last,
+                                                 ForwardIt2 d_first);
+
+template <class ForwardIt1, class ForwardIt2, class BinaryPredicate>
+HIPSYCL_STDPAR_ENTRYPOINT ForwardIt2
+unique_copy(hipsycl::stdpar::par_unseq, ForwardIt1 first, ForwardIt1 last,
+            ForwardIt2 d_first, BinaryPredicate p);
+
 template <class ForwardIt1, class Size, class ForwardIt2>
 HIPSYCL_STDPAR_ENTRYPOINT ForwardIt2 copy_n(hipsycl::stdpar::par_unseq,
                                             ForwardIt1 first, Size count,
@@ -140,6 +165,23 @@ HIPSYCL_STDPAR_ENTRYPOINT
 bool none_of(hipsycl::stdpar::par_unseq, ForwardIt first, ForwardIt last,
             UnaryPredicate p );
 
+template <class RandomIt>
+HIPSYCL_STDPAR_ENTRYPOINT void sort(hipsycl::stdpar::par_unseq, RandomIt first,
+                                    RandomIt last);
+
+template <class RandomIt, class Compare>
+HIPSYCL_STDPAR_ENTRYPOINT void sort(hipsycl::stdpar::par_unseq, RandomIt first,
+                                    RandomIt last, Compare comp);
+
+template <class RandomIt>
+HIPSYCL_STDPAR_ENTRYPOINT void stable_sort(hipsycl::stdpar::par_unseq,
+                                           RandomIt first, RandomIt last);
+
+template <class RandomIt, class Compare>
+HIPSYCL_STDPAR_ENTRYPOINT void stable_sort(hipsycl::stdpar::par_unseq,
+                                           RandomIt first, RandomIt last,
+                                           Compare comp);
+
 }
 
 #endif
@@ -66,6 +66,49 @@ HIPSYCL_STDPAR_ENTRYPOINT T reduce(hipsycl::stdpar::par_unseq, ForwardIt first,
 template <class ForwardIt, class T, class BinaryOp>
 HIPSYCL_STDPAR_ENTRYPOINT T reduce(hipsycl::stdpar::par_unseq, ForwardIt first,
                                    ForwardIt last, T init, BinaryOp binary_op);
+
+template <class ForwardIt1, class ForwardIt2>
+HIPSYCL_STDPAR_ENTRYPOINT ForwardIt2
+inclusive_scan(hipsycl::stdpar::par_unseq, ForwardIt1 first, ForwardIt1 last,
+               ForwardIt2 d_first);
+
+template <class ForwardIt1, class ForwardIt2, class BinaryOp>
+HIPSYCL_STDPAR_ENTRYPOINT ForwardIt2
+inclusive_scan(hipsycl::stdpar::par_unseq, ForwardIt1 first, ForwardIt1 last,
+               ForwardIt2 d_first, BinaryOp op);
+
+template <class ForwardIt1, class ForwardIt2, class BinaryOp, class T>
+HIPSYCL_STDPAR_ENTRYPOINT ForwardIt2
+inclusive_scan(hipsycl::stdpar::par_unseq, ForwardIt1 first, ForwardIt1 last,
+               ForwardIt2 d_first, BinaryOp op, T init);
+
+template <class ForwardIt1, class ForwardIt2, class T>
+HIPSYCL_STDPAR_ENTRYPOINT ForwardIt2
+exclusive_scan(hipsycl::stdpar::par_unseq, ForwardIt1 first, ForwardIt1 last,
+               ForwardIt2 d_first, T init);
+
+template <class ForwardIt1, class ForwardIt2, class T, class BinaryOp>
+HIPSYCL_STDPAR_ENTRYPOINT ForwardIt2
+exclusive_scan(hipsycl::stdpar::par_unseq, ForwardIt1 first, ForwardIt1 last,
+               ForwardIt2 d_first, T init, BinaryOp op);
+
+template <class ForwardIt1, class ForwardIt2, class BinaryOp,
+          class UnaryTransformOp>
+HIPSYCL_STDPAR_ENTRYPOINT ForwardIt2 transform_inclusive_scan(
+    hipsycl::stdpar::par_unseq, ForwardIt1 first, ForwardIt1 last,
+    ForwardIt2 d_first, BinaryOp op, UnaryTransformOp transform);
+
+template <class ForwardIt1, class ForwardIt2, class BinaryOp,
+          class UnaryTransformOp, class T>
+HIPSYCL_STDPAR_ENTRYPOINT ForwardIt2 transform_inclusive_scan(
+    hipsycl::stdpar::par_unseq, ForwardIt1 first, ForwardIt1 last,
+    ForwardIt2 d_first, BinaryOp op, UnaryTransformOp transform, T init);
+
+template <class ForwardIt1, class ForwardIt2, class T, class BinaryOp,
+          class UnaryTransformOp>
+HIPSYCL_STDPAR_ENTRYPOINT ForwardIt2 transform_exclusive_scan(
+    hipsycl::stdpar::par_unseq, ForwardIt1 first, ForwardIt1 last,
+    ForwardIt2 d_first, T init, BinaryOp op, UnaryTransformOp transform);
 }
 
 #endif
@@ -61,15 +61,25 @@ struct replace {};
 struct replace_if {};
 struct replace_copy {};
 struct replace_copy_if {};
+struct remove_copy_if {};
+struct partition_copy {};
+struct unique_copy {};
 struct find {};
 struct find_if {};
 struct find_if_not {};
 struct all_of {};
 struct any_of {};
 struct none_of {};
+struct sort {};
+struct stable_sort {};
 
 struct transform_reduce {};
 struct reduce {};
+
+struct inclusive_scan {};
+struct exclusive_scan {};
+struct transform_inclusive_scan {};
+struct transform_exclusive_scan {};
 } // namespace algorithm_type
 
 
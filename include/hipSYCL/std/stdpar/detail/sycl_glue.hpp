@@ -51,6 +51,7 @@
 #include "allocation_map.hpp"
 #include "offload_heuristic_db.hpp"
 #include "hipSYCL/runtime/settings.hpp"
+#include "hipSYCL/common/debug.hpp"
 #include "hipSYCL/sycl/info/device.hpp"
 
 extern "C" void *__libc_malloc(size_t);
@@ -82,6 +83,12 @@ private:
         _host_scratch_cache{algorithms::util::allocation_type::host} {}
 
   ~stdpar_tls_runtime() {
+    print_scratch_cache_statistics("device", _device_scratch_cache);
+    print_scratch_cache_statistics("shared", _shared_scratch_cache);
+    print_scratch_cache_statistics("host", _host_scratch_cache);
+
+    // Scratch allocations might still be used by operations in flight
+    _queue.wait();
     _device_scratch_cache.purge();
     _shared_scratch_cache.purge();
     _host_scratch_cache.purge();
@@ -103,6 +110,18 @@ private:
     return batch_counter;
   }
 
+  static void print_scratch_cache_statistics(
+      const char *name, const algorithms::util::allocation_cache &cache) {
+    auto stats = cache.get_statistics();
+    if(stats.num_hits + stats.num_misses > 0) {
+      HIPSYCL_DEBUG_INFO << "[stdpar] " << name << " scratch cache: "
+                         << stats.num_hits << " hits, " << stats.num_misses
+                         << " misses (hit rate " << stats.get_hit_rate()
+                         << "), " << stats.num_evictions << " evictions"
+                         << std::endl;
+    }
+  }
+
   void reset_num_outstanding_operations() {
     _outstanding_offloaded_operations = 0;
   }
@@ -158,6 +177,12 @@ public:
 #endif
     reset_num_outstanding_operations();
     ++offloading_batch_counter();
+
+    // All offloaded operations have completed, so scratch allocations
+    // that were evicted in the meantime can be freed now.
+    _device_scratch_cache.release_evicted_allocations();
+    _shared_scratch_cache.release_evicted_allocations();
+    _host_scratch_cache.release_evicted_allocations();
   }
 
   template<algorithms::util::allocation_type AT>
@@ -190,6 +215,25 @@ public:
   }
 };
 
+/// Runs an algorithm whose output size depends on the input data and
+/// waits for it to complete. f is invoked with a device scratch group and
+/// a host-accessible std::size_t* that the algorithm stores the output
+/// size in; the output size is returned.
+template <class F>
+std::size_t run_and_wait_for_output_size(hipsycl::sycl::queue &q, F &&f) {
+  auto output_scratch_group =
+      stdpar_tls_runtime::get()
+          .make_scratch_group<algorithms::util::allocation_type::host>();
+  auto device_scratch_group =
+      stdpar_tls_runtime::get()
+          .make_scratch_group<algorithms::util::allocation_type::device>();
+
+  std::size_t *output_size = output_scratch_group.obtain<std::size_t>(1);
+  f(device_scratch_group, output_size);
+  q.wait();
+  return *output_size;
+}
+
 }
 
 #if defined(__clang__) && defined(HIPSYCL_LIBKERNEL_IS_DEVICE_PASS_HOST) &&    \
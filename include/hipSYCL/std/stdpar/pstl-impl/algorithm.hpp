@@ -30,6 +30,8 @@
 
 #include <algorithm>
 #include <iterator>
+#include <type_traits>
+#include <utility>
 
 #include "../detail/execution_fwd.hpp"
 #include "../detail/sycl_glue.hpp"
@@ -155,9 +157,20 @@ ForwardIt2 copy_if(hipsycl::stdpar::par_unseq,
                    ForwardIt2 d_first,
                    UnaryPredicate pred) {
   auto offloader = [&](auto& queue){
+    if(first == last)
+      return d_first;
+
+    // The output end depends on the number of selected elements,
+    // so we have to wait for the result.
+    std::size_t num_copied =
+        hipsycl::stdpar::detail::run_and_wait_for_output_size(
+            queue, [&](auto &scratch_group, std::size_t *output_size) {
+              hipsycl::algorithms::copy_if(queue, scratch_group, first, last,
+                                           d_first, pred, output_size);
+            });
+
     ForwardIt2 d_last = d_first;
-    std::advance(d_last, std::distance(first, last));
-    hipsycl::algorithms::copy_if(queue, first, last, d_first, pred);
+    std::advance(d_last, num_copied);
     return d_last;
   };
 
@@ -166,10 +179,148 @@ ForwardIt2 copy_if(hipsycl::stdpar::par_unseq,
                         d_first, pred);
   };
 
-  HIPSYCL_STDPAR_OFFLOAD(hipsycl::stdpar::algorithm_type::copy_if{},
-                         std::distance(first, last), ForwardIt2, offloader,
-                         fallback, first,
-                         HIPSYCL_STDPAR_NO_PTR_VALIDATION(last), d_first, pred);
+  HIPSYCL_STDPAR_BLOCKING_OFFLOAD(hipsycl::stdpar::algorithm_type::copy_if{},
+                                  std::distance(first, last), ForwardIt2,
+                                  offloader, fallback, first,
+                                  HIPSYCL_STDPAR_NO_PTR_VALIDATION(last),
+                                  d_first, pred);
+}
+
+template <class ForwardIt1, class ForwardIt2, class UnaryPredicate>
+HIPSYCL_STDPAR_ENTRYPOINT
+ForwardIt2 remove_copy_if(hipsycl::stdpar::par_unseq,
+                          ForwardIt1 first, ForwardIt1 last,
+                          ForwardIt2 d_first, UnaryPredicate pred) {
+  auto offloader = [&](auto& queue){
+    if(first == last)
+      return d_first;
+
+    std::size_t num_copied =
+        hipsycl::stdpar::detail::run_and_wait_for_output_size(
+            queue, [&](auto &scratch_group, std::size_t *output_size) {
+              hipsycl::algorithms::remove_copy_if(queue, scratch_group, first,
+                                                  last, d_first, pred,
+                                                  output_size);
+            });
+
+    ForwardIt2 d_last = d_first;
+    std::advance(d_last, num_copied);
+    return d_last;
+  };
+
+  auto fallback = [&]() {
+    return std::remove_copy_if(hipsycl::stdpar::par_unseq_host_fallback, first,
+                               last, d_first, pred);
+  };
+
+  HIPSYCL_STDPAR_BLOCKING_OFFLOAD(
+      hipsycl::stdpar::algorithm_type::remove_copy_if{},
+      std::distance(first, last), ForwardIt2, offloader, fallback, first,
+      HIPSYCL_STDPAR_NO_PTR_VALIDATION(last), d_first, pred);
+}
+
+template <class ForwardIt1, class ForwardIt2, class ForwardIt3,
+          class UnaryPredicate>
+HIPSYCL_STDPAR_ENTRYPOINT
+std::pair<ForwardIt2, ForwardIt3>
+partition_copy(hipsycl::stdpar::par_unseq, ForwardIt1 first, ForwardIt1 last,
+               ForwardIt2 d_first_true, ForwardIt3 d_first_false,
+               UnaryPredicate p) {
+  auto offloader = [&](auto& queue){
+    if(first == last)
+      return std::make_pair(d_first_true, d_first_false);
+
+    std::size_t num_true =
+        hipsycl::stdpar::detail::run_and_wait_for_output_size(
+            queue, [&](auto &scratch_group, std::size_t *output_size) {
+              hipsycl::algorithms::partition_copy(queue, scratch_group, first,
+                                                  last, d_first_true,
+                                                  d_first_false, p,
+                                                  output_size);
+            });
+
+    ForwardIt2 d_last_true = d_first_true;
+    ForwardIt3 d_last_false = d_first_false;
+    std::advance(d_last_true, num_true);
+    std::advance(d_last_false, std::distance(first, last) - num_true);
+    return std::make_pair(d_last_true, d_last_false);
+  };
+
+  auto fallback = [&]() {
+    return std::partition_copy(hipsycl::stdpar::par_unseq_host_fallback, first,
+                               last, d_first_true, d_first_false, p);
+  };
+
+  // The macro cannot take a template-id with multiple arguments
+  using result_type = std::pair<ForwardIt2, ForwardIt3>;
+  HIPSYCL_STDPAR_BLOCKING_OFFLOAD(
+      hipsycl::stdpar::algorithm_type::partition_copy{},
+      std::distance(first, last), result_type, offloader, fallback, first,
+      HIPSYCL_STDPAR_NO_PTR_VALIDATION(last), d_first_true, d_first_false, p);
+}
+
+template <class ForwardIt1, class ForwardIt2, class BinaryPredicate>
+HIPSYCL_STDPAR_ENTRYPOINT
+ForwardIt2 unique_copy(hipsycl::stdpar::par_unseq,
+                       ForwardIt1 first, ForwardIt1 last,
+                       ForwardIt2 d_first, BinaryPredicate p) {
+  auto offloader = [&](auto& queue){
+    if(first == last)
+      return d_first;
+
+    std::size_t num_copied =
+        hipsycl::stdpar::detail::run_and_wait_for_output_size(
+            queue, [&](auto &scratch_group, std::size_t *output_size) {
+              hipsycl::algorithms::unique_copy(queue, scratch_group, first,
+                                               last, d_first, p, output_size);
+            });
+
+    ForwardIt2 d_last = d_first;
+    std::advance(d_last, num_copied);
+    return d_last;
+  };
+
+  auto fallback = [&]() {
+    return std::unique_copy(hipsycl::stdpar::par_unseq_host_fallback, first,
+                            last, d_first, p);
+  };
+
+  HIPSYCL_STDPAR_BLOCKING_OFFLOAD(
+      hipsycl::stdpar::algorithm_type::unique_copy{},
+      std::distance(first, last), ForwardIt2, offloader, fallback, first,
+      HIPSYCL_STDPAR_NO_PTR_VALIDATION(last), d_first, p);
+}
+
+template <class ForwardIt1, class ForwardIt2>
+HIPSYCL_STDPAR_ENTRYPOINT
+ForwardIt2 unique_copy(hipsycl::stdpar::par_unseq,
+                       ForwardIt1 first, ForwardIt1 last,
+                       ForwardIt2 d_first) {
+  auto offloader = [&](auto& queue){
+    if(first == last)
+      return d_first;
+
+    std::size_t num_copied =
+        hipsycl::stdpar::detail::run_and_wait_for_output_size(
+            queue, [&](auto &scratch_group, std::size_t *output_size) {
+              hipsycl::algorithms::unique_copy(queue, scratch_group, first,
+                                               last, d_first, output_size);
+            });
+
+    ForwardIt2 d_last = d_first;
+    std::advance(d_last, num_copied);
+    return d_last;
+  };
+
+  auto fallback = [&]() {
+    return std::unique_copy(hipsycl::stdpar::par_unseq_host_fallback, first,
+                            last, d_first);
+  };
+
+  HIPSYCL_STDPAR_BLOCKING_OFFLOAD(
+      hipsycl::stdpar::algorithm_type::unique_copy{},
+      std::distance(first, last), ForwardIt2, offloader, fallback, first,
+      HIPSYCL_STDPAR_NO_PTR_VALIDATION(last), d_first);
 }
 
 template<class ForwardIt1, class Size, class ForwardIt2 >
@@ -464,6 +615,132 @@ bool none_of(hipsycl::stdpar::par_unseq, ForwardIt first, ForwardIt last,
                                   HIPSYCL_STDPAR_NO_PTR_VALIDATION(last), p);
 }
 
+template <class RandomIt>
+HIPSYCL_STDPAR_ENTRYPOINT
+void sort(hipsycl::stdpar::par_unseq, RandomIt first, RandomIt last) {
+  auto offloader = [&](auto& queue) {
+    using value_type = typename std::iterator_traits<RandomIt>::value_type;
+    if constexpr (std::is_trivially_copyable_v<value_type>) {
+      auto scratch_group =
+          hipsycl::stdpar::detail::stdpar_tls_runtime::get()
+              .make_scratch_group<
+                  hipsycl::algorithms::util::allocation_type::device>();
+      hipsycl::algorithms::sort(queue, scratch_group, first, last);
+    } else {
+      // The device sorting algorithms need to copy elements into
+      // scratch memory, which is only possible for trivially
+      // copyable types.
+      queue.wait();
+      std::sort(hipsycl::stdpar::par_unseq_host_fallback, first, last);
+    }
+  };
+
+  auto fallback = [&]() {
+    std::sort(hipsycl::stdpar::par_unseq_host_fallback, first, last);
+  };
+
+  HIPSYCL_STDPAR_OFFLOAD_NORET(hipsycl::stdpar::algorithm_type::sort{},
+                               std::distance(first, last), offloader, fallback,
+                               first, HIPSYCL_STDPAR_NO_PTR_VALIDATION(last));
+}
+
+template <class RandomIt, class Compare>
+HIPSYCL_STDPAR_ENTRYPOINT
+void sort(hipsycl::stdpar::par_unseq, RandomIt first, RandomIt last,
+          Compare comp) {
+  auto offloader = [&](auto& queue) {
+    using value_type = typename std::iterator_traits<RandomIt>::value_type;
+    if constexpr (std::is_trivially_copyable_v<value_type>) {
+      auto scratch_group =
+          hipsycl::stdpar::detail::stdpar_tls_runtime::get()
+              .make_scratch_group<
+                  hipsycl::algorithms::util::allocation_type::device>();
+      hipsycl::algorithms::sort(queue, scratch_group, first, last,
+                                 comp);
+    } else {
+      // The device sorting algorithms need to copy elements into
+      // scratch memory, which is only possible for trivially
+      // copyable types.
+      queue.wait();
+      std::sort(hipsycl::stdpar::par_unseq_host_fallback, first, last,
+                comp);
+    }
+  };
+
+  auto fallback = [&]() {
+    std::sort(hipsycl::stdpar::par_unseq_host_fallback, first, last,
+              comp);
+  };
+
+  HIPSYCL_STDPAR_OFFLOAD_NORET(hipsycl::stdpar::algorithm_type::sort{},
+                               std::distance(first, last), offloader, fallback,
+                               first, HIPSYCL_STDPAR_NO_PTR_VALIDATION(last),
+                               comp);
+}
+
+template <class RandomIt>
+HIPSYCL_STDPAR_ENTRYPOINT
+void stable_sort(hipsycl::stdpar::par_unseq, RandomIt first, RandomIt last) {
+  auto offloader = [&](auto& queue) {
+    using value_type = typename std::iterator_traits<RandomIt>::value_type;
+    if constexpr (std::is_trivially_copyable_v<value_type>) {
+      auto scratch_group =
+          hipsycl::stdpar::detail::stdpar_tls_runtime::get()
+              .make_scratch_group<
+                  hipsycl::algorithms::util::allocation_type::device>();
+      hipsycl::algorithms::stable_sort(queue, scratch_group, first, last);
+    } else {
+      // The device sorting algorithms need to copy elements into
+      // scratch memory, which is only possible for trivially
+      // copyable types.
+      queue.wait();
+      std::stable_sort(hipsycl::stdpar::par_unseq_host_fallback, first, last);
+    }
+  };
+
+  auto fallback = [&]() {
+    std::stable_sort(hipsycl::stdpar::par_unseq_host_fallback, first, last);
+  };
+
+  HIPSYCL_STDPAR_OFFLOAD_NORET(hipsycl::stdpar::algorithm_type::stable_sort{},
+                               std::distance(first, last), offloader, fallback,
+                               first, HIPSYCL_STDPAR_NO_PTR_VALIDATION(last));
+}
+
+template <class RandomIt, class Compare>
+HIPSYCL_STDPAR_ENTRYPOINT
+void stable_sort(hipsycl::stdpar::par_unseq, RandomIt first, RandomIt last,
+                 Compare comp) {
+  auto offloader = [&](auto& queue) {
+    using value_type = typename std::iterator_traits<RandomIt>::value_type;
+    if constexpr (std::is_trivially_copyable_v<value_type>) {
+      auto scratch_group =
+          hipsycl::stdpar::detail::stdpar_tls_runtime::get()
+              .make_scratch_group<
+                  hipsycl::algorithms::util::allocation_type::device>();
+      hipsycl::algorithms::stable_sort(queue, scratch_group, first, last,
+                                        comp);
+    } else {
+      // The device sorting algorithms need to copy elements into
+      // scratch memory, which is only possible for trivially
+      // copyable types.
+      queue.wait();
+      std::stable_sort(hipsycl::stdpar::par_unseq_host_fallback, first, last,
+                       comp);
+    }
+  };
+
+  auto fallback = [&]() {
+    std::stable_sort(hipsycl::stdpar::par_unseq_host_fallback, first, last,
+                     comp);
+  };
+
+  HIPSYCL_STDPAR_OFFLOAD_NORET(hipsycl::stdpar::algorithm_type::stable_sort{},
+                               std::distance(first, last), offloader, fallback,
+                               first, HIPSYCL_STDPAR_NO_PTR_VALIDATION(last),
+                               comp);
+}
+
 }
 
 #endif
@@ -296,6 +296,239 @@ T reduce(hipsycl::stdpar::par_unseq, ForwardIt first,
       binary_op);
 }
 
+template <class ForwardIt1, class ForwardIt2>
+HIPSYCL_STDPAR_ENTRYPOINT
+ForwardIt2 inclusive_scan(hipsycl::stdpar::par_unseq, ForwardIt1 first,
+                          ForwardIt1 last, ForwardIt2 d_first) {
+  auto offloader = [&](auto& queue) {
+    ForwardIt2 d_last = d_first;
+    std::advance(d_last, std::distance(first, last));
+    // Note: As for reductions, reusing the scratch memory after the end of
+    // this scope is safe since it can only be handed out again to operations
+    // on the same thread-local in-order queue.
+    auto scratch_group =
+        hipsycl::stdpar::detail::stdpar_tls_runtime::get()
+            .make_scratch_group<
+                hipsycl::algorithms::util::allocation_type::device>();
+    hipsycl::algorithms::inclusive_scan(queue, scratch_group, first, last,
+                                        d_first);
+    return d_last;
+  };
+
+  auto fallback = [&]() {
+    return std::inclusive_scan(hipsycl::stdpar::par_unseq_host_fallback, first,
+                               last, d_first);
+  };
+
+  HIPSYCL_STDPAR_OFFLOAD(hipsycl::stdpar::algorithm_type::inclusive_scan{},
+                         std::distance(first, last), ForwardIt2, offloader,
+                         fallback, first, HIPSYCL_STDPAR_NO_PTR_VALIDATION(last),
+                         d_first);
+}
+
+template <class ForwardIt1, class ForwardIt2, class BinaryOp>
+HIPSYCL_STDPAR_ENTRYPOINT
+ForwardIt2 inclusive_scan(hipsycl::stdpar::par_unseq, ForwardIt1 first,
+                          ForwardIt1 last, ForwardIt2 d_first, BinaryOp op) {
+  auto offloader = [&](auto& queue) {
+    ForwardIt2 d_last = d_first;
+    std::advance(d_last, std::distance(first, last));
+    auto scratch_group =
+        hipsycl::stdpar::detail::stdpar_tls_runtime::get()
+            .make_scratch_group<
+                hipsycl::algorithms::util::allocation_type::device>();
+    hipsycl::algorithms::inclusive_scan(queue, scratch_group, first, last,
+                                        d_first, op);
+    return d_last;
+  };
+
+  auto fallback = [&]() {
+    return std::inclusive_scan(hipsycl::stdpar::par_unseq_host_fallback, first,
+                               last, d_first, op);
+  };
+
+  HIPSYCL_STDPAR_OFFLOAD(hipsycl::stdpar::algorithm_type::inclusive_scan{},
+                         std::distance(first, last), ForwardIt2, offloader,
+                         fallback, first, HIPSYCL_STDPAR_NO_PTR_VALIDATION(last),
+                         d_first, op);
+}
+
+template <class ForwardIt1, class ForwardIt2, class BinaryOp, class T>
+HIPSYCL_STDPAR_ENTRYPOINT
+ForwardIt2 inclusive_scan(hipsycl::stdpar::par_unseq, ForwardIt1 first,
+                          ForwardIt1 last, ForwardIt2 d_first, BinaryOp op,
+                          T init) {
+  auto offloader = [&](auto& queue) {
+    ForwardIt2 d_last = d_first;
+    std::advance(d_last, std::distance(first, last));
+    auto scratch_group =
+        hipsycl::stdpar::detail::stdpar_tls_runtime::get()
+            .make_scratch_group<
+                hipsycl::algorithms::util::allocation_type::device>();
+    hipsycl::algorithms::inclusive_scan(queue, scratch_group, first, last,
+                                        d_first, op, init);
+    return d_last;
+  };
+
+  auto fallback = [&]() {
+    return std::inclusive_scan(hipsycl::stdpar::par_unseq_host_fallback, first,
+                               last, d_first, op, init);
+  };
+
+  HIPSYCL_STDPAR_OFFLOAD(hipsycl::stdpar::algorithm_type::inclusive_scan{},
+                         std::distance(first, last), ForwardIt2, offloader,
+                         fallback, first, HIPSYCL_STDPAR_NO_PTR_VALIDATION(last),
+                         d_first, op, init);
+}
+
+template <class ForwardIt1, class ForwardIt2, class T>
+HIPSYCL_STDPAR_ENTRYPOINT
+ForwardIt2 exclusive_scan(hipsycl::stdpar::par_unseq, ForwardIt1 first,
+                          ForwardIt1 last, ForwardIt2 d_first, T init) {
+  auto offloader = [&](auto& queue) {
+    ForwardIt2 d_last = d_first;
+    std::advance(d_last, std::distance(first, last));
+    auto scratch_group =
+        hipsycl::stdpar::detail::stdpar_tls_runtime::get()
+            .make_scratch_group<
+                hipsycl::algorithms::util::allocation_type::device>();
+    hipsycl::algorithms::exclusive_scan(queue, scratch_group, first, last,
+                                        d_first, init);
+    return d_last;
+  };
+
+  auto fallback = [&]() {
+    return std::exclusive_scan(hipsycl::stdpar::par_unseq_host_fallback, first,
+                               last, d_first, init);
+  };
+
+  HIPSYCL_STDPAR_OFFLOAD(hipsycl::stdpar::algorithm_type::exclusive_scan{},
+                         std::distance(first, last), ForwardIt2, offloader,
+                         fallback, first, HIPSYCL_STDPAR_NO_PTR_VALIDATION(last),
+                         d_first, init);
+}
+
+template <class ForwardIt1, class ForwardIt2, class T, class BinaryOp>
+HIPSYCL_STDPAR_ENTRYPOINT
+ForwardIt2 exclusive_scan(hipsycl::stdpar::par_unseq, ForwardIt1 first,
+                          ForwardIt1 last, ForwardIt2 d_first, T init,
+                          BinaryOp op) {
+  auto offloader = [&](auto& queue) {
+    ForwardIt2 d_last = d_first;
+    std::advance(d_last, std::distance(first, last));
+    auto scratch_group =
+        hipsycl::stdpar::detail::stdpar_tls_runtime::get()
+            .make_scratch_group<
+                hipsycl::algorithms::util::allocation_type::device>();
+    hipsycl::algorithms::exclusive_scan(queue, scratch_group, first, last,
+                                        d_first, init, op);
+    return d_last;
+  };
+
+  auto fallback = [&]() {
+    return std::exclusive_scan(hipsycl::stdpar::par_unseq_host_fallback, first,
+                               last, d_first, init, op);
+  };
+
+  HIPSYCL_STDPAR_OFFLOAD(hipsycl::stdpar::algorithm_type::exclusive_scan{},
+                         std::distance(first, last), ForwardIt2, offloader,
+                         fallback, first, HIPSYCL_STDPAR_NO_PTR_VALIDATION(last),
+                         d_first, init, op);
+}
+
+template <class ForwardIt1, class ForwardIt2, class BinaryOp,
+          class UnaryTransformOp>
+HIPSYCL_STDPAR_ENTRYPOINT
+ForwardIt2 transform_inclusive_scan(hipsycl::stdpar::par_unseq,
+                                    ForwardIt1 first, ForwardIt1 last,
+                                    ForwardIt2 d_first, BinaryOp op,
+                                    UnaryTransformOp transform) {
+  auto offloader = [&](auto& queue) {
+    ForwardIt2 d_last = d_first;
+    std::advance(d_last, std::distance(first, last));
+    auto scratch_group =
+        hipsycl::stdpar::detail::stdpar_tls_runtime::get()
+            .make_scratch_group<
+                hipsycl::algorithms::util::allocation_type::device>();
+    hipsycl::algorithms::transform_inclusive_scan(queue, scratch_group, first,
+                                                  last, d_first, op, transform);
+    return d_last;
+  };
+
+  auto fallback = [&]() {
+    return std::transform_inclusive_scan(
+        hipsycl::stdpar::par_unseq_host_fallback, first, last, d_first, op,
+        transform);
+  };
+
+  HIPSYCL_STDPAR_OFFLOAD(
+      hipsycl::stdpar::algorithm_type::transform_inclusive_scan{},
+      std::distance(first, last), ForwardIt2, offloader, fallback, first,
+      HIPSYCL_STDPAR_NO_PTR_VALIDATION(last), d_first, op, transform);
+}
+
+template <class ForwardIt1, class ForwardIt2, class BinaryOp,
+          class UnaryTransformOp, class T>
+HIPSYCL_STDPAR_ENTRYPOINT
+ForwardIt2 transform_inclusive_scan(hipsycl::stdpar::par_unseq,
+                                    ForwardIt1 first, ForwardIt1 last,
+                                    ForwardIt2 d_first, BinaryOp op,
+                                    UnaryTransformOp transform, T init) {
+  auto offloader = [&](auto& queue) {
+    ForwardIt2 d_last = d_first;
+    std::advance(d_last, std::distance(first, last));
+    auto scratch_group =
+        hipsycl::stdpar::detail::stdpar_tls_runtime::get()
+            .make_scratch_group<
+                hipsycl::algorithms::util::allocation_type::device>();
+    hipsycl::algorithms::transform_inclusive_scan(
+        queue, scratch_group, first, last, d_first, op, transform, init);
+    return d_last;
+  };
+
+  auto fallback = [&]() {
+    return std::transform_inclusive_scan(
+        hipsycl::stdpar::par_unseq_host_fallback, first, last, d_first, op,
+        transform, init);
+  };
+
+  HIPSYCL_STDPAR_OFFLOAD(
+      hipsycl::stdpar::algorithm_type::transform_inclusive_scan{},
+      std::distance(first, last), ForwardIt2, offloader, fallback, first,
+      HIPSYCL_STDPAR_NO_PTR_VALIDATION(last), d_first, op, transform, init);
+}
+
+template <class ForwardIt1, class ForwardIt2, class T, class BinaryOp,
+          class UnaryTransformOp>
+HIPSYCL_STDPAR_ENTRYPOINT
+ForwardIt2 transform_exclusive_scan(hipsycl::stdpar::par_unseq,
+                                    ForwardIt1 first, ForwardIt1 last,
+                                    ForwardIt2 d_first, T init, BinaryOp op,
+                                    UnaryTransformOp transform) {
+  auto offloader = [&](auto& queue) {
+    ForwardIt2 d_last = d_first;
+    std::advance(d_last, std::distance(first, last));
+    auto scratch_group =
+        hipsycl::stdpar::detail::stdpar_tls_runtime::get()
+            .make_scratch_group<
+                hipsycl::algorithms::util::allocation_type::device>();
+    hipsycl::algorithms::transform_exclusive_scan(
+        queue, scratch_group, first, last, d_first, init, op, transform);
+    return d_last;
+  };
+
+  auto fallback = [&]() {
+    return std::transform_exclusive_scan(
+        hipsycl::stdpar::par_unseq_host_fallback, first, last, d_first, init,
+        op, transform);
+  };
+
+  HIPSYCL_STDPAR_OFFLOAD(
+      hipsycl::stdpar::algorithm_type::transform_exclusive_scan{},
+      std::distance(first, last), ForwardIt2, offloader, fallback, first,
+      HIPSYCL_STDPAR_NO_PTR_VALIDATION(last), d_first, init, op, transform);
+}
+
 }
 
 #endif
@@ -39,6 +39,7 @@
 #define HIPSYCL_EXT_CG_PROPERTY_RETARGET
 #define HIPSYCL_EXT_CG_PROPERTY_PREFER_GROUP_SIZE
 #define HIPSYCL_EXT_CG_PROPERTY_PREFER_EXECUTION_LANE
+#define HIPSYCL_EXT_CG_PROPERTY_HOST_SCHEDULE
 #define HIPSYCL_EXT_BUFFER_USM_INTEROP
 #define HIPSYCL_EXT_PREFETCH_HOST
 #define HIPSYCL_EXT_SYNCHRONOUS_MEM_ADVISE
@@ -38,7 +38,9 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdlib>
+#include <algorithm>
 #include <array>
+#include <new>
 
 namespace hipsycl {
 namespace sycl {
@@ -103,33 +105,46 @@ private:
   size_t _num_allocated_bytes;
 };
 
-enum class host_local_memory_origin { hipcpu, custom_threadprivate };
-
-
 /// Manages local memory on host device.
-/// Assumptions:
-/// a) Only one host kernel is active at any give time (this is enforced by hipCPU's
-///    kernel launch implementation)
-/// b) Two modes of allocations are supported: 
-///    1) Just relying on whatever hipCPU allocates
-///    as local memory. This will be one block of memory under the assumption
-///    that only one work group is active at any given time.
-///    2) Allocating a threadprivate memory region under the assumption that
-///    there is one thread per work group.
-///    For case 1), request/release pair must be called inside the kernel function, to
-///    guarantee that the hipCPU block execution context which provides local memory exists.
-///    For case 2), the request/release pair must be called inside the #pragma omp parallel block.
+///
+/// Each thread owns an arena that holds the local memory of the work group
+/// it currently executes, followed by the scratch memory that group
+/// algorithms use to exchange data between the work items of the group.
+/// The arena is sized for the kernel when it is requested, is aligned to
+/// cache lines, and is kept across kernel launches. It is only reallocated
+/// if a kernel needs more memory than any kernel before on the same thread.
+/// Its contents are not initialized.
+///
+/// The request/release pair must be called by every thread that executes
+/// work groups, before and after executing them, i.e. inside the parallel
+/// region. Only one work group may be active per thread at any given time.
 class host_local_memory
 {
 public:
-  static void request_from_threadprivate_pool(size_t num_bytes)
+  static constexpr std::size_t alignment = 128;
+  // Group algorithms reserve two slots per work item for data types that
+  // fit into a slot, and one for sub-group algorithms, see
+  // host/group_functions.hpp
+  static constexpr std::size_t group_scratch_slot_size = 16;
+
+  static constexpr std::size_t get_group_scratch_size(std::size_t group_size) {
+    return 3 * group_size * group_scratch_slot_size;
+  }
+
+  static void request_from_threadprivate_pool(size_t num_bytes,
+                                              size_t num_scratch_bytes = 0)
   {
-    alloc_threadprivate(num_bytes);
+    const std::size_t scratch_offset = round_to_alignment(num_bytes);
+    reserve(_arena, _arena_size, scratch_offset + num_scratch_bytes);
+
+    _local_mem = _arena;
+    _group_scratch = _arena + scratch_offset;
   }
 
   static void release()
   {
-    release_memory();
+    _local_mem = nullptr;
+    _group_scratch = nullptr;
   }
 
   static char* get_ptr()
@@ -137,44 +152,53 @@ public:
     return _local_mem;
   }
 
-private:
-
-  static void release_memory() {
-    if (_local_mem != nullptr && _local_mem != &(_static_local_mem[0]) &&
-        _origin != host_local_memory_origin::hipcpu)
-      delete[] _local_mem;
+  static char* get_group_scratch_ptr()
+  {
+    return _group_scratch;
+  }
 
-    _local_mem = nullptr;
+  // Scratch memory of at least num_bytes for group algorithms on types that
+  // do not fit into a slot of the group scratch memory. It may be
+  // reallocated by the call, so all work items of a group must request the
+  // same size before any of them writes to it.
+  static char* get_large_type_group_scratch_ptr(size_t num_bytes)
+  {
+    reserve(_large_type_scratch, _large_type_scratch_size, num_bytes);
+    return _large_type_scratch;
   }
-  
-  static void alloc_threadprivate(size_t num_bytes) {
-    release_memory();
-
-    _origin = host_local_memory_origin::custom_threadprivate;
-    
-    if(num_bytes <= _max_static_local_mem_size)
-      _local_mem = &(_static_local_mem[0]);
-    else
-    {
-      if(num_bytes > 0)
-        _local_mem = new char [num_bytes];
-    }
+
+private:
+  static constexpr std::size_t round_to_alignment(std::size_t num_bytes) {
+    return (num_bytes + alignment - 1) / alignment * alignment;
   }
 
+  static void reserve(char*& mem, std::size_t& size, std::size_t num_bytes) {
+    if(num_bytes <= size)
+      return;
+    // Grow geometrically, so that kernels with slowly increasing
+    // requirements do not reallocate on every launch
+    std::size_t new_size = round_to_alignment(std::max(num_bytes, 2 * size));
+
+    ::operator delete(mem, std::align_val_t{alignment});
+    mem = static_cast<char *>(
+        ::operator new(new_size, std::align_val_t{alignment}));
+    size = new_size;
+  }
 
-  // By default we offer 32KB local memory per work group,
-  // for more local memory we go to the heap.
-  static constexpr size_t _max_static_local_mem_size = 1024*32;
   inline static char* _local_mem;
-  
-  alignas(sizeof(double) * 16) inline static char _static_local_mem
-      [_max_static_local_mem_size];
-  
-  inline static host_local_memory_origin _origin;
+  inline static char* _group_scratch;
+
+  inline static char* _arena;
+  inline static std::size_t _arena_size;
+  inline static char* _large_type_scratch;
+  inline static std::size_t _large_type_scratch_size;
 #ifdef _OPENMP
   #pragma omp threadprivate(_local_mem)
-  #pragma omp threadprivate(_static_local_mem)
-  #pragma omp threadprivate(_origin)
+  #pragma omp threadprivate(_group_scratch)
+  #pragma omp threadprivate(_arena)
+  #pragma omp threadprivate(_arena_size)
+  #pragma omp threadprivate(_large_type_scratch)
+  #pragma omp threadprivate(_large_type_scratch_size)
 #endif
 };
 
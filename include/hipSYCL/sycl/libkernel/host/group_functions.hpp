@@ -31,6 +31,7 @@
 
 #include "../backend.hpp"
 #include "../detail/data_layout.hpp"
+#include "../detail/local_memory_allocator.hpp"
 #include "../detail/mem_fence.hpp"
 #include "../functional.hpp"
 #include "../group.hpp"
@@ -38,6 +39,7 @@
 #include "../sub_group.hpp"
 #include "../vec.hpp"
 #include "hipSYCL/sycl/libkernel/host/host_backend.hpp"
+#include <cstddef>
 #include <type_traits>
 
 #if HIPSYCL_LIBKERNEL_IS_DEVICE_PASS_HOST
@@ -56,40 +58,376 @@ __hipsycl_group_barrier(group<Dim> g,
   g.barrier();
 }
 
-HIPSYCL_KERNEL_TARGET
+HIPSYCL_LOOP_SPLIT_BARRIER HIPSYCL_KERNEL_TARGET
 inline void
 __hipsycl_group_barrier(sub_group g,
                         memory_scope fence_scope = sub_group::fence_scope) {
-  // doesn't need sync
+  // Sub-groups of a single work item don't need sync
+  if (g.get_max_local_range()[0] > 1) {
+    if (fence_scope == memory_scope::device) {
+      mem_fence<>();
+    }
+    g.barrier();
+  }
 }
 
 namespace detail {
+// Layout of the group scratch memory, n being the group size:
+//
+//   [0, n*slot)          one input slot per work item
+//   [n*slot, 2*n*slot)   results computed by the leader
+//
+// Before the first barrier of a collective, work items only write their own
+// input slot. The leader only writes results after the first barrier, i.e.
+// once every work item has finished reading the results of the previous
+// collective. Collectives on types that fit into a slot therefore get away
+// with two barriers, since reading the result needs no trailing barrier.
+// Larger types use input slots in a separate, thread-local region that grows
+// with the largest type used, and synchronize a third time.
+//
+// Without CBS, sub-groups may synchronize independently of each other, so
+// a sub-group collective can still be in progress while other work items of
+// the group are already in the next collective. Sub-group collectives
+// therefore use neither of the above. Instead, each work item publishes a
+// pointer to its operand in its own slot of
+//
+//   [2*n*slot, 3*n*slot)  operand pointers of sub-group collectives
+//
+// and the sub-group accesses the operands through these pointers, which
+// stay valid until the work items leave the collective after its second
+// barrier. This works for types of any size. With CBS, sub-group
+// collectives use the input slots, see below.
+constexpr std::size_t group_scratch_slot_size =
+    host_local_memory::group_scratch_slot_size;
+
+template <typename T>
+constexpr bool is_group_scratch_slot_type() {
+  return sizeof(T) <= group_scratch_slot_size &&
+         alignof(T) <= group_scratch_slot_size;
+}
+
+// The work items taking part in a collective: A contiguous segment of the
+// work group, which currently is always the whole group.
+struct host_collective_segment {
+  void *scratch;
+  std::size_t group_size;
+  // Ids of the work item and the first work item of the segment in the group
+  std::size_t local_linear_id;
+  std::size_t begin;
+  std::size_t size;
+
+  HIPSYCL_KERNEL_TARGET
+  bool leader() const { return local_linear_id == begin; }
+};
+
+template <int Dim>
+HIPSYCL_KERNEL_TARGET host_collective_segment
+__hipsycl_get_collective_segment(group<Dim> g) {
+  const std::size_t group_size = g.get_local_range().size();
+  return host_collective_segment{g.get_local_memory_ptr(), group_size,
+                                 g.get_local_linear_id(), 0, group_size};
+}
+
+template <typename T>
+HIPSYCL_KERNEL_TARGET T *
+__hipsycl_group_input_slots(const host_collective_segment &segment) {
+  if constexpr (is_group_scratch_slot_type<T>()) {
+    return reinterpret_cast<T *>(segment.scratch);
+  } else {
+    static_assert(alignof(T) <= host_local_memory::alignment,
+                  "Type is overaligned for group scratch memory");
+    return reinterpret_cast<T *>(
+        host_local_memory::get_large_type_group_scratch_ptr(
+            segment.group_size * sizeof(T)));
+  }
+}
+
+template <typename T, int Dim>
+HIPSYCL_KERNEL_TARGET T *__hipsycl_group_input_slots(group<Dim> g) {
+  return __hipsycl_group_input_slots<T>(__hipsycl_get_collective_segment(g));
+}
+
+template <typename T>
+HIPSYCL_KERNEL_TARGET T *
+__hipsycl_group_result_slots(const host_collective_segment &segment) {
+  static_assert(is_group_scratch_slot_type<T>(),
+                "Type does not fit into group scratch slot");
+  char *scratch = static_cast<char *>(segment.scratch);
+  return reinterpret_cast<T *>(scratch +
+                               segment.group_size * group_scratch_slot_size);
+}
+
+// Combines the n > 0 elements of data by folding the upper half onto the
+// lower half until one element remains. Every pass is a dependency-free
+// contiguous loop, so the log2(n) passes vectorize.
+template <typename T, typename BinaryOperation>
+HIPSYCL_KERNEL_TARGET T __hipsycl_tree_reduce(T *data, std::size_t n,
+                                              BinaryOperation binary_op) {
+  while (n > 1) {
+    const std::size_t half = n / 2;
+    const std::size_t upper = n - half;
+#pragma omp simd
+    for (std::size_t i = 0; i < half; ++i)
+      data[i] = binary_op(data[i], data[i + upper]);
+    n = upper;
+  }
+  return data[0];
+}
+
+// Sequential scans from input to output, which may alias.
+template <typename T, typename BinaryOperation>
+HIPSYCL_KERNEL_TARGET void
+__hipsycl_sequential_exclusive_scan(const T *input, T *output, std::size_t n,
+                                    T init, BinaryOperation binary_op) {
+  T prefix = init;
+  for (std::size_t i = 0; i < n; ++i) {
+    T current = input[i];
+    output[i] = prefix;
+    prefix = binary_op(prefix, current);
+  }
+}
+
+template <typename T, typename BinaryOperation>
+HIPSYCL_KERNEL_TARGET void
+__hipsycl_sequential_inclusive_scan(const T *input, T *output, std::size_t n,
+                                    BinaryOperation binary_op) {
+  T prefix = input[0];
+  output[0] = prefix;
+  for (std::size_t i = 1; i < n; ++i) {
+    prefix = binary_op(prefix, input[i]);
+    output[i] = prefix;
+  }
+}
+
 // reduce implementation
-template <int Dim, typename T, typename BinaryOperation>
-HIPSYCL_KERNEL_TARGET T __hipsycl_group_reduce(group<Dim> g, T x,
-                                               BinaryOperation binary_op,
-                                               T *scratch) {
-  const size_t lid = g.get_local_linear_id();
+template <typename Group, typename T, typename BinaryOperation>
+HIPSYCL_KERNEL_TARGET T __hipsycl_group_reduce(Group g, T x,
+                                               BinaryOperation binary_op) {
+  const host_collective_segment segment = __hipsycl_get_collective_segment(g);
+  T *input = __hipsycl_group_input_slots<T>(segment);
 
-  scratch[lid] = x;
+  input[segment.local_linear_id] = x;
+  __hipsycl_group_barrier(g);
+
+  if constexpr (is_group_scratch_slot_type<T>()) {
+    T *result = __hipsycl_group_result_slots<T>(segment);
+    if (segment.leader())
+      result[segment.begin] = __hipsycl_tree_reduce(
+          input + segment.begin, segment.size, binary_op);
+
+    __hipsycl_group_barrier(g);
+    return result[segment.begin];
+  } else {
+    if (segment.leader())
+      input[segment.begin] = __hipsycl_tree_reduce(
+          input + segment.begin, segment.size, binary_op);
+
+    __hipsycl_group_barrier(g);
+    T tmp = input[segment.begin];
+    __hipsycl_group_barrier(g);
+
+    return tmp;
+  }
+}
+
+// scan implementation
+template <bool Inclusive, typename Group, typename T, typename BinaryOperation>
+HIPSYCL_KERNEL_TARGET T __hipsycl_group_scan(Group g, T x, T init,
+                                             BinaryOperation binary_op) {
+  const host_collective_segment segment = __hipsycl_get_collective_segment(g);
+  T *input = __hipsycl_group_input_slots<T>(segment);
+
+  auto scan = [&](T *output) {
+    if constexpr (Inclusive)
+      __hipsycl_sequential_inclusive_scan(input + segment.begin,
+                                          output + segment.begin,
+                                          segment.size, binary_op);
+    else
+      __hipsycl_sequential_exclusive_scan(input + segment.begin,
+                                          output + segment.begin,
+                                          segment.size, init, binary_op);
+  };
+
+  input[segment.local_linear_id] = x;
+  __hipsycl_group_barrier(g);
+
+  if constexpr (is_group_scratch_slot_type<T>()) {
+    T *result = __hipsycl_group_result_slots<T>(segment);
+    if (segment.leader())
+      scan(result);
+
+    __hipsycl_group_barrier(g);
+    return result[segment.local_linear_id];
+  } else {
+    if (segment.leader())
+      scan(input);
+
+    __hipsycl_group_barrier(g);
+    T tmp = input[segment.local_linear_id];
+    __hipsycl_group_barrier(g);
+
+    return tmp;
+  }
+}
+
+#ifdef __HIPSYCL_USE_ACCELERATED_CPU__
+// With CBS, the work items of a group run in lockstep from one barrier to
+// the next, so a sub-group collective cannot overlap with collectives of
+// other sub-groups. Each work item therefore computes its own result directly
+// from the input slots of its sub-group, without a leader. This keeps the
+// work item loops free of divergent control flow: broadcasts and shuffles
+// become plain loads, and reductions and scans become folds over the
+// contiguous slots of the sub-group, which vectorize over its lanes.
+
+// Stores x in the input slot of the work item and returns the input slots of
+// the sub-group, indexed by the local id in the sub-group. Must be followed
+// by a barrier before the slots of other work items are read.
+template <typename T>
+HIPSYCL_KERNEL_TARGET T *__hipsycl_publish_sub_group_operand(sub_group g,
+                                                              T x) {
+  const std::size_t group_size = g.get_group_local_linear_range();
+  const std::size_t local_linear_id = g.get_group_local_linear_id();
+  T *input = __hipsycl_group_input_slots<T>(host_collective_segment{
+      g.get_local_memory_ptr(), group_size, local_linear_id, 0, group_size});
+
+  input[local_linear_id] = x;
+  return input + (local_linear_id - g.get_local_linear_id());
+}
+
+template <typename T, typename BinaryOperation>
+HIPSYCL_KERNEL_TARGET T __hipsycl_sub_group_reduce(sub_group g, T x,
+                                                   BinaryOperation binary_op) {
+  const T *lanes = __hipsycl_publish_sub_group_operand(g, x);
+  __hipsycl_group_barrier(g);
+
+  const std::size_t size = g.get_local_linear_range();
+  T result = lanes[0];
+  for (std::size_t i = 1; i < size; ++i)
+    result = binary_op(result, lanes[i]);
+  __hipsycl_group_barrier(g);
+
+  return result;
+}
+
+template <bool Inclusive, typename T, typename BinaryOperation>
+HIPSYCL_KERNEL_TARGET T __hipsycl_sub_group_scan(sub_group g, T x, T init,
+                                                 BinaryOperation binary_op) {
+  const T *lanes = __hipsycl_publish_sub_group_operand(g, x);
+  __hipsycl_group_barrier(g);
+
+  const std::size_t local_linear_id = g.get_local_linear_id();
+  T result = init;
+  if constexpr (Inclusive) {
+    result = lanes[0];
+    for (std::size_t i = 1; i <= local_linear_id; ++i)
+      result = binary_op(result, lanes[i]);
+  } else {
+    for (std::size_t i = 0; i < local_linear_id; ++i)
+      result = binary_op(result, lanes[i]);
+  }
+  __hipsycl_group_barrier(g);
+
+  return result;
+}
+
+// Returns the value of x of the work item with the given id in the
+// sub-group, or its own x if there is no such work item. Implements
+// broadcasts and shuffles.
+template <typename T>
+HIPSYCL_KERNEL_TARGET T __hipsycl_sub_group_select(sub_group g, T x,
+                                                   std::size_t source_id) {
+  const T *lanes = __hipsycl_publish_sub_group_operand(g, x);
+  __hipsycl_group_barrier(g);
+
+  if (source_id < g.get_local_linear_range())
+    x = lanes[source_id];
+  __hipsycl_group_barrier(g);
+
+  return x;
+}
+#else
+// Publishes the address of value to the other work items of the sub-group
+// and returns the operand pointers of the sub-group, indexed by the local
+// id in the sub-group. Must be followed by a barrier before the pointers of
+// other work items are used.
+template <typename T>
+HIPSYCL_KERNEL_TARGET T **__hipsycl_publish_sub_group_operand(sub_group g,
+                                                               T *value) {
+  char *scratch = static_cast<char *>(g.get_local_memory_ptr());
+  T **operands = reinterpret_cast<T **>(
+      scratch +
+      2 * g.get_group_local_linear_range() * group_scratch_slot_size);
+
+  const std::size_t local_linear_id = g.get_group_local_linear_id();
+  operands[local_linear_id] = value;
+  return operands + (local_linear_id - g.get_local_linear_id());
+}
+
+template <typename T, typename BinaryOperation>
+HIPSYCL_KERNEL_TARGET T __hipsycl_sub_group_reduce(sub_group g, T x,
+                                                   BinaryOperation binary_op) {
+  T value = x;
+  T **operands = __hipsycl_publish_sub_group_operand(g, &value);
   __hipsycl_group_barrier(g);
 
   if (g.leader()) {
-    T result = scratch[0];
+    const std::size_t size = g.get_local_linear_range();
+    T result = *operands[0];
+    for (std::size_t i = 1; i < size; ++i)
+      result = binary_op(result, *operands[i]);
+    for (std::size_t i = 0; i < size; ++i)
+      *operands[i] = result;
+  }
+  __hipsycl_group_barrier(g);
 
-    for (int i = 1; i < g.get_local_range().size(); ++i)
-      result = binary_op(result, scratch[i]);
+  return value;
+}
+
+template <bool Inclusive, typename T, typename BinaryOperation>
+HIPSYCL_KERNEL_TARGET T __hipsycl_sub_group_scan(sub_group g, T x, T init,
+                                                 BinaryOperation binary_op) {
+  T value = x;
+  T **operands = __hipsycl_publish_sub_group_operand(g, &value);
+  __hipsycl_group_barrier(g);
 
-    scratch[0] = result;
+  if (g.leader()) {
+    const std::size_t size = g.get_local_linear_range();
+    if constexpr (Inclusive) {
+      for (std::size_t i = 1; i < size; ++i)
+        *operands[i] = binary_op(*operands[i - 1], *operands[i]);
+    } else {
+      T prefix = init;
+      for (std::size_t i = 0; i < size; ++i) {
+        T current = *operands[i];
+        *operands[i] = prefix;
+        prefix = binary_op(prefix, current);
+      }
+    }
   }
+  __hipsycl_group_barrier(g);
 
+  return value;
+}
+
+// Returns the value of x of the work item with the given id in the
+// sub-group, or its own x if there is no such work item. Implements
+// broadcasts and shuffles.
+template <typename T>
+HIPSYCL_KERNEL_TARGET T __hipsycl_sub_group_select(sub_group g, T x,
+                                                   std::size_t source_id) {
+  T value = x;
+  T **operands = __hipsycl_publish_sub_group_operand(g, &value);
   __hipsycl_group_barrier(g);
-  T tmp = scratch[0];
+
+  if (source_id < g.get_local_linear_range())
+    x = *operands[source_id];
   __hipsycl_group_barrier(g);
 
-  return tmp;
+  return x;
 }
 
+#endif
+
 } // namespace detail
 
 // broadcast
@@ -98,15 +436,15 @@ HIPSYCL_KERNEL_TARGET
 T __hipsycl_group_broadcast(
     group<Dim> g, T x,
     typename group<Dim>::linear_id_type local_linear_id = 0) {
-  T *scratch = static_cast<T *>(g.get_local_memory_ptr());
+  T *scratch = detail::__hipsycl_group_input_slots<T>(g);
   const size_t lid = g.get_local_linear_id();
 
   if (lid == local_linear_id) {
-    scratch[0] = x;
+    scratch[lid] = x;
   }
 
   __hipsycl_group_barrier(g);
-  T tmp = scratch[0];
+  T tmp = scratch[local_linear_id];
   __hipsycl_group_barrier(g);
 
   return tmp;
@@ -124,14 +462,16 @@ template<typename T>
 HIPSYCL_KERNEL_TARGET
 T __hipsycl_group_broadcast(sub_group g, T x,
                   typename sub_group::linear_id_type local_linear_id = 0) {
-  return x;
+  if (g.get_max_local_range()[0] == 1)
+    return x;
+  return detail::__hipsycl_sub_group_select(g, x, local_linear_id);
 }
 
 template<typename T>
 HIPSYCL_KERNEL_TARGET
 T __hipsycl_group_broadcast(sub_group g, T x,
                   typename sub_group::id_type local_id) {
-  return x;
+  return __hipsycl_group_broadcast(g, x, local_id[0]);
 }
 
 // any_of
@@ -166,26 +506,14 @@ bool __hipsycl_joint_any_of(Group g, Ptr first, Ptr last,
 template<int Dim>
 HIPSYCL_KERNEL_TARGET
 inline bool __hipsycl_any_of_group(group<Dim> g, bool pred) {
-  bool *scratch = static_cast<bool *>(g.get_local_memory_ptr());
-
-  scratch[0] = false;
-  __hipsycl_group_barrier(g);
-
-  if (pred)
-    scratch[0] = pred;
-
-  __hipsycl_group_barrier(g);
-
-  bool tmp = scratch[0];
-
-  __hipsycl_group_barrier(g);
-
-  return tmp;
+  return detail::__hipsycl_group_reduce(g, pred, logical_or<bool>{});
 }
 
 HIPSYCL_KERNEL_TARGET
 inline bool __hipsycl_any_of_group(sub_group g, bool pred) {
-  return pred;
+  if (g.get_max_local_range()[0] == 1)
+    return pred;
+  return detail::__hipsycl_sub_group_reduce(g, pred, logical_or<bool>{});
 }
 
 // all_of
@@ -219,26 +547,14 @@ HIPSYCL_KERNEL_TARGET bool __hipsycl_joint_all_of(Group g, Ptr first, Ptr last,
 template<int Dim>
 HIPSYCL_KERNEL_TARGET
 inline bool __hipsycl_all_of_group(group<Dim> g, bool pred) {
-  bool *scratch = static_cast<bool *>(g.get_local_memory_ptr());
-
-  scratch[0] = true;
-  __hipsycl_group_barrier(g);
-
-  if (!pred)
-    scratch[0] = pred;
-
-  __hipsycl_group_barrier(g);
-
-  bool tmp = scratch[0];
-
-  __hipsycl_group_barrier(g);
-
-  return tmp;
+  return detail::__hipsycl_group_reduce(g, pred, logical_and<bool>{});
 }
 
 HIPSYCL_KERNEL_TARGET
 inline bool __hipsycl_all_of_group(sub_group g, bool pred) {
-  return pred;
+  if (g.get_max_local_range()[0] == 1)
+    return pred;
+  return detail::__hipsycl_sub_group_reduce(g, pred, logical_and<bool>{});
 }
 
 // none_of
@@ -274,26 +590,14 @@ bool __hipsycl_joint_none_of(Group g, Ptr first, Ptr last,
 template<int Dim>
 HIPSYCL_KERNEL_TARGET
 inline bool __hipsycl_none_of_group(group<Dim> g, bool pred) {
-  bool *scratch = static_cast<bool *>(g.get_local_memory_ptr());
-
-  scratch[0] = true;
-  __hipsycl_group_barrier(g);
-
-  if (pred)
-    scratch[0] = !pred;
-
-  __hipsycl_group_barrier(g);
-
-  bool tmp = scratch[0];
-
-  __hipsycl_group_barrier(g);
-
-  return tmp;
+  return !detail::__hipsycl_group_reduce(g, pred, logical_or<bool>{});
 }
 
 HIPSYCL_KERNEL_TARGET
 inline bool __hipsycl_none_of_group(sub_group g, bool pred) {
-  return !pred;
+  if (g.get_max_local_range()[0] == 1)
+    return !pred;
+  return !detail::__hipsycl_sub_group_reduce(g, pred, logical_or<bool>{});
 }
 
 // reduce
@@ -355,17 +659,15 @@ T __hipsycl_joint_reduce(Group g, Ptr first, Ptr last, T init,
 template<int Dim, typename T, typename BinaryOperation>
 HIPSYCL_KERNEL_TARGET
 T __hipsycl_reduce_over_group(group<Dim> g, T x, BinaryOperation binary_op) {
-  T *scratch = static_cast<T *>(g.get_local_memory_ptr());
-
-  T tmp = detail::__hipsycl_group_reduce(g, x, binary_op, scratch);
-
-  return tmp;
+  return detail::__hipsycl_group_reduce(g, x, binary_op);
 }
 
 template<typename T, typename BinaryOperation>
 HIPSYCL_KERNEL_TARGET
 T __hipsycl_reduce_over_group(sub_group g, T x, BinaryOperation binary_op) {
-  return x;
+  if (g.get_max_local_range()[0] == 1)
+    return x;
+  return detail::__hipsycl_sub_group_reduce(g, x, binary_op);
 }
 
 // exclusive_scan
@@ -421,30 +723,15 @@ __hipsycl_joint_exclusive_scan(Group g, InPtr first, InPtr last, OutPtr result,
 template <int Dim, typename V, typename T, typename BinaryOperation>
 HIPSYCL_KERNEL_TARGET T __hipsycl_exclusive_scan_over_group(
     group<Dim> g, V x, T init, BinaryOperation binary_op) {
-  T *          scratch = static_cast<T *>(g.get_local_memory_ptr());
-  const size_t lid     = g.get_local_linear_id();
-
-  if (lid + 1 < 1024)
-    scratch[lid + 1] = x;
-  __hipsycl_group_barrier(g);
-
-  if (g.leader()) {
-    scratch[0] = init;
-    for (int i = 1; i < g.get_local_range().size(); ++i)
-      scratch[i] = binary_op(scratch[i], scratch[i - 1]);
-  }
-
-  __hipsycl_group_barrier(g);
-  T tmp = scratch[lid];
-  __hipsycl_group_barrier(g);
-
-  return tmp;
+  return detail::__hipsycl_group_scan<false>(g, T{x}, init, binary_op);
 }
 
 template <typename V, typename T, typename BinaryOperation>
 HIPSYCL_KERNEL_TARGET T __hipsycl_exclusive_scan_over_group(
     sub_group g, V x, T init, BinaryOperation binary_op) {
-  return binary_op(x, init);
+  if (g.get_max_local_range()[0] == 1)
+    return init;
+  return detail::__hipsycl_sub_group_scan<false>(g, T{x}, init, binary_op);
 }
 
 template <typename Group, typename T, typename BinaryOperation,
@@ -508,28 +795,15 @@ template <int Dim, typename T, typename BinaryOperation>
 HIPSYCL_KERNEL_TARGET
 T __hipsycl_inclusive_scan_over_group(
     group<Dim> g, T x, BinaryOperation binary_op) {
-  T *          scratch = static_cast<T *>(g.get_local_memory_ptr());
-  const size_t lid     = g.get_local_linear_id();
-
-  scratch[lid] = x;
-  __hipsycl_group_barrier(g);
-
-  if (g.leader()) {
-    for (int i = 1; i < g.get_local_range().size(); ++i)
-      scratch[i] = binary_op(scratch[i], scratch[i - 1]);
-  }
-
-  __hipsycl_group_barrier(g);
-  T tmp = scratch[lid];
-  __hipsycl_group_barrier(g);
-
-  return tmp;
+  return detail::__hipsycl_group_scan<true>(g, x, T{}, binary_op);
 }
 
 template <typename T, typename BinaryOperation>
 HIPSYCL_KERNEL_TARGET T __hipsycl_inclusive_scan_over_group(
     sub_group g, T x, BinaryOperation binary_op) {
-  return x;
+  if (g.get_max_local_range()[0] == 1)
+    return x;
+  return detail::__hipsycl_sub_group_scan<true>(g, x, T{}, binary_op);
 }
 
 template <typename Group, typename V, typename T, typename BinaryOperation,
@@ -545,7 +819,7 @@ template <int Dim, typename T>
 HIPSYCL_KERNEL_TARGET
 T __hipsycl_shift_group_left(
     group<Dim> g, T x, typename group<Dim>::linear_id_type delta = 1) {
-  T *scratch = static_cast<T *>(g.get_local_memory_ptr());
+  T *scratch = detail::__hipsycl_group_input_slots<T>(g);
 
   typename group<Dim>::linear_id_type lid        = g.get_local_linear_id();
   typename group<Dim>::linear_id_type target_lid = lid + delta;
@@ -565,14 +839,17 @@ T __hipsycl_shift_group_left(
 template <typename T>
 HIPSYCL_KERNEL_TARGET T __hipsycl_shift_group_left(
     sub_group g, T x, typename sub_group::linear_id_type delta = 1) {
-  return x;
+  if (g.get_max_local_range()[0] == 1)
+    return x;
+  return detail::__hipsycl_sub_group_select(
+      g, x, std::size_t{g.get_local_linear_id()} + delta);
 }
 
 // shift_right
 template <int Dim, typename T>
 HIPSYCL_KERNEL_TARGET T __hipsycl_shift_group_right(
     group<Dim> g, T x, typename group<Dim>::linear_id_type delta = 1) {
-  T *scratch = static_cast<T *>(g.get_local_memory_ptr());
+  T *scratch = detail::__hipsycl_group_input_slots<T>(g);
 
   typename group<Dim>::linear_id_type lid        = g.get_local_linear_id();
   typename group<Dim>::linear_id_type target_lid = lid - delta;
@@ -593,14 +870,20 @@ HIPSYCL_KERNEL_TARGET T __hipsycl_shift_group_right(
 template <typename T>
 HIPSYCL_KERNEL_TARGET T __hipsycl_shift_group_right(
     sub_group g, T x, typename sub_group::linear_id_type delta = 1) {
-  return x;
+  if (g.get_max_local_range()[0] == 1)
+    return x;
+  const typename sub_group::linear_id_type lid = g.get_local_linear_id();
+  // Out of range for work items without a source, so that they keep x
+  const std::size_t source_id =
+      delta <= lid ? lid - delta : g.get_local_linear_range();
+  return detail::__hipsycl_sub_group_select(g, x, source_id);
 }
 
 // permute_group_by_xor
 template <int Dim, typename T>
 HIPSYCL_KERNEL_TARGET T __hipsycl_permute_group_by_xor(
     group<Dim> g, T x, typename group<Dim>::linear_id_type mask) {
-  T *scratch = static_cast<T *>(g.get_local_memory_ptr());
+  T *scratch = detail::__hipsycl_group_input_slots<T>(g);
 
   typename group<Dim>::linear_id_type lid        = g.get_local_linear_id();
   typename group<Dim>::linear_id_type target_lid = lid ^ mask;
@@ -622,14 +905,17 @@ HIPSYCL_KERNEL_TARGET T __hipsycl_permute_group_by_xor(
 template <typename T>
 HIPSYCL_KERNEL_TARGET T __hipsycl_permute_group_by_xor(
     sub_group g, T x, typename sub_group::linear_id_type mask) {
-  return x;
+  if (g.get_max_local_range()[0] == 1)
+    return x;
+  return detail::__hipsycl_sub_group_select(g, x,
+                                            g.get_local_linear_id() ^ mask);
 }
 
 // select_from_group
 template <int Dim, typename T>
 HIPSYCL_KERNEL_TARGET T __hipsycl_select_from_group(
     group<Dim> g, T x, typename group<Dim>::id_type remote_local_id) {
-  T *scratch = static_cast<T *>(g.get_local_memory_ptr());
+  T *scratch = detail::__hipsycl_group_input_slots<T>(g);
 
   typename group<Dim>::linear_id_type lid = g.get_local_linear_id();
   typename group<Dim>::linear_id_type target_lid =
@@ -651,7 +937,9 @@ HIPSYCL_KERNEL_TARGET T __hipsycl_select_from_group(
 template <typename T>
 HIPSYCL_KERNEL_TARGET T __hipsycl_select_from_group(
     sub_group g, T x, typename sub_group::id_type remote_local_id) {
-  return x;
+  if (g.get_max_local_range()[0] == 1)
+    return x;
+  return detail::__hipsycl_sub_group_select(g, x, remote_local_id[0]);
 }
 
 } // namespace sycl
@@ -48,8 +48,11 @@ namespace sycl {
 namespace detail {
 #ifdef SYCL_DEVICE_ONLY
 using host_barrier_type = void;
+using host_sub_group_barrier_type = void;
 #else
 using host_barrier_type = std::function<void()>;
+// Invoked with the linear id of the work item in its work group
+using host_sub_group_barrier_type = std::function<void(std::size_t)>;
 #endif
 }
 
@@ -200,7 +203,13 @@ struct nd_item
   HIPSYCL_KERNEL_TARGET
   sub_group get_sub_group() const
   {
+#ifdef HIPSYCL_ONDEMAND_ITERATION_SPACE_INFO
     return sub_group{};
+#else
+    return sub_group{get_local_linear_id(), _local_range.size(),
+                     _sub_group_size, _group_barrier, _sub_group_barrier,
+                     _local_memory_ptr};
+#endif
   }
 
   HIPSYCL_KERNEL_TARGET
@@ -359,17 +368,21 @@ struct nd_item
           id<Dimensions> group_id, id<Dimensions> local_id, 
           range<Dimensions> local_range, range<Dimensions> num_groups,
           detail::host_barrier_type* host_group_barrier = nullptr,
-          void* local_memory_ptr = nullptr)
+          void* local_memory_ptr = nullptr,
+          sub_group::linear_range_type sub_group_size = 1,
+          detail::host_sub_group_barrier_type* host_sub_group_barrier = nullptr)
     : _offset{offset}, 
       _group_id{group_id}, 
       _local_id{local_id}, 
       _local_range{local_range},
       _num_groups{num_groups},
       _global_id{group_id * local_range + local_id},
-      _local_memory_ptr(local_memory_ptr)
+      _local_memory_ptr(local_memory_ptr),
+      _sub_group_size{sub_group_size}
   {
     __hipsycl_if_target_host(
       _group_barrier = static_cast<void*>(host_group_barrier);
+      _sub_group_barrier = static_cast<void*>(host_sub_group_barrier);
     );
   }
 #endif
@@ -384,12 +397,14 @@ private:
   const range<Dimensions> _num_groups;
   const id<Dimensions> _global_id;
   void *_local_memory_ptr;
+  const sub_group::linear_range_type _sub_group_size;
 #endif
 
 #ifndef SYCL_DEVICE_ONLY
   // Store void ptr to avoid function pointer types
   // appearing in SSCP code
   void* _group_barrier;
+  void* _sub_group_barrier;
 #endif
 };
 
@@ -28,7 +28,9 @@
 #ifndef HIPSYCL_SUBGROUP_HPP
 #define HIPSYCL_SUBGROUP_HPP
 
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 
 #include "hipSYCL/sycl/libkernel/backend.hpp"
 #include "detail/thread_hierarchy.hpp"
@@ -55,6 +57,61 @@ public:
   static constexpr int dimensions = 1;
   static constexpr memory_scope fence_scope = memory_scope::sub_group;
 
+#if !defined(HIPSYCL_ONDEMAND_ITERATION_SPACE_INFO)
+  sub_group() = default;
+
+  /// On the host, sub-groups consist of consecutive work items in the
+  /// linear local id order of their work group. The last sub-group of a
+  /// work group may be incomplete.
+  HIPSYCL_KERNEL_TARGET
+  sub_group(std::size_t group_local_linear_id,
+            std::size_t group_local_linear_range,
+            linear_range_type max_local_range, const void *group_barrier,
+            const void *sub_group_barrier, void *local_memory_ptr)
+      : _group_local_linear_id{group_local_linear_id},
+        _group_local_linear_range{group_local_linear_range},
+        _max_local_range{max_local_range}, _group_barrier{group_barrier},
+        _sub_group_barrier{sub_group_barrier},
+        _local_memory_ptr{local_memory_ptr} {}
+
+  // The following are only required on the host, where sub-group
+  // collectives are implemented using the resources of the work group.
+
+  HIPSYCL_KERNEL_TARGET
+  void *get_local_memory_ptr() const {
+    return _local_memory_ptr;
+  }
+
+  /// \return The linear id of the work item in its work group
+  HIPSYCL_KERNEL_TARGET
+  std::size_t get_group_local_linear_id() const {
+    return _group_local_linear_id;
+  }
+
+  /// \return The number of work items in the work group
+  HIPSYCL_KERNEL_TARGET
+  std::size_t get_group_local_linear_range() const {
+    return _group_local_linear_range;
+  }
+
+  /// Work items of a sub-group do not run in lockstep on the host. If the
+  /// kernel launcher cannot synchronize individual sub-groups, this
+  /// synchronizes the whole work group.
+  HIPSYCL_KERNEL_TARGET
+  void barrier() const {
+    __hipsycl_if_target_host(
+      if(_sub_group_barrier) {
+        using host_sub_group_barrier_type = std::function<void(std::size_t)>;
+        (*static_cast<const host_sub_group_barrier_type *>(
+            _sub_group_barrier))(_group_local_linear_id);
+      } else {
+        using host_barrier_type = std::function<void()>;
+        (*static_cast<const host_barrier_type *>(_group_barrier))();
+      }
+    );
+  }
+#endif
+
 
   HIPSYCL_KERNEL_TARGET
   id_type get_local_id() const {
@@ -64,7 +121,7 @@ public:
   HIPSYCL_KERNEL_TARGET
   linear_id_type get_local_linear_id() const {
     __hipsycl_backend_switch(
-        return 0, 
+        return host_local_linear_id(),
         return __hipsycl_sscp_get_subgroup_local_id(),
         return local_tid() & get_warp_mask(),
         return local_tid() & get_warp_mask(),
@@ -81,7 +138,7 @@ public:
   HIPSYCL_KERNEL_TARGET
   linear_range_type get_local_linear_range() const {
     __hipsycl_backend_switch(
-        return 1, 
+        return host_local_linear_range(),
         return __hipsycl_sscp_get_subgroup_size(),
         // TODO This is not actually correct for incomplete subgroups
         return __hipsycl_warp_size,
@@ -92,7 +149,7 @@ public:
   HIPSYCL_KERNEL_TARGET
   range_type get_max_local_range() const {
     __hipsycl_backend_switch(
-        return range_type{1},
+        return range_type{host_max_local_range()},
         return range_type{__hipsycl_sscp_get_subgroup_max_size()},
         return range_type{__hipsycl_warp_size},
         return range_type{__hipsycl_warp_size},
@@ -107,7 +164,7 @@ public:
   HIPSYCL_KERNEL_TARGET
   linear_id_type get_group_linear_id() const {
     __hipsycl_backend_switch(
-        return 0, // TODO This is probably incorrect
+        return host_group_linear_id(),
         return __hipsycl_sscp_get_subgroup_id(),
         return local_tid() >> (__ffs(__hipsycl_warp_size) - 1),
         return local_tid() >> (__ffs(__hipsycl_warp_size) - 1),
@@ -117,7 +174,7 @@ public:
   HIPSYCL_KERNEL_TARGET
   linear_range_type get_group_linear_range() const {
     __hipsycl_backend_switch(
-        return 1,
+        return host_group_linear_range(),
         return __hipsycl_sscp_get_num_subgroups(),
         return hiplike_num_subgroups(),
         return hiplike_num_subgroups(),
@@ -140,6 +197,49 @@ public:
     return get_local_linear_id() == 0;
   }
 private:
+#if !defined(HIPSYCL_ONDEMAND_ITERATION_SPACE_INFO)
+  HIPSYCL_KERNEL_TARGET
+  linear_id_type host_local_linear_id() const {
+    return static_cast<linear_id_type>(_group_local_linear_id %
+                                       _max_local_range);
+  }
+
+  HIPSYCL_KERNEL_TARGET
+  linear_range_type host_local_linear_range() const {
+    std::size_t begin = host_group_linear_id() * std::size_t{_max_local_range};
+    std::size_t remaining = _group_local_linear_range - begin;
+    return remaining < _max_local_range
+               ? static_cast<linear_range_type>(remaining)
+               : _max_local_range;
+  }
+
+  HIPSYCL_KERNEL_TARGET
+  linear_range_type host_max_local_range() const {
+    return _max_local_range;
+  }
+
+  HIPSYCL_KERNEL_TARGET
+  linear_id_type host_group_linear_id() const {
+    return static_cast<linear_id_type>(_group_local_linear_id /
+                                       _max_local_range);
+  }
+
+  HIPSYCL_KERNEL_TARGET
+  linear_range_type host_group_linear_range() const {
+    return static_cast<linear_range_type>(
+        (_group_local_linear_range + _max_local_range - 1) / _max_local_range);
+  }
+
+  std::size_t _group_local_linear_id = 0;
+  std::size_t _group_local_linear_range = 1;
+  linear_range_type _max_local_range = 1;
+  // Don't store the barriers as std::function pointers to avoid
+  // function pointer types spilling into SSCP IR.
+  const void *_group_barrier = nullptr;
+  const void *_sub_group_barrier = nullptr;
+  void *_local_memory_ptr = nullptr;
+#endif
+
   int hiplike_num_subgroups() const {
     __hipsycl_if_target_hiplike(
         int local_range =
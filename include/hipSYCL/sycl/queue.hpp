@@ -99,6 +99,10 @@ struct hipSYCL_prefer_execution_lane : public detail::cg_property{
 
 struct hipSYCL_coarse_grained_events : public detail::cg_property {};
 
+struct hipSYCL_static_schedule : public detail::cg_property {};
+
+struct hipSYCL_work_stealing_schedule : public detail::cg_property {};
+
 }
 
 
@@ -378,6 +382,15 @@ public:
             property::command_group::hipSYCL_coarse_grained_events>()) {
       hints.set_hint(rt::hints::coarse_grained_synchronization{});
     }
+    if (prop_list.has_property<
+            property::command_group::hipSYCL_work_stealing_schedule>()) {
+      hints.set_hint(
+          rt::hints::omp_schedule{rt::omp_schedule_type::work_stealing});
+    } else if (prop_list.has_property<
+                   property::command_group::hipSYCL_static_schedule>()) {
+      hints.set_hint(
+          rt::hints::omp_schedule{rt::omp_schedule_type::static_schedule});
+    }
     // Should always have node_group hint from default hints
     assert(hints.has_hint<rt::hints::node_group>());
 
@@ -39,6 +39,7 @@
 
 #ifdef HIPSYCL_WITH_ACCELERATED_CPU
 #include "hipSYCL/compiler/cbs/LoopsParallelMarker.hpp"
+#include "hipSYCL/compiler/cbs/RegionVectorizer.hpp"
 #include "hipSYCL/compiler/cbs/SplitterAnnotationAnalysis.hpp"
 #endif
 
@@ -118,6 +119,16 @@ static void registerMarkParallelPass(const llvm::PassManagerBuilder &,
 static llvm::RegisterStandardPasses
     RegisterMarkParallelBeforeVectorizer(llvm::PassManagerBuilder::EP_VectorizerStart,
                                          registerMarkParallelPass);
+
+static void registerRegionVectorizerPass(const llvm::PassManagerBuilder &,
+                                         llvm::legacy::PassManagerBase &PM) {
+  PM.add(new RegionVectorizerPassLegacy());
+}
+
+// vectorize wi-loops with divergent control flow before the loop vectorizer sees them.
+static llvm::RegisterStandardPasses
+    RegisterRegionVectorizer(llvm::PassManagerBuilder::EP_VectorizerStart,
+                             registerRegionVectorizerPass);
 #endif // HIPSYCL_WITH_ACCELERATED_CPU
 #endif // LLVM_VERSION_MAJOR < 16
 
@@ -190,6 +201,11 @@ extern "C" LLVM_ATTRIBUTE_WEAK ::llvm::PassPluginLibraryInfo llvmGetPassPluginIn
             if(!CompilationStateManager::getASTPassState().isDeviceCompilation())
               FPM.addPass(LoopsParallelMarkerPass{});
           });
+          // vectorize wi-loops with divergent control flow before the loop vectorizer sees them.
+          PB.registerVectorizerStartEPCallback([](llvm::FunctionPassManager &FPM, OptLevel) {
+            if(!CompilationStateManager::getASTPassState().isDeviceCompilation())
+              FPM.addPass(RegionVectorizerPass{});
+          });
 #endif
         }
   };
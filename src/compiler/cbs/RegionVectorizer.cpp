@@ -0,0 +1,950 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "hipSYCL/compiler/cbs/RegionVectorizer.hpp"
+
+#include "hipSYCL/compiler/cbs/IRUtils.hpp"
+#include "hipSYCL/compiler/cbs/Region.hpp"
+#include "hipSYCL/compiler/cbs/SplitterAnnotationAnalysis.hpp"
+#include "hipSYCL/compiler/cbs/UniformityAnalysis.hpp"
+#include "hipSYCL/compiler/cbs/VectorizationInfo.hpp"
+
+#include "hipSYCL/common/debug.hpp"
+
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/ADT/SmallPtrSet.h>
+#include <llvm/Analysis/LoopInfo.h>
+#include <llvm/Analysis/LoopIterator.h>
+#include <llvm/Analysis/OptimizationRemarkEmitter.h>
+#include <llvm/Analysis/PostDominators.h>
+#include <llvm/Analysis/TargetTransformInfo.h>
+#include <llvm/IR/Dominators.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/IntrinsicInst.h>
+#include <llvm/Transforms/Utils/LoopUtils.h>
+
+#include <string>
+
+namespace {
+using namespace hipsycl::compiler;
+
+// remarks can be requested with -Rpass[-missed|-analysis]=hipsycl-region-vectorizer
+constexpr const char *RemarkPassName = "hipsycl-region-vectorizer";
+constexpr unsigned MaxVectorWidth = 16;
+
+#if LLVM_VERSION_MAJOR >= 13
+bool isVectorizableIntrinsic(llvm::Intrinsic::ID ID) {
+  switch (ID) {
+  case llvm::Intrinsic::sqrt:
+  case llvm::Intrinsic::fabs:
+  case llvm::Intrinsic::floor:
+  case llvm::Intrinsic::ceil:
+  case llvm::Intrinsic::trunc:
+  case llvm::Intrinsic::rint:
+  case llvm::Intrinsic::nearbyint:
+  case llvm::Intrinsic::round:
+  case llvm::Intrinsic::fma:
+  case llvm::Intrinsic::fmuladd:
+  case llvm::Intrinsic::minnum:
+  case llvm::Intrinsic::maxnum:
+  case llvm::Intrinsic::copysign:
+  case llvm::Intrinsic::sin:
+  case llvm::Intrinsic::cos:
+  case llvm::Intrinsic::exp:
+  case llvm::Intrinsic::exp2:
+  case llvm::Intrinsic::log:
+  case llvm::Intrinsic::log2:
+  case llvm::Intrinsic::log10:
+  case llvm::Intrinsic::pow:
+  case llvm::Intrinsic::smin:
+  case llvm::Intrinsic::smax:
+  case llvm::Intrinsic::umin:
+  case llvm::Intrinsic::umax:
+  case llvm::Intrinsic::abs:
+  case llvm::Intrinsic::ctlz:
+  case llvm::Intrinsic::cttz:
+  case llvm::Intrinsic::ctpop:
+    return true;
+  default:
+    return false;
+  }
+}
+
+// the second operand of these intrinsics makes the result poison for some inputs
+bool hasPoisonFlagOperand(llvm::Intrinsic::ID ID) {
+  return ID == llvm::Intrinsic::abs || ID == llvm::Intrinsic::ctlz || ID == llvm::Intrinsic::cttz;
+}
+
+// intrinsics without effect on the generated code, they are not carried over to the vector loop
+bool isDroppableInstruction(const llvm::Instruction &I) {
+  if (llvm::isa<llvm::DbgInfoIntrinsic>(I))
+    return true;
+  if (const auto *II = llvm::dyn_cast<llvm::IntrinsicInst>(&I)) {
+    switch (II->getIntrinsicID()) {
+    case llvm::Intrinsic::assume:
+    case llvm::Intrinsic::lifetime_start:
+    case llvm::Intrinsic::lifetime_end:
+    case llvm::Intrinsic::experimental_noalias_scope_decl:
+      return true;
+    default:
+      return false;
+    }
+  }
+  return false;
+}
+
+bool isDivRem(const llvm::Instruction &I) {
+  switch (I.getOpcode()) {
+  case llvm::Instruction::UDiv:
+  case llvm::Instruction::SDiv:
+  case llvm::Instruction::URem:
+  case llvm::Instruction::SRem:
+    return true;
+  default:
+    return false;
+  }
+}
+
+bool isSupportedElementType(const llvm::Type *T) {
+  if (T->isIntegerTy())
+    return T->isIntegerTy(1) ||
+           (T->getIntegerBitWidth() % 8 == 0 && T->getIntegerBitWidth() <= 64);
+  return T->isHalfTy() || T->isFloatTy() || T->isDoubleTy() || T->isPointerTy();
+}
+
+bool isSupportedMemoryType(const llvm::Type *T) {
+  return isSupportedElementType(T) && !T->isIntegerTy(1);
+}
+
+std::string toString(const llvm::Value &V) {
+  std::string Str;
+  llvm::raw_string_ostream OS{Str};
+  V.printAsOperand(OS, false);
+  return OS.str();
+}
+
+std::string toString(const llvm::Type &T) {
+  std::string Str;
+  llvm::raw_string_ostream OS{Str};
+  T.print(OS);
+  return OS.str();
+}
+
+enum class AccessKind {
+  Scalar,     // uniform load, executed once
+  Contiguous, // consecutive addresses, (masked) vector load / store
+  GatherScatter
+};
+
+struct VectorizationStatistics {
+  unsigned LinearizedBranches = 0;
+  unsigned DivergentBranches = 0;
+  unsigned MaskedBlocks = 0;
+  unsigned ScalarInstructions = 0;
+  unsigned VectorInstructions = 0;
+  unsigned ContiguousAccesses = 0;
+  unsigned MaskedAccesses = 0;
+  unsigned GathersScatters = 0;
+};
+
+// Vectorizes a single innermost work-item loop.
+// Consecutive work-items are mapped to the lanes of a vector. The acyclic loop body is
+// linearized in reverse post-order, control flow is turned into block and edge masks and phis
+// into selects. Values that are uniform or strided according to the VectorizationAnalysis are
+// computed once for the first lane, and widened only if needed. The original loop remains as
+// the remainder loop for local sizes that are not a multiple of the vector width.
+class RegionVectorizer {
+public:
+  RegionVectorizer(llvm::Function &F, llvm::Loop &L, llvm::LoopInfo &LI, llvm::DominatorTree &DT,
+                   llvm::PostDominatorTree &PDT, const llvm::TargetTransformInfo &TTI,
+                   llvm::OptimizationRemarkEmitter &ORE)
+      : F_(F), L_(L), LI_(LI), DT_(DT), PDT_(PDT), TTI_(TTI), ORE_(ORE), LoopRegion_(L),
+        Region_(LoopRegion_), VecInfo_(F, Region_), Builder_(F.getContext()) {}
+
+  bool run() {
+    std::string Reason;
+    if (!matchLoop(Reason) || !checkInstructions(Reason) || !selectVectorWidth(Reason)) {
+      reportMissed(Reason);
+      return false;
+    }
+    if (NumBranches_ == 0) {
+      HIPSYCL_DEBUG_INFO << "[RegionVectorizer] no control flow in " << Header_->getName()
+                         << ", leaving it to the loop vectorizer\n";
+      ORE_.emit([&]() {
+        return llvm::OptimizationRemarkAnalysis(RemarkPassName, "NoControlFlow", L_.getStartLoc(),
+                                                Header_)
+               << "work-item loop has no control flow, left to the loop vectorizer";
+      });
+      return false;
+    }
+
+    analyzeShapes();
+    planValues();
+    if (!checkTargetSupport(Reason)) {
+      reportMissed(Reason);
+      return false;
+    }
+
+    emitVectorLoop();
+    reportVectorized();
+    return true;
+  }
+
+private:
+  llvm::Function &F_;
+  llvm::Loop &L_;
+  llvm::LoopInfo &LI_;
+  llvm::DominatorTree &DT_;
+  llvm::PostDominatorTree &PDT_;
+  const llvm::TargetTransformInfo &TTI_;
+  llvm::OptimizationRemarkEmitter &ORE_;
+
+  LoopRegion LoopRegion_;
+  Region Region_;
+  VectorizationInfo VecInfo_;
+
+  // canonical wi-loop
+  llvm::BasicBlock *Preheader_ = nullptr;
+  llvm::BasicBlock *Header_ = nullptr;
+  llvm::BasicBlock *Latch_ = nullptr;
+  llvm::BasicBlock *Exit_ = nullptr;
+  llvm::PHINode *IndVar_ = nullptr;
+  llvm::Instruction *IndVarInc_ = nullptr;
+  llvm::ICmpInst *LatchCmp_ = nullptr;
+  llvm::Value *TripCount_ = nullptr;
+
+  unsigned NumBranches_ = 0;
+  unsigned WidestTypeBits_ = 8;
+  unsigned VF_ = 1;
+
+  // plan
+  std::vector<llvm::BasicBlock *> Blocks_;
+  llvm::SmallPtrSet<const llvm::BasicBlock *, 8> MaskedBlocks_;
+  llvm::SmallPtrSet<const llvm::Value *, 16> ScalarValues_;
+  llvm::DenseMap<const llvm::Instruction *, AccessKind> Accesses_;
+
+  // codegen
+  llvm::IRBuilder<> Builder_;
+  llvm::Instruction *InvariantInsertPt_ = nullptr;
+  llvm::PHINode *VecIV_ = nullptr;
+  llvm::Value *VecIdx_ = nullptr;
+  llvm::DenseMap<const llvm::Value *, llvm::Value *> ScalarMap_;
+  llvm::DenseMap<const llvm::Value *, llvm::Value *> VectorMap_;
+  llvm::DenseMap<std::pair<const llvm::BasicBlock *, const llvm::BasicBlock *>, llvm::Value *>
+      EdgeMasks_;
+
+  VectorizationStatistics Stats_;
+
+  bool isIndVarUpdate(const llvm::Instruction &I) const {
+    return &I == IndVar_ || &I == IndVarInc_ || &I == LatchCmp_ || &I == Latch_->getTerminator();
+  }
+
+  VectorShape getShape(const llvm::Value &V) const {
+    const auto *I = llvm::dyn_cast<llvm::Instruction>(&V);
+    if (I && !L_.contains(I))
+      return VectorShape::uni();
+    return VecInfo_.getVectorShape(V);
+  }
+
+  bool hasScalar(const llvm::Value *V) const {
+    const auto *I = llvm::dyn_cast<llvm::Instruction>(V);
+    return !I || !L_.contains(I) || I == IndVar_ || ScalarValues_.contains(I);
+  }
+
+  static llvm::SmallVector<llvm::Value *, 4> valueOperands(const llvm::Instruction &I) {
+    if (const auto *CB = llvm::dyn_cast<llvm::CallBase>(&I))
+      return {CB->arg_begin(), CB->arg_end()};
+    return {I.op_begin(), I.op_end()};
+  }
+
+  bool matchLoop(std::string &Reason) {
+    Header_ = L_.getHeader();
+    Preheader_ = L_.getLoopPreheader();
+    Latch_ = L_.getLoopLatch();
+    Exit_ = L_.getExitBlock();
+    if (!Preheader_ || !Latch_ || !Exit_ || L_.getExitingBlock() != Latch_) {
+      Reason = "loop is not in simplified form with a single exit at the latch";
+      return false;
+    }
+    if (!L_.getSubLoops().empty()) {
+      Reason = "loop contains a nested loop";
+      return false;
+    }
+    if (llvm::isa<llvm::PHINode>(Exit_->begin())) {
+      Reason = "loop exit block has phi nodes";
+      return false;
+    }
+
+    for (auto &Phi : Header_->phis()) {
+      if (IndVar_) {
+        Reason = "loop carries values other than the work-item index";
+        return false;
+      }
+      IndVar_ = &Phi;
+    }
+    auto *LatchBr = llvm::dyn_cast<llvm::BranchInst>(Latch_->getTerminator());
+    if (!IndVar_ || !LatchBr || !LatchBr->isConditional()) {
+      Reason = "no canonical work-item index found";
+      return false;
+    }
+
+    auto *Start = llvm::dyn_cast<llvm::ConstantInt>(IndVar_->getIncomingValueForBlock(Preheader_));
+    auto *Inc = llvm::dyn_cast<llvm::BinaryOperator>(IndVar_->getIncomingValueForBlock(Latch_));
+    if (!Start || !Start->isZero() || !Inc || Inc->getOpcode() != llvm::Instruction::Add) {
+      Reason = "work-item index is not a canonical induction variable";
+      return false;
+    }
+    auto *Step = llvm::dyn_cast<llvm::ConstantInt>(
+        Inc->getOperand(0) == IndVar_ ? Inc->getOperand(1) : Inc->getOperand(0));
+    if (!Step || !Step->isOne() ||
+        (Inc->getOperand(0) != IndVar_ && Inc->getOperand(1) != IndVar_)) {
+      Reason = "work-item index is not a canonical induction variable";
+      return false;
+    }
+    IndVarInc_ = Inc;
+
+    LatchCmp_ = llvm::dyn_cast<llvm::ICmpInst>(LatchBr->getCondition());
+    if (!LatchCmp_ || !LatchCmp_->hasOneUse()) {
+      Reason = "unsupported loop exit condition";
+      return false;
+    }
+    auto Pred = LatchCmp_->getPredicate();
+    if (LatchCmp_->getOperand(0) == IndVarInc_) {
+      TripCount_ = LatchCmp_->getOperand(1);
+    } else if (LatchCmp_->getOperand(1) == IndVarInc_) {
+      TripCount_ = LatchCmp_->getOperand(0);
+      Pred = llvm::ICmpInst::getSwappedPredicate(Pred);
+    }
+    if (LatchBr->getSuccessor(0) != Header_)
+      Pred = llvm::ICmpInst::getInversePredicate(Pred);
+    if (!TripCount_ || !L_.isLoopInvariant(TripCount_) ||
+        (Pred != llvm::ICmpInst::ICMP_ULT && Pred != llvm::ICmpInst::ICMP_NE)) {
+      Reason = "unsupported loop exit condition";
+      return false;
+    }
+    for (auto *U : IndVarInc_->users()) {
+      if (U != IndVar_ && U != LatchCmp_) {
+        Reason = "incremented work-item index is used in the loop body";
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool checkInstructions(std::string &Reason) {
+    const auto &DL = F_.getParent()->getDataLayout();
+    // like the loop vectorizer, the vector width is derived from the accessed memory types
+    auto NoteWidth = [&](llvm::Type *T) {
+      WidestTypeBits_ =
+          std::max<unsigned>(WidestTypeBits_, DL.getTypeSizeInBits(T).getKnownMinValue());
+    };
+
+    for (auto *BB : L_.blocks()) {
+      auto *Br = llvm::dyn_cast<llvm::BranchInst>(BB->getTerminator());
+      if (!Br) {
+        Reason = std::string{"loop contains a '"} + BB->getTerminator()->getOpcodeName() +
+                 "' terminator";
+        return false;
+      }
+      if (BB != Latch_ && Br->isConditional() && Br->getSuccessor(0) != Br->getSuccessor(1))
+        ++NumBranches_;
+
+      for (auto &I : *BB) {
+        for (auto *U : I.users()) {
+          if (!L_.contains(llvm::cast<llvm::Instruction>(U))) {
+            Reason = toString(I) + " is used after the loop";
+            return false;
+          }
+        }
+        if (isIndVarUpdate(I) || I.isTerminator() || isDroppableInstruction(I))
+          continue;
+
+        if (!I.getType()->isVoidTy() && !isSupportedElementType(I.getType())) {
+          Reason = toString(I) + " has unsupported type " + toString(*I.getType());
+          return false;
+        }
+        for (auto *Op : valueOperands(I)) {
+          if (!isSupportedElementType(Op->getType())) {
+            Reason = "operand " + toString(*Op) + " has unsupported type " +
+                     toString(*Op->getType());
+            return false;
+          }
+        }
+
+        if (auto *Load = llvm::dyn_cast<llvm::LoadInst>(&I)) {
+          if (!Load->isSimple() || !isSupportedMemoryType(Load->getType())) {
+            Reason = "unsupported load " + toString(I);
+            return false;
+          }
+          NoteWidth(Load->getType());
+        } else if (auto *Store = llvm::dyn_cast<llvm::StoreInst>(&I)) {
+          if (!Store->isSimple() || !isSupportedMemoryType(Store->getValueOperand()->getType())) {
+            Reason = "unsupported store to " + toString(*Store->getPointerOperand());
+            return false;
+          }
+          NoteWidth(Store->getValueOperand()->getType());
+        } else if (auto *Call = llvm::dyn_cast<llvm::CallInst>(&I)) {
+          auto *Callee = Call->getCalledFunction();
+          if (!Callee || !isVectorizableIntrinsic(Callee->getIntrinsicID())) {
+            Reason = "call to " + (Callee ? ("'" + Callee->getName().str() + "'")
+                                          : std::string{"indirect function"}) +
+                     " cannot be vectorized";
+            return false;
+          }
+          for (llvm::Value *Arg : Call->args()) {
+            if (Arg->getType() != Call->getType() && !llvm::isa<llvm::Constant>(Arg)) {
+              Reason = "non-constant scalar operand of " + toString(I);
+              return false;
+            }
+          }
+        } else if (!llvm::isa<llvm::PHINode>(I) && !llvm::isa<llvm::BinaryOperator>(I) &&
+                   !llvm::isa<llvm::UnaryOperator>(I) && !llvm::isa<llvm::CastInst>(I) &&
+                   !llvm::isa<llvm::CmpInst>(I) && !llvm::isa<llvm::SelectInst>(I) &&
+                   !llvm::isa<llvm::GetElementPtrInst>(I) && !llvm::isa<llvm::FreezeInst>(I)) {
+          Reason = std::string{"unsupported instruction '"} + I.getOpcodeName() + "'";
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  bool selectVectorWidth(std::string &Reason) {
+    unsigned RegisterBits =
+        TTI_.getRegisterBitWidth(llvm::TargetTransformInfo::RGK_FixedWidthVector)
+            .getKnownMinValue();
+    while (VF_ * 2 * WidestTypeBits_ <= RegisterBits && VF_ * 2 <= MaxVectorWidth)
+      VF_ *= 2;
+    if (VF_ < 2) {
+      Reason = "target vector registers cannot hold two " + std::to_string(WidestTypeBits_) +
+               " bit values";
+      return false;
+    }
+    return true;
+  }
+
+  void analyzeShapes() {
+    // the work-item index is contiguous by definition, the exit condition is uniform as all lanes
+    // leave the vector loop together.
+    VecInfo_.setPinnedShape(*IndVar_, VectorShape::cont());
+    VecInfo_.setPinnedShape(*LatchCmp_, VectorShape::uni());
+
+    VectorizationAnalysis VecAna{VecInfo_, LI_, DT_, PDT_};
+    VecAna.analyze();
+  }
+
+  void planValues() {
+    const auto &DL = F_.getParent()->getDataLayout();
+
+    llvm::LoopBlocksRPO RPO{&L_};
+    RPO.perform(&LI_);
+    Blocks_.assign(RPO.begin(), RPO.end());
+
+    // blocks that do not post-dominate the header are not executed by all work-items
+    for (auto *BB : Blocks_)
+      if (!PDT_.dominates(BB, Header_))
+        MaskedBlocks_.insert(BB);
+
+    for (auto *BB : Blocks_) {
+      const bool IsMasked = MaskedBlocks_.contains(BB);
+      for (auto &I : *BB) {
+        if (isIndVarUpdate(I) || I.isTerminator() || isDroppableInstruction(I) ||
+            llvm::isa<llvm::PHINode>(I))
+          continue;
+
+        if (llvm::isa<llvm::LoadInst>(I) || llvm::isa<llvm::StoreInst>(I)) {
+          auto *Ptr = llvm::getLoadStorePointerOperand(&I);
+          auto *Ty = llvm::getLoadStoreType(&I);
+          auto PtrShape = getShape(*Ptr);
+          const auto Size = DL.getTypeStoreSize(Ty).getKnownMinValue();
+
+          AccessKind Kind = AccessKind::GatherScatter;
+          if (llvm::isa<llvm::LoadInst>(I) && !IsMasked && PtrShape.isUniform() && hasScalar(Ptr))
+            Kind = AccessKind::Scalar;
+          else if (PtrShape.hasStridedShape() &&
+                   PtrShape.getStride() == static_cast<stride_t>(Size) && hasScalar(Ptr))
+            Kind = AccessKind::Contiguous;
+          Accesses_[&I] = Kind;
+          if (Kind == AccessKind::Scalar)
+            ScalarValues_.insert(&I);
+          continue;
+        }
+
+        if (!getShape(I).hasStridedShape() || (IsMasked && isDivRem(I)))
+          continue;
+        if (llvm::all_of(valueOperands(I), [&](const llvm::Value *Op) { return hasScalar(Op); }))
+          ScalarValues_.insert(&I);
+      }
+    }
+  }
+
+  bool checkTargetSupport(std::string &Reason) {
+    for (auto *BB : Blocks_) {
+      const bool IsMasked = MaskedBlocks_.contains(BB);
+      for (auto &I : *BB) {
+        auto It = Accesses_.find(&I);
+        if (It == Accesses_.end() || It->second == AccessKind::Scalar ||
+            (It->second == AccessKind::Contiguous && !IsMasked))
+          continue;
+
+        auto *VecTy = llvm::FixedVectorType::get(llvm::getLoadStoreType(&I), VF_);
+        const auto Alignment = llvm::getLoadStoreAlignment(&I);
+        const bool IsLoad = llvm::isa<llvm::LoadInst>(I);
+        bool IsLegal = false;
+        const char *What = nullptr;
+        if (It->second == AccessKind::Contiguous) {
+          IsLegal = IsLoad ? TTI_.isLegalMaskedLoad(VecTy, Alignment)
+                           : TTI_.isLegalMaskedStore(VecTy, Alignment);
+          What = IsLoad ? "masked loads" : "masked stores";
+        } else {
+          IsLegal = IsLoad ? TTI_.isLegalMaskedGather(VecTy, Alignment)
+                           : TTI_.isLegalMaskedScatter(VecTy, Alignment);
+          What = IsLoad ? "gathers" : "scatters";
+        }
+        if (!IsLegal) {
+          Reason = std::string{"target does not support "} + What + " of " + toString(*VecTy);
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  llvm::Value *splat(llvm::Value *V, llvm::IRBuilder<> &B) {
+    return B.CreateVectorSplat(VF_, V, V->getName() + ".splat");
+  }
+
+  llvm::Value *getScalar(llvm::Value *V) {
+    if (V == IndVar_)
+      return VecIV_;
+    auto *I = llvm::dyn_cast<llvm::Instruction>(V);
+    if (!I || !L_.contains(I))
+      return V;
+    auto It = ScalarMap_.find(I);
+    assert(It != ScalarMap_.end() && "scalar value not yet emitted");
+    return It->second;
+  }
+
+  llvm::Value *getVector(llvm::Value *V) {
+    if (V == IndVar_)
+      return VecIdx_;
+    if (auto It = VectorMap_.find(V); It != VectorMap_.end())
+      return It->second;
+
+    llvm::Value *Vec = nullptr;
+    auto *I = llvm::dyn_cast<llvm::Instruction>(V);
+    if (!I || !L_.contains(I)) {
+      llvm::IRBuilder<> InvariantBuilder{InvariantInsertPt_};
+      Vec = splat(V, InvariantBuilder);
+    } else if (llvm::isa<llvm::LoadInst>(I) || getShape(*I).isUniform()) {
+      Vec = splat(getScalar(I), Builder_);
+    } else {
+      // strided value that was only needed for the first lane so far
+      Vec = widen(*I, nullptr);
+    }
+    VectorMap_[V] = Vec;
+    return Vec;
+  }
+
+  // poison in inactive lanes must not reach the masks, so masks are combined as selects.
+  llvm::Value *andMask(llvm::Value *Mask, llvm::Value *Cond) {
+    return Mask ? Builder_.CreateLogicalAnd(Mask, Cond) : Cond;
+  }
+
+  llvm::Value *computeBlockMask(llvm::BasicBlock *BB) {
+    if (!MaskedBlocks_.contains(BB))
+      return nullptr;
+    ++Stats_.MaskedBlocks;
+
+    llvm::Value *Mask = nullptr;
+    llvm::SmallPtrSet<llvm::BasicBlock *, 4> Visited;
+    for (auto *Pred : llvm::predecessors(BB)) {
+      if (!Visited.insert(Pred).second)
+        continue;
+      auto *EdgeMask = EdgeMasks_.lookup({Pred, BB});
+      if (!EdgeMask)
+        return nullptr;
+      Mask = Mask ? Builder_.CreateLogicalOr(Mask, EdgeMask, BB->getName() + ".mask") : EdgeMask;
+    }
+    return Mask;
+  }
+
+  void computeEdgeMasks(llvm::BasicBlock *BB, llvm::BranchInst &Br, llvm::Value *Mask) {
+    if (Br.isUnconditional() || Br.getSuccessor(0) == Br.getSuccessor(1)) {
+      for (auto *Succ : Br.successors())
+        EdgeMasks_[{BB, Succ}] = Mask;
+      return;
+    }
+    ++Stats_.LinearizedBranches;
+    if (!getShape(*Br.getCondition()).isUniform())
+      ++Stats_.DivergentBranches;
+
+    auto *Cond = getVector(Br.getCondition());
+    EdgeMasks_[{BB, Br.getSuccessor(0)}] = andMask(Mask, Cond);
+    EdgeMasks_[{BB, Br.getSuccessor(1)}] = andMask(Mask, Builder_.CreateNot(Cond));
+  }
+
+  llvm::Value *emitPhi(llvm::PHINode &Phi) {
+    llvm::Value *Result = nullptr;
+    for (unsigned Idx = 0; Idx < Phi.getNumIncomingValues(); ++Idx) {
+      auto *EdgeMask = EdgeMasks_.lookup({Phi.getIncomingBlock(Idx), Phi.getParent()});
+      auto *Incoming = getVector(Phi.getIncomingValue(Idx));
+      if (!EdgeMask)
+        return Incoming;
+      Result = Result ? Builder_.CreateSelect(EdgeMask, Incoming, Result, Phi.getName()) : Incoming;
+    }
+    return Result;
+  }
+
+  llvm::Value *cloneScalar(llvm::Instruction &I) {
+    auto *NewI = I.clone();
+    for (auto &Op : NewI->operands())
+      Op.set(getScalar(Op.get()));
+    if (MaskedBlocks_.contains(I.getParent()))
+      NewI->dropPoisonGeneratingFlags();
+    ++Stats_.ScalarInstructions;
+    return Builder_.Insert(NewI, I.getName());
+  }
+
+  llvm::Value *widen(llvm::Instruction &I, llvm::Value *Mask) {
+    const bool IsMasked = MaskedBlocks_.contains(I.getParent());
+    const auto Name = I.getName() + ".vec";
+    llvm::Value *Result = nullptr;
+
+    if (auto *BinOp = llvm::dyn_cast<llvm::BinaryOperator>(&I)) {
+      auto *LHS = getVector(BinOp->getOperand(0));
+      auto *RHS = getVector(BinOp->getOperand(1));
+      // inactive lanes must not divide by zero
+      if (Mask && isDivRem(I))
+        RHS = Builder_.CreateSelect(Mask, RHS, llvm::ConstantInt::get(RHS->getType(), 1));
+      Result = Builder_.CreateBinOp(BinOp->getOpcode(), LHS, RHS, Name);
+    } else if (auto *UnOp = llvm::dyn_cast<llvm::UnaryOperator>(&I)) {
+      Result = Builder_.CreateUnOp(UnOp->getOpcode(), getVector(UnOp->getOperand(0)), Name);
+    } else if (auto *Cast = llvm::dyn_cast<llvm::CastInst>(&I)) {
+      Result = Builder_.CreateCast(Cast->getOpcode(), getVector(Cast->getOperand(0)),
+                                   llvm::FixedVectorType::get(Cast->getDestTy(), VF_), Name);
+    } else if (auto *Cmp = llvm::dyn_cast<llvm::CmpInst>(&I)) {
+      Result = Builder_.CreateCmp(Cmp->getPredicate(), getVector(Cmp->getOperand(0)),
+                                  getVector(Cmp->getOperand(1)), Name);
+    } else if (auto *Select = llvm::dyn_cast<llvm::SelectInst>(&I)) {
+      auto *Cond = Select->getCondition();
+      Result = Builder_.CreateSelect(
+          getShape(*Cond).isUniform() && hasScalar(Cond) ? getScalar(Cond) : getVector(Cond),
+          getVector(Select->getTrueValue()), getVector(Select->getFalseValue()), Name);
+    } else if (auto *GEP = llvm::dyn_cast<llvm::GetElementPtrInst>(&I)) {
+      llvm::SmallVector<llvm::Value *, 4> Indices;
+      for (llvm::Value *Idx : GEP->indices())
+        Indices.push_back(llvm::isa<llvm::Constant>(Idx) ? Idx : getVector(Idx));
+      Result = Builder_.CreateGEP(GEP->getSourceElementType(),
+                                  getVector(GEP->getPointerOperand()), Indices, Name);
+    } else if (auto *Freeze = llvm::dyn_cast<llvm::FreezeInst>(&I)) {
+      Result = Builder_.CreateFreeze(getVector(Freeze->getOperand(0)), Name);
+    } else {
+      auto &Call = llvm::cast<llvm::CallInst>(I);
+      const auto ID = Call.getCalledFunction()->getIntrinsicID();
+      llvm::SmallVector<llvm::Value *, 3> Args;
+      for (llvm::Value *Arg : Call.args())
+        Args.push_back(Arg->getType() == Call.getType() ? getVector(Arg) : Arg);
+      if (IsMasked && hasPoisonFlagOperand(ID))
+        Args[1] = Builder_.getFalse();
+      Result = Builder_.CreateIntrinsic(ID, {llvm::FixedVectorType::get(Call.getType(), VF_)},
+                                        Args, nullptr, Name);
+    }
+
+    if (auto *NewI = llvm::dyn_cast<llvm::Instruction>(Result)) {
+      NewI->copyIRFlags(&I);
+      if (IsMasked)
+        NewI->dropPoisonGeneratingFlags();
+    }
+    ++Stats_.VectorInstructions;
+    return Result;
+  }
+
+  llvm::Value *getVectorPointer(llvm::Value *Ptr, llvm::Type *VecTy) {
+    return Builder_.CreatePointerCast(
+        getScalar(Ptr), llvm::PointerType::get(VecTy, Ptr->getType()->getPointerAddressSpace()));
+  }
+
+  void copyAliasMetadata(llvm::Value *To, const llvm::Instruction &From) {
+    if (auto *I = llvm::dyn_cast<llvm::Instruction>(To))
+      I->copyMetadata(From, {llvm::LLVMContext::MD_tbaa, llvm::LLVMContext::MD_alias_scope,
+                             llvm::LLVMContext::MD_noalias});
+  }
+
+  void emitLoad(llvm::LoadInst &Load, llvm::Value *Mask) {
+    const auto Kind = Accesses_.lookup(&Load);
+    if (Kind == AccessKind::Scalar) {
+      ScalarMap_[&Load] = cloneScalar(Load);
+      return;
+    }
+
+    auto *VecTy = llvm::FixedVectorType::get(Load.getType(), VF_);
+    const auto Name = Load.getName() + ".vec";
+    llvm::Value *Result = nullptr;
+    if (Kind == AccessKind::Contiguous) {
+      auto *VecPtr = getVectorPointer(Load.getPointerOperand(), VecTy);
+      if (Mask)
+        Result = Builder_.CreateMaskedLoad(VecTy, VecPtr, Load.getAlign(), Mask, nullptr, Name);
+      else
+        Result = Builder_.CreateAlignedLoad(VecTy, VecPtr, Load.getAlign(), Name);
+      ++Stats_.ContiguousAccesses;
+    } else {
+      Result = Builder_.CreateMaskedGather(VecTy, getVector(Load.getPointerOperand()),
+                                           Load.getAlign(), Mask, nullptr, Name);
+      ++Stats_.GathersScatters;
+    }
+    if (Mask)
+      ++Stats_.MaskedAccesses;
+    copyAliasMetadata(Result, Load);
+    VectorMap_[&Load] = Result;
+  }
+
+  void emitStore(llvm::StoreInst &Store, llvm::Value *Mask) {
+    auto *Val = getVector(Store.getValueOperand());
+    llvm::Instruction *Result = nullptr;
+    if (Accesses_.lookup(&Store) == AccessKind::Contiguous) {
+      auto *VecPtr = getVectorPointer(Store.getPointerOperand(), Val->getType());
+      if (Mask)
+        Result = Builder_.CreateMaskedStore(Val, VecPtr, Store.getAlign(), Mask);
+      else
+        Result = Builder_.CreateAlignedStore(Val, VecPtr, Store.getAlign());
+      ++Stats_.ContiguousAccesses;
+    } else {
+      Result = Builder_.CreateMaskedScatter(Val, getVector(Store.getPointerOperand()),
+                                            Store.getAlign(), Mask);
+      ++Stats_.GathersScatters;
+    }
+    if (Mask)
+      ++Stats_.MaskedAccesses;
+    copyAliasMetadata(Result, Store);
+  }
+
+  void emitBlock(llvm::BasicBlock *BB) {
+    auto *Mask = computeBlockMask(BB);
+    for (auto &I : *BB) {
+      if (isIndVarUpdate(I) || isDroppableInstruction(I))
+        continue;
+      if (auto *Br = llvm::dyn_cast<llvm::BranchInst>(&I))
+        computeEdgeMasks(BB, *Br, Mask);
+      else if (auto *Phi = llvm::dyn_cast<llvm::PHINode>(&I))
+        VectorMap_[Phi] = emitPhi(*Phi);
+      else if (auto *Load = llvm::dyn_cast<llvm::LoadInst>(&I))
+        emitLoad(*Load, Mask);
+      else if (auto *Store = llvm::dyn_cast<llvm::StoreInst>(&I))
+        emitStore(*Store, Mask);
+      else if (ScalarValues_.contains(&I))
+        ScalarMap_[&I] = cloneScalar(I);
+      else
+        VectorMap_[&I] = widen(I, Mask);
+    }
+  }
+
+  llvm::MDNode *getIsVectorizedMD() {
+    auto &Ctx = F_.getContext();
+    auto *One = llvm::ConstantInt::get(llvm::Type::getInt32Ty(Ctx), 1);
+    return llvm::MDNode::get(Ctx, {llvm::MDString::get(Ctx, "llvm.loop.isvectorized"),
+                                   llvm::ConstantAsMetadata::get(One)});
+  }
+
+  // Creates
+  //   preheader -> vec.check -> vec.body <-> vec.body -> vec.middle -> exit
+  //                   |                                     |
+  //                   +------------> scalar.ph <------------+
+  //                                     |
+  //                                     v
+  //                             original loop (remainder) -> exit
+  void emitVectorLoop() {
+    auto &Ctx = F_.getContext();
+    auto *IndTy = IndVar_->getType();
+    auto *VecCheck = llvm::BasicBlock::Create(Ctx, Header_->getName() + ".vec.check", &F_, Header_);
+    auto *VecBody = llvm::BasicBlock::Create(Ctx, Header_->getName() + ".vec.body", &F_, Header_);
+    auto *VecMiddle =
+        llvm::BasicBlock::Create(Ctx, Header_->getName() + ".vec.middle", &F_, Header_);
+    auto *ScalarPH = llvm::BasicBlock::Create(Ctx, Header_->getName() + ".scalar.ph", &F_, Header_);
+    Preheader_->getTerminator()->replaceUsesOfWith(Header_, VecCheck);
+
+    Builder_.SetInsertPoint(VecCheck);
+    auto *NumRemaining =
+        Builder_.CreateAnd(TripCount_, llvm::ConstantInt::get(IndTy, VF_ - 1), "n.rem");
+    auto *NumVector = Builder_.CreateSub(TripCount_, NumRemaining, "n.vec");
+    InvariantInsertPt_ = Builder_.CreateCondBr(
+        Builder_.CreateICmpEQ(NumVector, llvm::ConstantInt::get(IndTy, 0)), ScalarPH, VecBody);
+
+    Builder_.SetInsertPoint(VecBody);
+    VecIV_ = Builder_.CreatePHI(IndTy, 2, "vec.iv");
+    VecIV_->addIncoming(llvm::ConstantInt::get(IndTy, 0), VecCheck);
+    llvm::SmallVector<llvm::Constant *, MaxVectorWidth> LaneIds;
+    for (unsigned Lane = 0; Lane < VF_; ++Lane)
+      LaneIds.push_back(llvm::ConstantInt::get(IndTy, Lane));
+    VecIdx_ = Builder_.CreateAdd(splat(VecIV_, Builder_), llvm::ConstantVector::get(LaneIds),
+                                 "vec.idx");
+
+    for (auto *BB : Blocks_)
+      emitBlock(BB);
+
+    auto *VecIVNext = Builder_.CreateAdd(VecIV_, llvm::ConstantInt::get(IndTy, VF_),
+                                         "vec.iv.next", /*HasNUW*/ true);
+    VecIV_->addIncoming(VecIVNext, VecBody);
+    auto *VecLatchBr =
+        Builder_.CreateCondBr(Builder_.CreateICmpULT(VecIVNext, NumVector), VecBody, VecMiddle);
+
+    Builder_.SetInsertPoint(VecMiddle);
+    Builder_.CreateCondBr(Builder_.CreateICmpEQ(NumVector, TripCount_), Exit_, ScalarPH);
+
+    Builder_.SetInsertPoint(ScalarPH);
+    auto *ScalarStart = Builder_.CreatePHI(IndTy, 2, "scalar.iv.start");
+    ScalarStart->addIncoming(llvm::ConstantInt::get(IndTy, 0), VecCheck);
+    ScalarStart->addIncoming(NumVector, VecMiddle);
+    Builder_.CreateBr(Header_);
+
+    const auto PreheaderIdx = IndVar_->getBasicBlockIndex(Preheader_);
+    IndVar_->setIncomingBlock(PreheaderIdx, ScalarPH);
+    IndVar_->setIncomingValue(PreheaderIdx, ScalarStart);
+
+    // neither the vector loop nor the remainder should be vectorized again
+    llvm::SmallVector<llvm::Metadata *, 2> VecLoopMD{nullptr, getIsVectorizedMD()};
+    auto *VecLoopID = llvm::MDNode::getDistinct(Ctx, VecLoopMD);
+    VecLoopID->replaceOperandWith(0, VecLoopID);
+    VecLatchBr->setMetadata(llvm::LLVMContext::MD_loop, VecLoopID);
+    L_.setLoopID(llvm::makePostTransformationMetadata(Ctx, L_.getLoopID(), {},
+                                                      {getIsVectorizedMD()}));
+  }
+
+  void reportMissed(const std::string &Reason) {
+    HIPSYCL_DEBUG_INFO << "[RegionVectorizer] not vectorizing " << Header_->getName() << ": "
+                       << Reason << "\n";
+    ORE_.emit([&]() {
+      return llvm::OptimizationRemarkMissed(RemarkPassName, "NotVectorized", L_.getStartLoc(),
+                                            Header_)
+             << "work-item loop not vectorized: " << Reason;
+    });
+  }
+
+  void reportVectorized() {
+    HIPSYCL_DEBUG_INFO << "[RegionVectorizer] vectorized " << Header_->getName()
+                       << " with width " << VF_ << ": " << Stats_.LinearizedBranches
+                       << " linearized branches (" << Stats_.DivergentBranches << " divergent), "
+                       << Stats_.MaskedBlocks << " masked blocks, " << Stats_.ScalarInstructions
+                       << " scalar and " << Stats_.VectorInstructions
+                       << " vector instructions, " << Stats_.ContiguousAccesses
+                       << " contiguous accesses, " << Stats_.GathersScatters
+                       << " gathers / scatters, " << Stats_.MaskedAccesses << " masked accesses\n";
+    ORE_.emit([&]() {
+      using llvm::ore::NV;
+      return llvm::OptimizationRemark(RemarkPassName, "Vectorized", L_.getStartLoc(), Header_)
+             << "vectorized work-item loop (vectorization width: "
+             << NV("VectorizationFactor", VF_)
+             << ", linearized branches: " << NV("LinearizedBranches", Stats_.LinearizedBranches)
+             << ", divergent branches: " << NV("DivergentBranches", Stats_.DivergentBranches)
+             << ", masked blocks: " << NV("MaskedBlocks", Stats_.MaskedBlocks)
+             << ", scalar instructions: " << NV("ScalarInstructions", Stats_.ScalarInstructions)
+             << ", vector instructions: " << NV("VectorInstructions", Stats_.VectorInstructions)
+             << ", contiguous accesses: " << NV("ContiguousAccesses", Stats_.ContiguousAccesses)
+             << ", gathers / scatters: " << NV("GathersScatters", Stats_.GathersScatters)
+             << ", masked accesses: " << NV("MaskedAccesses", Stats_.MaskedAccesses) << ")";
+    });
+  }
+};
+#endif // LLVM_VERSION_MAJOR >= 13
+
+bool vectorizeWorkItemLoops(llvm::Function &F, const llvm::TargetTransformInfo &TTI,
+                            llvm::OptimizationRemarkEmitter &ORE) {
+#if LLVM_VERSION_MAJOR >= 13
+  if (F.hasOptNone())
+    return false;
+
+  bool Changed = false;
+  llvm::SmallPtrSet<const llvm::BasicBlock *, 4> Visited;
+  // analyses are recomputed after each transformed loop, as new blocks are added
+  for (;;) {
+    llvm::DominatorTree DT{F};
+    llvm::PostDominatorTree PDT{F};
+    llvm::LoopInfo LI{DT};
+
+    llvm::Loop *WILoop = nullptr;
+    for (auto *L : utils::getLoopsInPreorder(LI)) {
+      if (utils::isWorkItemLoop(*L) && Visited.insert(L->getHeader()).second &&
+          !llvm::getBooleanLoopAttribute(L, "llvm.loop.isvectorized")) {
+        WILoop = L;
+        break;
+      }
+    }
+    if (!WILoop)
+      break;
+
+    RegionVectorizer RV{F, *WILoop, LI, DT, PDT, TTI, ORE};
+    Changed |= RV.run();
+  }
+  return Changed;
+#else
+  HIPSYCL_DEBUG_INFO << "[RegionVectorizer] requires LLVM 13 or newer\n";
+  return false;
+#endif
+}
+} // namespace
+
+void hipsycl::compiler::RegionVectorizerPassLegacy::getAnalysisUsage(
+    llvm::AnalysisUsage &AU) const {
+  AU.addRequired<SplitterAnnotationAnalysisLegacy>();
+  AU.addPreserved<SplitterAnnotationAnalysisLegacy>();
+  AU.addRequired<llvm::TargetTransformInfoWrapperPass>();
+  AU.addPreserved<llvm::TargetTransformInfoWrapperPass>();
+  AU.addRequired<llvm::OptimizationRemarkEmitterWrapperPass>();
+}
+
+bool hipsycl::compiler::RegionVectorizerPassLegacy::runOnFunction(llvm::Function &F) {
+  const auto &SAA = getAnalysis<SplitterAnnotationAnalysisLegacy>().getAnnotationInfo();
+  if (!SAA.isKernelFunc(&F))
+    return false;
+
+  const auto &TTI = getAnalysis<llvm::TargetTransformInfoWrapperPass>().getTTI(F);
+  auto &ORE = getAnalysis<llvm::OptimizationRemarkEmitterWrapperPass>().getORE();
+
+  return vectorizeWorkItemLoops(F, TTI, ORE);
+}
+
+llvm::PreservedAnalyses
+hipsycl::compiler::RegionVectorizerPass::run(llvm::Function &F,
+                                             llvm::FunctionAnalysisManager &AM) {
+  const auto &MAMProxy = AM.getResult<llvm::ModuleAnalysisManagerFunctionProxy>(F);
+  const auto *SAA = MAMProxy.getCachedResult<SplitterAnnotationAnalysis>(*F.getParent());
+  if (!SAA) {
+    llvm::errs() << "SplitterAnnotationAnalysis not cached.\n";
+    return llvm::PreservedAnalyses::all();
+  }
+  if (!SAA->isKernelFunc(&F))
+    return llvm::PreservedAnalyses::all();
+
+  const auto &TTI = AM.getResult<llvm::TargetIRAnalysis>(F);
+  auto &ORE = AM.getResult<llvm::OptimizationRemarkEmitterAnalysis>(F);
+  if (!vectorizeWorkItemLoops(F, TTI, ORE))
+    return llvm::PreservedAnalyses::all();
+  return llvm::PreservedAnalyses::none();
+}
+
+char hipsycl::compiler::RegionVectorizerPassLegacy::ID = 0;
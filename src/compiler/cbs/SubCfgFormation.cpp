@@ -87,6 +87,20 @@ std::size_t getRangeDim(llvm::Function &F) {
   llvm_unreachable("[SubCFG] Could not deduce kernel dimensionality!");
 }
 
+// the launcher instantiates the kernel function for common work-group sizes with the local size
+// as template arguments, returns these sizes or 0 for the dimensions not known at compile time.
+llvm::SmallVector<std::uint64_t, 3> getStaticLocalSize(llvm::Function &F, int Dim) {
+  llvm::SmallVector<std::uint64_t, 3> StaticLocalSize(Dim, 0);
+  auto FName = F.getName();
+  // todo: fix with MS mangling
+  llvm::Regex Rgx("iterate_nd_range_ompILi[1-3]EL[jmy]([0-9]+)EL[jmy]([0-9]+)EL[jmy]([0-9]+)E");
+  llvm::SmallVector<llvm::StringRef, 4> Matches;
+  if (Rgx.match(FName, &Matches))
+    for (int D = 0; D < Dim; ++D)
+      Matches[D + 1].getAsInteger(10, StaticLocalSize[D]);
+  return StaticLocalSize;
+}
+
 // searches for llvm.var.annotation and returns the value that is annotated by it, as well the
 // annotation instruction
 std::pair<llvm::Value *, llvm::Instruction *>
@@ -187,6 +201,18 @@ llvm::SmallVector<llvm::Value *, 3> getLocalSizeValues(llvm::Function &F, int Di
   else
     loadSizeValuesFromArgument(F, Dim, LocalSizeArg, DL, LocalSize);
 
+  // use the compile-time local size if the kernel was specialized for it, giving constant trip
+  // counts and statically sized work-item arrays
+  const auto StaticLocalSize = getStaticLocalSize(F, Dim);
+  for (int D = 0; D < Dim; ++D)
+    if (StaticLocalSize[D] != 0) {
+      HIPSYCL_DEBUG_INFO << "[SubCFG] Using static local size " << StaticLocalSize[D]
+                         << " in dimension " << D << " of " << F.getName() << "\n";
+      LocalSize[D] = llvm::ConstantInt::get(LocalSize[D] ? LocalSize[D]->getType()
+                                                         : DL.getLargestLegalIntType(F.getContext()),
+                                            StaticLocalSize[D]);
+    }
+
   Annotation->eraseFromParent();
   return LocalSize;
 }
@@ -33,8 +33,11 @@
 #include "hipSYCL/compiler/sscp/KernelOutliningPass.hpp"
 #include "hipSYCL/glue/llvm-sscp/s2_ir_constants.hpp"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <llvm/Support/raw_ostream.h>
+#include <llvm/IR/Constants.h>
 #include <llvm/IR/Module.h>
 #include <llvm/IR/PassManager.h>
 #include <llvm/Linker/Linker.h>
@@ -64,6 +67,16 @@ bool linkBitcode(llvm::Module &M, std::unique_ptr<llvm::Module> OtherM,
   return true;
 }
 
+llvm::Error loadModule(std::string_view LLVMIR, llvm::LLVMContext &ctx,
+                       const std::vector<std::string> &OutliningEntrypoints,
+                       std::unique_ptr<llvm::Module> &M) {
+  // Everything that is not reachable from the kernels that we compile
+  // would be thrown away by kernel outlining anyway, so don't even parse it.
+  if(!OutliningEntrypoints.empty())
+    return loadModuleFromString(LLVMIR, ctx, OutliningEntrypoints, M);
+  return loadModuleFromString(LLVMIR, ctx, M);
+}
+
 }
 
 LLVMToBackendTranslator::LLVMToBackendTranslator(int S2IRConstantCurrentBackendId,
@@ -72,26 +85,30 @@ LLVMToBackendTranslator::LLVMToBackendTranslator(int S2IRConstantCurrentBackendI
 
 bool LLVMToBackendTranslator::setBuildFlag(const std::string &Flag) { 
   HIPSYCL_DEBUG_INFO << "LLVMToBackend: Using build flag: " << Flag << "\n";
+  BuildConfiguration.push_back("flag:" + Flag);
   return applyBuildFlag(Flag);
 }
 
 bool LLVMToBackendTranslator::setBuildOption(const std::string &Option, const std::string &Value) {
   HIPSYCL_DEBUG_INFO << "LLVMToBackend: Using build option: " << Option << "=" << Value << "\n";
+  BuildConfiguration.push_back("option:" + Option + "=" + Value);
   return applyBuildOption(Option, Value);
 }
 bool LLVMToBackendTranslator::setBuildToolArguments(const std::string &ToolName,
                                     const std::vector<std::string> &Args) {
   HIPSYCL_DEBUG_INFO << "LLVMToBackend: Using tool arguments for tool " << ToolName << ":\n";
+  BuildConfiguration.push_back("tool:" + ToolName);
   for(const auto& A : Args) {
     HIPSYCL_DEBUG_INFO << "   " << A << "\n";
+    BuildConfiguration.push_back("tool-arg:" + A);
   }
   return applyBuildToolArguments(ToolName, Args);
 }
 
-bool LLVMToBackendTranslator::partialTransformation(const std::string &LLVMIR, std::string &Out) {
+bool LLVMToBackendTranslator::partialTransformation(std::string_view LLVMIR, std::string &Out) {
   llvm::LLVMContext ctx;
   std::unique_ptr<llvm::Module> M;
-  auto err = loadModuleFromString(LLVMIR, ctx, M);
+  auto err = loadModule(LLVMIR, ctx, OutliningEntrypoints, M);
 
   if (err) {
     this->registerError("LLVMToBackend: Could not load LLVM module");
@@ -113,10 +130,10 @@ bool LLVMToBackendTranslator::partialTransformation(const std::string &LLVMIR, s
   return true;
 }
 
-bool LLVMToBackendTranslator::fullTransformation(const std::string &LLVMIR, std::string &out) {
+bool LLVMToBackendTranslator::fullTransformation(std::string_view LLVMIR, std::string &out) {
   llvm::LLVMContext ctx;
   std::unique_ptr<llvm::Module> M;
-  auto err = loadModuleFromString(LLVMIR, ctx, M);
+  auto err = loadModule(LLVMIR, ctx, OutliningEntrypoints, M);
 
   if (err) {
     this->registerError("LLVMToBackend: Could not load LLVM module");
@@ -157,6 +174,10 @@ bool LLVMToBackendTranslator::prepareIR(llvm::Module &M) {
     A.second(M);
   }
 
+  HIPSYCL_DEBUG_INFO << "LLVMToBackend: Applying kernel argument specializations...\n";
+  for(auto& A : KernelArgumentSpecializations)
+    A(M);
+
   bool ContainsUnsetIRConstants = false;
   bool FlavoringSuccessful = false;
   bool OptimizationSuccessful = false;
@@ -235,12 +256,16 @@ bool LLVMToBackendTranslator::optimizeFlavoredIR(llvm::Module& M, PassHandler& P
   return true;
 }
 
-bool LLVMToBackendTranslator::linkBitcodeString(llvm::Module &M, const std::string &Bitcode,
+bool LLVMToBackendTranslator::linkBitcodeString(llvm::Module &M, std::string_view Bitcode,
                                                 const std::string &ForcedTriple,
                                                 const std::string &ForcedDataLayout,
                                                 bool LinkOnlyNeeded) {
   std::unique_ptr<llvm::Module> OtherModule;
-  auto err = loadModuleFromString(Bitcode, M.getContext(), OtherModule);
+  // When only linking needed definitions, the linker only materializes
+  // the functions that it actually links.
+  auto err = LinkOnlyNeeded
+                 ? loadLazyModuleFromString(Bitcode, M.getContext(), OtherModule)
+                 : loadModuleFromString(Bitcode, M.getContext(), OtherModule);
 
   if (err) {
     this->registerError("LLVMToBackend: Could not load LLVM module");
@@ -272,7 +297,7 @@ bool LLVMToBackendTranslator::linkBitcodeFile(llvm::Module &M, const std::string
     return false;
   }
   HIPSYCL_DEBUG_INFO << "LLVMToBackend: Linking with bitcode file: " << BitcodeFile << "\n";
-  return linkBitcodeString(M, std::string{F.get()->getBuffer()}, ForcedTriple, ForcedDataLayout,
+  return linkBitcodeString(M, std::string_view{F.get()->getBuffer()}, ForcedTriple, ForcedDataLayout,
                            LinkOnlyNeeded);
 }
 
@@ -283,6 +308,50 @@ void LLVMToBackendTranslator::setS2IRConstant(const std::string &name, const voi
   };
 }
 
+void LLVMToBackendTranslator::specializeKernelArgument(const std::string &KernelName,
+                                                       std::size_t ParamIndex,
+                                                       const void *ValueBuffer,
+                                                       std::size_t ValueSize) {
+  uint64_t Value = 0;
+  std::memcpy(&Value, ValueBuffer, std::min(ValueSize, sizeof(Value)));
+
+  KernelArgumentSpecializations.push_back([=](llvm::Module &M) {
+    llvm::Function *F = M.getFunction(KernelName);
+    if(!F || ParamIndex >= F->arg_size()) {
+      HIPSYCL_DEBUG_WARNING << "LLVMToBackend: Cannot specialize parameter " << ParamIndex
+                            << " of kernel " << KernelName << ", ignoring\n";
+      return;
+    }
+
+    llvm::Argument *Arg = F->getArg(ParamIndex);
+    llvm::Type *T = Arg->getType();
+    llvm::Constant *C = nullptr;
+    if(T->isIntegerTy() && T->getIntegerBitWidth() <= 8 * ValueSize) {
+      unsigned BitWidth = T->getIntegerBitWidth();
+      uint64_t Mask = BitWidth >= 64 ? ~uint64_t{0} : ((uint64_t{1} << BitWidth) - 1);
+      C = llvm::ConstantInt::get(T, Value & Mask);
+    } else if(T->isFloatTy() && ValueSize == sizeof(float)) {
+      float FloatValue;
+      std::memcpy(&FloatValue, &Value, sizeof(float));
+      C = llvm::ConstantFP::get(T, FloatValue);
+    } else if(T->isDoubleTy() && ValueSize == sizeof(double)) {
+      double DoubleValue;
+      std::memcpy(&DoubleValue, &Value, sizeof(double));
+      C = llvm::ConstantFP::get(T, DoubleValue);
+    }
+
+    if(!C) {
+      HIPSYCL_DEBUG_WARNING << "LLVMToBackend: Parameter " << ParamIndex << " of kernel "
+                            << KernelName << " has unsupported type for specialization, ignoring\n";
+      return;
+    }
+
+    HIPSYCL_DEBUG_INFO << "LLVMToBackend: Specializing parameter " << ParamIndex << " of kernel "
+                       << KernelName << "\n";
+    Arg->replaceAllUsesWith(C);
+  });
+}
+
 void LLVMToBackendTranslator::provideExternalSymbolResolver(ExternalSymbolResolver Resolver) {
   this->SymbolResolver = Resolver;
   this->HasExternalSymbolResolver = true;
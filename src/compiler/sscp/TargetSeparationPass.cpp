@@ -379,8 +379,9 @@ std::string generateHCF(llvm::Module& DeviceModule,
     }
   }
   
-
-  return HcfObject.serialize();
+  // The binary format is faster to load at application startup
+  // than the text format.
+  return HcfObject.serialize_binary();
 }
 
 llvm::PreservedAnalyses TargetSeparationPass::run(llvm::Module &M,
@@ -0,0 +1,287 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "hipSYCL/runtime/caching_allocator.hpp"
+#include "hipSYCL/runtime/application.hpp"
+#include "hipSYCL/runtime/inorder_executor.hpp"
+#include "hipSYCL/runtime/settings.hpp"
+#include "hipSYCL/common/debug.hpp"
+
+#include <algorithm>
+
+namespace hipsycl {
+namespace rt {
+
+caching_allocator::caching_allocator(backend_allocator *underlying,
+                                     device_id dev,
+                                     std::size_t max_cached_bytes)
+    : _underlying{underlying}, _dev{dev}, _max_cached_bytes{max_cached_bytes} {}
+
+caching_allocator::~caching_allocator() {
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  // At this point, all operations have completed, so pending
+  // blocks can be released as well.
+  for(const auto& pending : _pending_blocks)
+    _underlying->free(pending.ptr);
+  _pending_blocks.clear();
+  trim_to(0);
+
+  HIPSYCL_DEBUG_INFO << "caching_allocator: Shutting down; " << _stats.num_hits
+                     << " hits, " << _stats.num_misses << " misses, peak "
+                     << _stats.peak_allocated_bytes << " bytes allocated"
+                     << std::endl;
+}
+
+std::unique_ptr<caching_allocator>
+caching_allocator::create_if_enabled(backend_allocator *underlying,
+                                     device_id dev) {
+  if(!application::get_settings().get<setting::allocation_pooling>())
+    return nullptr;
+
+  std::size_t max_cached_bytes =
+      application::get_settings().get<setting::allocation_pool_max_cached_size>() *
+      1024 * 1024;
+  return std::make_unique<caching_allocator>(underlying, dev,
+                                             max_cached_bytes);
+}
+
+void *caching_allocator::allocate(size_t min_alignment, size_t size_bytes) {
+  return allocate_block(memory_kind::device, min_alignment, size_bytes);
+}
+
+void *caching_allocator::allocate_optimized_host(size_t min_alignment,
+                                                 size_t bytes) {
+  return allocate_block(memory_kind::optimized_host, min_alignment, bytes);
+}
+
+void *caching_allocator::allocate_usm(size_t bytes) {
+  return allocate_block(memory_kind::usm, 0, bytes);
+}
+
+void caching_allocator::free(void *mem) {
+  // Freeing memory with the driver implicitly waits for operations that
+  // might still use it. Instead of blocking, the block is only handed out
+  // again after everything submitted to the device so far has completed.
+  free_after(mem, inorder_executor::create_device_fence(_dev));
+}
+
+void caching_allocator::free_after(
+    void *mem, std::shared_ptr<dag_node_event> reuse_after) {
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    if(release_to_pool(mem, reuse_after))
+      return;
+  }
+  // Not from the pool, e.g. because it was larger than the
+  // largest size class
+  if(reuse_after)
+    reuse_after->wait();
+  _underlying->free(mem);
+}
+
+bool caching_allocator::is_usm_accessible_from(backend_descriptor b) const {
+  return _underlying->is_usm_accessible_from(b);
+}
+
+result caching_allocator::query_pointer(const void *ptr,
+                                        pointer_info &out) const {
+  // Blocks are never split, so each block is a backend allocation
+  return _underlying->query_pointer(ptr, out);
+}
+
+result caching_allocator::mem_advise(const void *addr, std::size_t num_bytes,
+                                     int advise) const {
+  return _underlying->mem_advise(addr, num_bytes, advise);
+}
+
+void caching_allocator::trim() {
+  std::lock_guard<std::mutex> lock{_mutex};
+  reclaim_completed_blocks();
+  trim_to(0);
+}
+
+caching_allocator_statistics caching_allocator::get_statistics() const {
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _stats;
+}
+
+void *caching_allocator::allocate_block(memory_kind kind,
+                                        std::size_t min_alignment,
+                                        std::size_t size) {
+  std::size_t requested_size = size;
+  // Blocks are aligned to at least their size class
+  size = std::max({size, min_alignment, std::size_t{1}});
+  int size_class = get_size_class(size);
+
+  if(size_class > max_size_class)
+    return allocate_from_backend(kind, min_alignment, size);
+
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    reclaim_completed_blocks();
+
+    auto& free_list = get_free_list(kind, size_class);
+    // Prefer the most recently freed block, it is most likely
+    // to still be in the cache
+    for(auto it = free_list.rbegin(); it != free_list.rend(); ++it) {
+      void* ptr = *it;
+      if(min_alignment == 0 ||
+         reinterpret_cast<std::size_t>(ptr) % min_alignment == 0) {
+        free_list.erase(std::next(it).base());
+
+        std::size_t block_size = get_size_class_bytes(size_class);
+        _stats.cached_bytes -= block_size;
+        _stats.allocated_bytes += block_size;
+        _stats.requested_bytes += requested_size;
+        _stats.peak_allocated_bytes =
+            std::max(_stats.peak_allocated_bytes, _stats.allocated_bytes);
+        ++_stats.num_hits;
+        _live_blocks[ptr] = live_block_info{kind, size_class, requested_size};
+        return ptr;
+      }
+    }
+    ++_stats.num_misses;
+  }
+
+  std::size_t block_size = get_size_class_bytes(size_class);
+  void* ptr = allocate_from_backend(kind, min_alignment, block_size);
+  if(!ptr) {
+    // The backend might be out of memory - release what we have cached
+    // and try again.
+    bool has_trimmed = false;
+    {
+      std::lock_guard<std::mutex> lock{_mutex};
+      reclaim_completed_blocks();
+      if(_stats.cached_bytes > 0) {
+        trim_to(0);
+        has_trimmed = true;
+      }
+    }
+    if(has_trimmed) {
+      HIPSYCL_DEBUG_INFO << "caching_allocator: Allocation failed, retrying "
+                            "after releasing cached blocks"
+                         << std::endl;
+      ptr = allocate_from_backend(kind, min_alignment, block_size);
+    }
+  }
+
+  if(ptr) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _stats.allocated_bytes += block_size;
+    _stats.requested_bytes += requested_size;
+    _stats.peak_allocated_bytes =
+        std::max(_stats.peak_allocated_bytes, _stats.allocated_bytes);
+    _live_blocks[ptr] = live_block_info{kind, size_class, requested_size};
+  }
+  return ptr;
+}
+
+void *caching_allocator::allocate_from_backend(memory_kind kind,
+                                               std::size_t min_alignment,
+                                               std::size_t size) {
+  if(kind == memory_kind::device)
+    return _underlying->allocate(min_alignment, size);
+  else if(kind == memory_kind::optimized_host)
+    return _underlying->allocate_optimized_host(min_alignment, size);
+  else
+    return _underlying->allocate_usm(size);
+}
+
+bool caching_allocator::release_to_pool(
+    void *mem, const std::shared_ptr<dag_node_event> &reuse_after) {
+  auto it = _live_blocks.find(mem);
+  if(it == _live_blocks.end())
+    return false;
+
+  live_block_info info = it->second;
+  _live_blocks.erase(it);
+
+  std::size_t block_size = get_size_class_bytes(info.size_class);
+  _stats.allocated_bytes -= block_size;
+  _stats.requested_bytes -= info.requested_size;
+  _stats.cached_bytes += block_size;
+
+  if(reuse_after && !reuse_after->is_complete()) {
+    _pending_blocks.push_back(
+        pending_block{mem, info.kind, info.size_class, reuse_after});
+  } else {
+    get_free_list(info.kind, info.size_class).push_back(mem);
+  }
+
+  if(_stats.cached_bytes > _max_cached_bytes)
+    trim_to(_max_cached_bytes);
+
+  return true;
+}
+
+void caching_allocator::reclaim_completed_blocks() {
+  auto first_reclaimed = std::stable_partition(
+      _pending_blocks.begin(), _pending_blocks.end(),
+      [](const pending_block &b) { return !b.reuse_after->is_complete(); });
+
+  for(auto it = first_reclaimed; it != _pending_blocks.end(); ++it)
+    get_free_list(it->kind, it->size_class).push_back(it->ptr);
+  _pending_blocks.erase(first_reclaimed, _pending_blocks.end());
+}
+
+void caching_allocator::trim_to(std::size_t max_cached_bytes) {
+  bool has_trimmed = false;
+  // Release large blocks first, as they are least likely to be reused
+  for(int size_class = max_size_class;
+      size_class >= min_size_class && _stats.cached_bytes > max_cached_bytes;
+      --size_class) {
+    std::size_t block_size = get_size_class_bytes(size_class);
+    for(int kind = 0; kind < num_memory_kinds; ++kind) {
+      auto& free_list =
+          get_free_list(static_cast<memory_kind>(kind), size_class);
+      while(!free_list.empty() && _stats.cached_bytes > max_cached_bytes) {
+        // Release the least recently used block first
+        _underlying->free(free_list.front());
+        free_list.erase(free_list.begin());
+        _stats.cached_bytes -= block_size;
+        has_trimmed = true;
+      }
+    }
+  }
+  if(has_trimmed)
+    ++_stats.num_trims;
+}
+
+int caching_allocator::get_size_class(std::size_t size) {
+  int size_class = min_size_class;
+  while(size_class <= max_size_class && get_size_class_bytes(size_class) < size)
+    ++size_class;
+  return size_class;
+}
+
+std::size_t caching_allocator::get_size_class_bytes(int size_class) {
+  return std::size_t{1} << size_class;
+}
+
+}
+}
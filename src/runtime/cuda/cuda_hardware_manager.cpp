@@ -117,10 +117,16 @@ cuda_hardware_context::cuda_hardware_context(int dev)
 
   _allocator = std::make_unique<cuda_allocator>(
       backend_descriptor{hardware_platform::cuda, api_platform::cuda}, _dev);
+  _caching_allocator = caching_allocator::create_if_enabled(
+      _allocator.get(),
+      device_id{backend_descriptor{hardware_platform::cuda, api_platform::cuda},
+                _dev});
   _event_pool = std::make_unique<cuda_event_pool>(_dev);
 }
 
-cuda_allocator* cuda_hardware_context::get_allocator() const {
+backend_allocator* cuda_hardware_context::get_allocator() const {
+  if(_caching_allocator)
+    return _caching_allocator.get();
   return _allocator.get();
 }
 
@@ -41,10 +41,12 @@
 #include "hipSYCL/runtime/hints.hpp"
 #include "hipSYCL/runtime/inorder_queue.hpp"
 #include "hipSYCL/runtime/kernel_launcher.hpp"
+#include "hipSYCL/runtime/kernel_argument_tracker.hpp"
 #include "hipSYCL/runtime/operations.hpp"
 #include "hipSYCL/runtime/serialization/serialization.hpp"
 #include "hipSYCL/runtime/util.hpp"
 #include "hipSYCL/runtime/queue_completion_event.hpp"
+#include "hipSYCL/runtime/batch_completion_event.hpp"
 
 #ifdef HIPSYCL_WITH_SSCP_COMPILER
 
@@ -58,6 +60,7 @@
 #include <cuda.h> // For kernels launched from modules
 
 #include <cassert>
+#include <chrono>
 #include <memory>
 
 namespace hipsycl {
@@ -242,6 +245,10 @@ std::shared_ptr<dag_node_event> cuda_queue::create_queue_completion_event() {
       this);
 }
 
+std::shared_ptr<dag_node_event> cuda_queue::create_batch_completion_event() {
+  return std::make_shared<batch_completion_event<cudaEvent_t>>(this);
+}
+
 
 result cuda_queue::submit_memcpy(memcpy_operation & op, dag_node_ptr node) {
 
@@ -371,6 +378,21 @@ result cuda_queue::submit_kernel(kernel_operation &op, dag_node_ptr node) {
   return make_success();
 }
 
+bool cuda_queue::prepare_kernel(kernel_operation &op, dag_node_ptr node) {
+  rt::backend_kernel_launcher *l =
+      op.get_launcher().find_launcher(backend_id::cuda);
+  if (!l)
+    // Error is reported by submit_kernel()
+    return true;
+
+  rt::backend_kernel_launch_capabilities cap;
+  cap.provide_multipass_invoker(&_multipass_code_object_invoker);
+  cap.provide_sscp_invoker(&_sscp_code_object_invoker);
+  l->set_backend_capabilities(cap);
+
+  return l->prepare(node.get(), op.get_launcher().get_kernel_configuration());
+}
+
 result cuda_queue::submit_prefetch(prefetch_operation& op, dag_node_ptr node) {
 #ifndef _WIN32
   
@@ -605,16 +627,13 @@ result cuda_queue::submit_multipass_kernel_from_code_object(
 }
 
 
-result cuda_queue::submit_sscp_kernel_from_code_object(
+result cuda_queue::request_sscp_code_object(
     const kernel_operation &op, hcf_object_id hcf_object,
-    const std::string &kernel_name, const rt::range<3> &num_groups,
-    const rt::range<3> &group_size, unsigned local_mem_size, void **args,
-    std::size_t *arg_sizes, std::size_t num_args,
-    const glue::kernel_configuration &config) {
+    const std::string &kernel_name, const glue::kernel_configuration &config,
+    kernel_cache::code_object_future &code_object_out,
+    const hcf_kernel_info *&kernel_info_out) {
 #ifdef HIPSYCL_WITH_SSCP_COMPILER
 
-  this->activate_device();
-
   std::string global_kernel_name = op.get_global_kernel_name();
   const kernel_cache::kernel_name_index_t* kidx =
       _kernel_cache->get_global_kernel_index(global_kernel_name);
@@ -643,6 +662,7 @@ result cuda_queue::submit_sscp_kernel_from_code_object(
         error_info{"cuda_queue: Could not obtain hcf kernel info for kernel " +
             global_kernel_name});
   }
+  kernel_info_out = kernel_info;
 
   auto code_object_selector = [&](const code_object *candidate) -> bool {
     if ((candidate->managing_backend() != backend_id::cuda) ||
@@ -656,15 +676,21 @@ result cuda_queue::submit_sscp_kernel_from_code_object(
     if(obj->configuration_id() != configuration_id)
       return false;
 
+    // Objects may only contain some of the kernels of the image
+    if(!obj->contains(kernel_name))
+      return false;
+
     return obj->get_device() == device;
   };
 
-  auto code_object_constructor = [&]() -> code_object* {
+  std::vector<std::string> kernel_names;
+  std::string selected_image_name = glue::jit::select_image_and_kernels(
+      kernel_info, kernel_name, config, kernel_names);
+
+  // Runs on a JIT compilation thread, so everything needs to be
+  // captured by value.
+  auto code_object_constructor = [=]() -> code_object* {
     const common::hcf_container* hcf = rt::hcf_cache::get().get_hcf(hcf_object);
-    
-    std::vector<std::string> kernel_names;
-    std::string selected_image_name =
-        glue::jit::select_image(kernel_info, &kernel_names);
 
     // Construct PTX translator to compile the specified kernels
     std::unique_ptr<compiler::LLVMToBackendTranslator> translator = 
@@ -681,10 +707,15 @@ result cuda_queue::submit_sscp_kernel_from_code_object(
         hcf, selected_image_name, config, ptx_image);
     
     if(!err.is_success()) {
-      register_error(err);
+      kernel_argument_tracker::get().report_failed_compilation(
+          hcf_object, kernel_name, config, err);
       return nullptr;
     }
 
+    // Loading the module requires the device context to be current
+    // on the compilation thread
+    cuda_device_manager::get().activate_device(device);
+
     cuda_sscp_executable_object *exec_obj = new cuda_sscp_executable_object{
         ptx_image, target_arch_name, hcf_object, kernel_names, device, config};
     result r = exec_obj->get_build_result();
@@ -694,7 +725,8 @@ result cuda_queue::submit_sscp_kernel_from_code_object(
         << std::endl;
 
     if(!r.is_success()) {
-      register_error(r);
+      kernel_argument_tracker::get().report_failed_compilation(
+          hcf_object, kernel_name, config, r);
       delete exec_obj;
       return nullptr;
     }
@@ -702,17 +734,53 @@ result cuda_queue::submit_sscp_kernel_from_code_object(
     return exec_obj;
   };
 
-  const code_object *obj = _kernel_cache->get_or_construct_code_object(
+  code_object_out = _kernel_cache->get_or_construct_code_object_async(
       *kidx, kernel_name, backend_id::cuda, hcf_object,
+      kernel_cache::make_construction_key(backend_id::cuda, device, hcf_object,
+                                          selected_image_name,
+                                          kernel_names, configuration_id),
       code_object_selector, code_object_constructor);
 
-  if(!obj) {
-    return make_error(__hipsycl_here(),
-                      error_info{"cuda_queue: Code object construction failed"});
-  }
+  return make_success();
+#else
+  return make_error(
+      __hipsycl_here(),
+      error_info{
+          "cuda_queue: SSCP kernel launch was requested, but hipSYCL was "
+          "not built with CUDA SSCP support."});
+#endif
+}
 
-  CUmodule cumodule = static_cast<const cuda_executable_object*>(obj)->get_module();
-  assert(cumodule);
+bool cuda_queue::prepare_sscp_kernel(const kernel_operation &op,
+                                     hcf_object_id hcf_object,
+                                     const std::string &kernel_name,
+                                     const glue::kernel_configuration &config) {
+  kernel_cache::code_object_future pending_object;
+  const hcf_kernel_info *kernel_info = nullptr;
+  // Errors are reported when the kernel is submitted
+  if (!request_sscp_code_object(op, hcf_object, kernel_name, config,
+                                pending_object, kernel_info)
+           .is_success())
+    return true;
+
+  return pending_object.wait_for(std::chrono::seconds{0}) ==
+         std::future_status::ready;
+}
+
+result cuda_queue::submit_sscp_kernel_from_code_object(
+    const kernel_operation &op, hcf_object_id hcf_object,
+    const std::string &kernel_name, const rt::range<3> &num_groups,
+    const rt::range<3> &group_size, unsigned local_mem_size, void **args,
+    std::size_t *arg_sizes, std::size_t num_args,
+    const glue::kernel_configuration &config) {
+#ifdef HIPSYCL_WITH_SSCP_COMPILER
+
+  kernel_cache::code_object_future pending_object;
+  const hcf_kernel_info *kernel_info = nullptr;
+  result res = request_sscp_code_object(op, hcf_object, kernel_name, config,
+                                        pending_object, kernel_info);
+  if(!res.is_success())
+    return res;
 
   glue::jit::cxx_argument_mapper arg_mapper{*kernel_info, args, arg_sizes,
                                             num_args};
@@ -722,6 +790,40 @@ result cuda_queue::submit_sscp_kernel_from_code_object(
         error_info{
             "cuda_queue: Could not map C++ arguments to kernel arguments"});
   }
+
+  // If some scalar arguments have had the same values for a while, use the
+  // variant of the kernel specialized for them once it has been compiled.
+  // Since the variant is looked up by the argument values of this launch,
+  // it is only used if they match the values that it was compiled for.
+  const code_object *obj = nullptr;
+  glue::kernel_configuration specialized_config;
+  if (kernel_argument_tracker::get().record_launch(
+          *kernel_info, kernel_name, arg_mapper.get_mapped_args(),
+          arg_mapper.get_mapped_arg_sizes(), config, specialized_config)) {
+    kernel_cache::code_object_future specialized_object;
+    const hcf_kernel_info *specialized_kernel_info = nullptr;
+    if (request_sscp_code_object(op, hcf_object, kernel_name, specialized_config,
+                                 specialized_object, specialized_kernel_info)
+            .is_success() &&
+        specialized_object.wait_for(std::chrono::seconds{0}) ==
+            std::future_status::ready)
+      obj = specialized_object.get();
+  }
+
+  // Only blocks if the code object is still being compiled
+  if(!obj)
+    obj = pending_object.get();
+
+  if(!obj) {
+    return make_error(__hipsycl_here(),
+                      error_info{"cuda_queue: Code object construction failed"});
+  }
+
+  this->activate_device();
+
+  CUmodule cumodule = static_cast<const cuda_executable_object*>(obj)->get_module();
+  assert(cumodule);
+
   return launch_kernel_from_module(cumodule, kernel_name, num_groups,
                                    group_size, local_mem_size, _stream,
                                    arg_mapper.get_mapped_args());
@@ -795,6 +897,14 @@ result cuda_sscp_code_object_invoker::submit_kernel(
       arg_sizes, num_args, config);
 }
 
+bool cuda_sscp_code_object_invoker::prepare_kernel(
+    const kernel_operation &op, hcf_object_id hcf_object,
+    const std::string &kernel_name, unsigned local_mem_size,
+    const glue::kernel_configuration &config) {
+
+  return _queue->prepare_sscp_kernel(op, hcf_object, kernel_name, config);
+}
+
 }
 }
 
@@ -30,7 +30,9 @@
 #include "hipSYCL/runtime/util.hpp"
 #include "hipSYCL/runtime/operations.hpp"
 #include "hipSYCL/runtime/dag_builder.hpp"
+#include "hipSYCL/runtime/dag_direct_scheduler.hpp"
 #include "hipSYCL/runtime/serialization/serialization.hpp"
+#include "hipSYCL/runtime/tracing.hpp"
 #include "hipSYCL/sycl/access.hpp"
 
 #include <mutex>
@@ -135,6 +137,9 @@ dag_node_ptr dag_builder::build_node(std::unique_ptr<operation> op,
 {
   assert(op);
 
+  const bool is_traced = tracing::is_enabled();
+  const std::uint64_t trace_begin = is_traced ? tracing::now() : 0;
+
   // Calculate additional requirements:
   // Iterate over all requirements and look for conflicting accesses
 
@@ -197,6 +202,9 @@ dag_node_ptr dag_builder::build_node(std::unique_ptr<operation> op,
   }
   add_to_data_users(operation_node, requirements);
 
+  if(is_traced)
+    tracing::record_build(operation_node.get(), trace_begin);
+
   return operation_node;
 }
 
@@ -210,6 +218,10 @@ dag_builder::add_command_group(std::unique_ptr<operation> op,
   std::lock_guard<std::mutex> lock{_mutex};
 
   auto node = this->build_node(std::move(op), requirements, hints);
+  // Start e.g. JIT compilation of kernels now, so that it can overlap
+  // with the construction of the remaining DAG. This must happen while
+  // the node cannot yet be flushed to the scheduler.
+  prepare_for_submission(_rt, node);
   _current_dag.add_command_group(node);
 
   return node;
@@ -40,6 +40,8 @@
 #include "hipSYCL/runtime/generic/multi_event.hpp"
 #include "hipSYCL/runtime/serialization/serialization.hpp"
 #include "hipSYCL/runtime/allocator.hpp"
+#include "hipSYCL/runtime/hw_model/hw_model.hpp"
+#include "hipSYCL/runtime/tracing.hpp"
 
 namespace hipsycl {
 namespace rt {
@@ -123,7 +125,8 @@ result ensure_allocation_exists(runtime *rt,
 }
 
 void for_each_explicit_operation(
-    dag_node_ptr node, std::function<void(operation *)> explicit_op_handler) {
+    runtime *rt, dag_node_ptr node,
+    std::function<void(operation *)> explicit_op_handler) {
   if (node->is_submitted())
     return;
   
@@ -157,14 +160,24 @@ void for_each_explicit_operation(
               return;
             }
 
-            // Just use first source for now:
-            memory_location src{update_sources[0].first,
-                                update_sources[0].second.first,
-                                bmem_req->get_data_region()};
             memory_location dest{target_device, region.first,
                                  bmem_req->get_data_region()};
+
+            std::vector<memory_location> candidate_sources;
+            candidate_sources.reserve(update_sources.size());
+            for(const auto& source : update_sources)
+              candidate_sources.push_back(memory_location{
+                  source.first, source.second.first,
+                  bmem_req->get_data_region()});
+
+            memory_location src =
+                rt->backends().hardware_model().get_memcpy_model()->choose_source(
+                    candidate_sources, dest, region.second);
             std::unique_ptr<operation> op =
                 std::make_unique<memcpy_operation>(src, dest, region.second);
+            if(tracing::is_enabled())
+              tracing::record_migration(node.get(),
+                                        *cast<memcpy_operation>(op.get()));
 
             explicit_op_handler(op.get());
             /// TODO This has to be changed once we support multi-operation nodes
@@ -269,7 +282,7 @@ result submit_requirement(runtime* rt, dag_node_ptr req) {
                   bmem_req->get_access_range3d());
         });
     if(has_initialized_content){
-      for_each_explicit_operation(req, [&](operation *op) {
+      for_each_explicit_operation(rt, req, [&](operation *op) {
         if (!op->is_data_transfer()) {
           res = make_error(
               __hipsycl_here(),
@@ -352,6 +365,34 @@ result submit_requirement(runtime* rt, dag_node_ptr req) {
 dag_direct_scheduler::dag_direct_scheduler(runtime* rt)
 : _rt{rt} {}
 
+bool prepare_for_submission(runtime* rt, const dag_node_ptr& node) {
+  operation* op = node->get_operation();
+  if (op->is_requirement() || node->is_submitted() ||
+      !node->get_execution_hints().has_hint<hints::bind_to_device>())
+    return true;
+
+  device_id dev = node->get_execution_hints()
+                      .get_hint<hints::bind_to_device>()
+                      ->get_device_id();
+
+  // Needs to agree with select_executor() for the operations
+  // that can require preparation, i.e. kernels.
+  backend_executor* executor = nullptr;
+  if(node->get_execution_hints().has_hint<hints::prefer_executor>()) {
+    executor = node->get_execution_hints()
+                   .get_hint<hints::prefer_executor>()
+                   ->get_executor();
+    if(!executor->can_execute_on_device(dev))
+      executor = nullptr;
+  }
+  if(!executor)
+    executor = rt->backends().get(dev.get_backend())->get_executor(dev);
+
+  if(!executor)
+    return true;
+  return executor->prepare_operation(dev, op, node);
+}
+
 void dag_direct_scheduler::submit(dag_node_ptr node) {
   if (!node->get_execution_hints().has_hint<hints::bind_to_device>()) {
     register_error(__hipsycl_here(),
@@ -372,6 +413,9 @@ void dag_direct_scheduler::submit(dag_node_ptr node) {
       assign_devices_or_default(req, target_device);
   }
 
+  const bool is_traced = tracing::is_enabled();
+  const std::uint64_t trace_begin = is_traced ? tracing::now() : 0;
+
   for (auto weak_req : node->get_requirements()) {
     if(auto req = weak_req.lock()) {
       if (!req->get_operation()->is_requirement()) {
@@ -395,6 +439,9 @@ void dag_direct_scheduler::submit(dag_node_ptr node) {
     }
   }
 
+  if(is_traced)
+    tracing::record_requirement_resolution(node.get(), trace_begin);
+
   if (node->get_operation()->is_requirement()) {
     result res = submit_requirement(_rt, node);
     
@@ -27,6 +27,9 @@
 
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <unordered_set>
+#include <vector>
 
 #include "hipSYCL/common/debug.hpp"
 #include "hipSYCL/runtime/application.hpp"
@@ -36,12 +39,45 @@
 #include "hipSYCL/runtime/dag_unbound_scheduler.hpp"
 #include "hipSYCL/runtime/operations.hpp"
 #include "hipSYCL/runtime/settings.hpp"
+#include "hipSYCL/runtime/submission_batch.hpp"
 #include "hipSYCL/runtime/util.hpp"
 #include "hipSYCL/runtime/runtime.hpp"
 
 namespace hipsycl {
 namespace rt {
 
+namespace {
+
+// Whether node depends on any of the given nodes, either directly or
+// through requirements that have not yet been submitted.
+bool depends_on_any(const dag_node_ptr &node,
+                    const std::unordered_set<dag_node *> &nodes) {
+  for(auto weak_req : node->get_requirements()) {
+    if(auto req = weak_req.lock()) {
+      if(nodes.count(req.get()))
+        return true;
+      if(!req->is_submitted() && depends_on_any(req, nodes))
+        return true;
+    }
+  }
+  return false;
+}
+
+// Adds node and the unsubmitted requirements that will be submitted
+// together with it
+void add_with_unsubmitted_requirements(const dag_node_ptr &node,
+                                       std::unordered_set<dag_node *> &nodes) {
+  if(!nodes.insert(node.get()).second)
+    return;
+  for(auto weak_req : node->get_requirements()) {
+    if(auto req = weak_req.lock()) {
+      if(!req->is_submitted())
+        add_with_unsubmitted_requirements(req, nodes);
+    }
+  }
+}
+
+}
 
 dag_build_guard::~dag_build_guard()
 {
@@ -117,18 +153,50 @@ void dag_manager::flush_async()
         scheduler_type stype =
             application::get_settings().get<setting::scheduler_type>();
         
-        // This is okay because get_command_groups() returns
-        // the nodes in the order they were submitted. This
-        // makes it safe to submit them in this order to the direct scheduler.
-        for(auto node : new_dag.get_command_groups()){
-          HIPSYCL_DEBUG_INFO
-                << "dag_manager [async]: Submitting node to scheduler!"
-                << std::endl;
-          if(stype == scheduler_type::direct) {
-            _direct_scheduler.submit(node);
-          } else if(stype == scheduler_type::unbound) {
-            _unbound_scheduler.submit(node);
+        {
+          // Within the batch, nodes that end up on the same inorder queue
+          // share a single completion event which is inserted
+          // once all nodes have been submitted.
+          std::optional<submission_batch> batch;
+          if (application::get_settings().get<setting::batch_submission>())
+            batch.emplace();
+
+          auto submit = [&](const dag_node_ptr& node) {
+            HIPSYCL_DEBUG_INFO
+                  << "dag_manager [async]: Submitting node to scheduler!"
+                  << std::endl;
+            if(stype == scheduler_type::direct) {
+              _direct_scheduler.submit(node);
+            } else if(stype == scheduler_type::unbound) {
+              _unbound_scheduler.submit(node);
+            }
+          };
+
+          // Nodes that cannot be submitted without waiting, e.g. because
+          // their kernels are still being JIT-compiled, are postponed
+          // together with all nodes that depend on them. This way,
+          // independent work reaches the devices first.
+          std::vector<dag_node_ptr> postponed_nodes;
+          std::unordered_set<dag_node*> postponed_node_set;
+
+          // This is okay because get_command_groups() returns
+          // the nodes in the order they were submitted. This
+          // makes it safe to submit them in this order to the direct
+          // scheduler, and postponed nodes retain this order.
+          for(auto node : new_dag.get_command_groups()){
+            if((!postponed_node_set.empty() &&
+                depends_on_any(node, postponed_node_set)) ||
+               !prepare_for_submission(_rt, node)) {
+              HIPSYCL_DEBUG_INFO << "dag_manager [async]: Postponing node "
+                                 << node.get() << std::endl;
+              postponed_nodes.push_back(node);
+              add_with_unsubmitted_requirements(node, postponed_node_set);
+            } else {
+              submit(node);
+            }
           }
+          for(auto node : postponed_nodes)
+            submit(node);
         }
         HIPSYCL_DEBUG_INFO << "dag_manager [async]: DAG flush complete."
                           << std::endl;
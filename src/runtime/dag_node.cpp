@@ -33,6 +33,7 @@
 #include "hipSYCL/runtime/dag_node.hpp"
 #include "hipSYCL/runtime/hints.hpp"
 #include "hipSYCL/runtime/operations.hpp"
+#include "hipSYCL/runtime/tracing.hpp"
 #include "hipSYCL/runtime/generic/multi_event.hpp"
 
 namespace hipsycl {
@@ -45,13 +46,23 @@ dag_node::dag_node(const execution_hints &hints,
     : _hints{hints},
       _assigned_executor{nullptr}, _event{nullptr}, _operation{std::move(op)},
       _is_submitted{false}, _is_complete{false}, _is_virtual{false},
-      _is_cancelled{false}, _rt{rt} {
+      _is_cancelled{false}, _rt{rt}, _node_id{0} {
   
   for(const auto& req : requirements)
     _requirements.push_back(req);
+
+  if(tracing::is_enabled()) {
+    _node_id = tracing::make_node_id();
+    // Needed to record the execution on the device
+    _hints.set_hint(hints::request_instrumentation_start_timestamp{});
+    _hints.set_hint(hints::request_instrumentation_finish_timestamp{});
+  }
 }
 
-dag_node::~dag_node() {}
+dag_node::~dag_node() {
+  if(_node_id != 0 && tracing::is_enabled())
+    tracing::record_execution(this);
+}
 
 bool dag_node::is_submitted() const { return _is_submitted; }
 
@@ -289,5 +300,9 @@ runtime* dag_node::get_runtime() const {
   return _rt;
 }
 
+std::uint64_t dag_node::get_node_id() const {
+  return _node_id;
+}
+
 }
 }
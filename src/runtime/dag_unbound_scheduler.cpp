@@ -31,14 +31,50 @@
 #include "hipSYCL/runtime/runtime.hpp"
 #include "hipSYCL/runtime/device_id.hpp"
 #include "hipSYCL/runtime/error.hpp"
+#include "hipSYCL/runtime/executor.hpp"
 #include "hipSYCL/runtime/hints.hpp"
 #include "hipSYCL/runtime/hardware.hpp"
+#include "hipSYCL/runtime/operations.hpp"
+#include "hipSYCL/runtime/settings.hpp"
+#include "hipSYCL/runtime/hw_model/hw_model.hpp"
+
+#include <algorithm>
+#include <limits>
 
 namespace hipsycl {
 namespace rt {
 
+namespace {
+
+template <class Handler>
+void for_each_buffer_requirement(dag_node_ptr node, Handler h) {
+  auto handle = [&](dag_node_ptr n) {
+    if (n->get_operation()->is_requirement()) {
+      requirement *req = cast<requirement>(n->get_operation());
+      if (req->is_memory_requirement()) {
+        memory_requirement *mreq = cast<memory_requirement>(req);
+        if (mreq->is_buffer_requirement())
+          h(cast<buffer_memory_requirement>(mreq));
+      }
+    }
+  };
+
+  handle(node);
+  for (auto weak_req : node->get_requirements()) {
+    if (auto req = weak_req.lock())
+      handle(req);
+  }
+}
+
+bool is_discard_access(sycl::access::mode m) {
+  return m == sycl::access::mode::discard_write ||
+         m == sycl::access::mode::discard_read_write;
+}
+
+}
+
 dag_unbound_scheduler::dag_unbound_scheduler(runtime* rt)
-: _direct_scheduler{rt}, _rt{rt} {}
+: _round_robin_counter{0}, _direct_scheduler{rt}, _rt{rt} {}
 
 void dag_unbound_scheduler::submit(dag_node_ptr node) {
   if(_devices.empty()) {
@@ -73,18 +109,134 @@ void dag_unbound_scheduler::submit(dag_node_ptr node) {
       node->cancel();
       return;
     }
-    // Round-robin as placeholder. This is not intended
-    // for anything practical, it's a _placeholder_
-    static std::size_t dev = 0;
-    ++dev;
 
-    rt::device_id target_dev = eligible_devices[dev % eligible_devices.size()];
+    rt::device_id target_dev = select_device(node, eligible_devices);
     node->get_execution_hints().set_hint(rt::hints::bind_to_device{target_dev});
   }
 
   _direct_scheduler.submit(node);
 }
 
+device_id dag_unbound_scheduler::select_device(
+    dag_node_ptr node, const std::vector<device_id> &eligible_devices) {
+
+  // Rotate the starting point of the search so that ties
+  // (e.g. nodes without data dependencies on idle devices)
+  // are still distributed across devices.
+  std::size_t offset = _round_robin_counter++;
+
+  if (eligible_devices.size() == 1)
+    return eligible_devices[0];
+
+  if (application::get_settings().get<setting::placement_strategy>() ==
+      placement_strategy::round_robin)
+    return eligible_devices[offset % eligible_devices.size()];
+
+  const cost_type queue_depth_cost =
+      application::get_settings().get<setting::placement_queue_depth_cost>();
+
+  std::size_t best_index = 0;
+  cost_type best_cost = std::numeric_limits<cost_type>::max();
+
+  for (std::size_t i = 0; i < eligible_devices.size(); ++i) {
+    const device_id &dev =
+        eligible_devices[(offset + i) % eligible_devices.size()];
+
+    cost_type cost = estimate_migration_cost(node, dev) +
+                     queue_depth_cost * get_queue_depth(dev);
+
+    HIPSYCL_DEBUG_INFO << "dag_unbound_scheduler: Estimated cost of placing "
+                       << node.get() << " on device "
+                       << dev.get_id() << " of backend "
+                       << static_cast<int>(dev.get_backend()) << ": " << cost
+                       << std::endl;
+
+    if (cost < best_cost) {
+      best_cost = cost;
+      best_index = (offset + i) % eligible_devices.size();
+    }
+  }
+
+  return eligible_devices[best_index];
+}
+
+cost_type dag_unbound_scheduler::estimate_migration_cost(
+    dag_node_ptr node, const device_id &dev) const {
+
+  const memcpy_model *model =
+      _rt->backends().hardware_model().get_memcpy_model();
+
+  cost_type total_cost = 0;
+  for_each_buffer_requirement(node, [&](buffer_memory_requirement *bmem_req) {
+    if (is_discard_access(bmem_req->get_access_mode()))
+      return;
+
+    auto data = bmem_req->get_data_region();
+    id<3> offset = bmem_req->get_access_offset3d();
+    range<3> access_range = bmem_req->get_access_range3d();
+
+    if (!data->has_initialized_content(offset, access_range))
+      return;
+
+    std::vector<range_store::rect> outdated_regions;
+    if (data->has_allocation(dev)) {
+      data->get_outdated_regions(dev, offset, access_range, outdated_regions);
+    } else {
+      outdated_regions.push_back(std::make_pair(offset, access_range));
+    }
+
+    memory_location target{dev, offset, data};
+    for (const range_store::rect &region : outdated_regions) {
+      // Don't use data_region::get_update_source_candidates() here - it
+      // assumes that a single source can provide the update, which
+      // might not hold for speculative placements on devices that
+      // have never seen the data.
+      auto pr = data->get_page_range(region.first, region.second);
+      std::vector<memory_location> candidates;
+      std::vector<memory_location> partial_sources;
+      data->for_each_allocation_while([&](const auto &alloc) {
+        if (!(alloc.dev == dev)) {
+          if (alloc.invalid_pages.entire_range_empty(pr))
+            candidates.push_back(memory_location{alloc.dev, region.first, data});
+          else if (!alloc.invalid_pages.entire_range_filled(pr))
+            partial_sources.push_back(
+                memory_location{alloc.dev, region.first, data});
+        }
+        return true;
+      });
+
+      if (candidates.empty()) {
+        // The region is scattered across multiple devices, so we will
+        // have to pull from several of them; assume the worst source.
+        cost_type worst_cost = 0;
+        for (const auto &src : partial_sources)
+          worst_cost = std::max(
+              worst_cost,
+              model->estimate_runtime_cost(src, target, region.second));
+        total_cost += worst_cost;
+        continue;
+      }
+
+      memory_location src =
+          model->choose_source(candidates, target, region.second);
+      total_cost += model->estimate_runtime_cost(src, target, region.second);
+    }
+  });
+
+  return total_cost;
 }
+
+std::size_t dag_unbound_scheduler::get_queue_depth(const device_id &dev) const {
+  // Ask the executor, so that operations that were not placed by us
+  // (e.g. bound to the device by the user) are accounted for as well.
+  // Executors track a bounded number of operations per queue, so very
+  // deep queues are underestimated.
+  backend_executor *executor =
+      _rt->backends().get(dev.get_backend())->get_executor(dev);
+  if (!executor)
+    return 0;
+  return executor->get_num_pending_operations(dev);
 }
 
+}
+}
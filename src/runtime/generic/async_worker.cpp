@@ -34,9 +34,33 @@
 namespace hipsycl {
 namespace rt {
 
+namespace {
+
+// Number of iterations to poll for new work before going to sleep.
+// Spinning only makes sense if the thread we are waiting for can make
+// progress at the same time.
+std::size_t get_max_spin_iterations() {
+  static const std::size_t max_spin_iterations =
+      std::thread::hardware_concurrency() > 1 ? 4096 : 0;
+  return max_spin_iterations;
+}
+
+inline void spin_pause() {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#endif
+}
+
+}
+
 worker_thread::worker_thread()
-    : _continue{true}
-{
+    : _slots{new slot[num_slots]}, _enqueue_pos{0}, _num_completed{0},
+      _continue{true}, _is_worker_sleeping{false}, _num_waiters{0},
+      _is_overflow_active{false}, _num_overflow_enqueued{0},
+      _num_overflow_completed{0} {
+  for(std::size_t i = 0; i < num_slots; ++i)
+    _slots[i].sequence.store(i, std::memory_order_relaxed);
+
   _worker_thread = std::thread{[this](){ work(); } };
 }
 
@@ -45,20 +69,29 @@ worker_thread::~worker_thread()
 {
   halt();
 
-  assert(_enqueued_operations.empty());
+  assert(queue_size() == 0);
 }
 
 void worker_thread::wait()
 {
-  std::unique_lock<std::mutex> lock(_mutex);
-  if(!_enqueued_operations.empty())
-  {
-    // Before going to sleep, wake up the other thread to avoid deadlocks
-    _condition_wait.notify_all();
-    // Wait until no operation is pending
-    _condition_wait.wait(lock, [this]{return _enqueued_operations.empty();});
+  // Tasks may enqueue further tasks, so we need to wait until
+  // the queue is actually empty.
+  auto is_done = [&]() {
+    return queue_size() == 0;
+  };
+
+  const std::size_t max_spin_iterations = get_max_spin_iterations();
+  for(std::size_t i = 0; i < max_spin_iterations; ++i) {
+    if(is_done())
+      return;
+    spin_pause();
   }
-  assert(_enqueued_operations.empty());
+
+  std::unique_lock<std::mutex> lock{_wait_mutex};
+  _num_waiters.fetch_add(1, std::memory_order_seq_cst);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  _wait_condition.wait(lock, is_done);
+  _num_waiters.fetch_sub(1, std::memory_order_relaxed);
 }
 
 
@@ -67,77 +100,141 @@ void worker_thread::halt()
   wait();
 
   {
-    std::unique_lock<std::mutex> lock(_mutex);
+    std::lock_guard<std::mutex> lock(_worker_mutex);
     _continue = false;
-    _condition_wait.notify_all();
   }
+  _worker_condition.notify_all();
+
   if(_worker_thread.joinable())
     _worker_thread.join();
 }
 
-void worker_thread::work()
-{
-  // This is the main function executed by the worker thread.
-  // The loop is executed as long as there are enqueued operations,
-  // (_is_operation_pending) or we should wait for new operations
-  // (_continue).
-  while(_continue || queue_size() > 0)
-  {
-    {
-      std::unique_lock<std::mutex> lock(_mutex);
-
-      // Before going to sleep, wake up the other thread in case it is is waiting
-      // for the queue to get empty
-      _condition_wait.notify_all();
-      // Wait until we have work, or until _continue becomes false
-      _condition_wait.wait(lock,
-                           [this](){
-        return _enqueued_operations.size()>0 || !_continue;
-      });
-    }
+bool worker_thread::wait_for_work(std::size_t pos) {
+  slot& s = _slots[pos & slot_mask];
+  auto has_work = [&]() {
+    return s.sequence.load(std::memory_order_acquire) == pos + 1 ||
+           _is_overflow_active.load(std::memory_order_acquire);
+  };
+
+  const std::size_t max_spin_iterations = get_max_spin_iterations();
+  for(std::size_t i = 0; i < max_spin_iterations; ++i) {
+    if(has_work())
+      return true;
+    spin_pause();
+  }
 
-    // In any way, process the pending operations
+  std::unique_lock<std::mutex> lock{_worker_mutex};
+  for(;;) {
+    // Producers reset the flag when waking us up, so it needs to be
+    // set again each time before evaluating whether there is work.
+    _is_worker_sleeping.store(true, std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if(has_work() || !_continue.load(std::memory_order_acquire))
+      break;
+    _worker_condition.wait(lock);
+  }
+  _is_worker_sleeping.store(false, std::memory_order_relaxed);
 
-    async_function operation = [](){};
-    bool has_operation = false;
+  return has_work();
+}
 
-    {
-      std::lock_guard<std::mutex> lock(_mutex);
+void worker_thread::spin_until_slot_is_free(std::size_t pos) const {
+  const slot& s = _slots[pos & slot_mask];
 
-      if(!_enqueued_operations.empty())
-      {
-        operation = _enqueued_operations.front();
-        has_operation = true;
-      }
-    }
+  const std::size_t max_spin_iterations = get_max_spin_iterations();
+  for(std::size_t i = 0; i < max_spin_iterations; ++i) {
+    std::size_t seq = s.sequence.load(std::memory_order_acquire);
+    if(static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos) >= 0)
+      return;
+    spin_pause();
+  }
+}
 
-    operation();
+void worker_thread::drain_overflow() {
+  std::deque<worker_task> tasks;
+  {
+    std::lock_guard<std::mutex> lock{_overflow_mutex};
+    tasks.swap(_overflow);
+    // New tasks can go into the ring again. They are only processed
+    // after the tasks that we have just taken out of the overflow list.
+    _is_overflow_active.store(false, std::memory_order_release);
+  }
 
-    {
-      std::lock_guard<std::mutex> lock{_mutex};
-      if(has_operation)
-        _enqueued_operations.pop();
-    }
+  for(auto& t : tasks) {
+    t();
+    t.reset();
+    _num_overflow_completed.fetch_add(1, std::memory_order_release);
+    notify_waiters();
+  }
+}
 
-    _condition_wait.notify_all();
+void worker_thread::notify_worker() {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  // Only one producer needs to wake up the worker
+  if(_is_worker_sleeping.load(std::memory_order_relaxed) &&
+     _is_worker_sleeping.exchange(false, std::memory_order_acq_rel)) {
+    // Taking the lock guarantees that the worker is either
+    // already waiting or has not yet evaluated its wait predicate.
+    { std::lock_guard<std::mutex> lock{_worker_mutex}; }
+    _worker_condition.notify_one();
+  }
+}
 
+void worker_thread::notify_waiters() {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if(_num_waiters.load(std::memory_order_relaxed) > 0) {
+    { std::lock_guard<std::mutex> lock{_wait_mutex}; }
+    _wait_condition.notify_all();
   }
 }
 
-void worker_thread::operator()(worker_thread::async_function f)
+void worker_thread::work()
 {
-  std::unique_lock<std::mutex> lock(_mutex);
-
-  _enqueued_operations.push(f);
-
-  lock.unlock();
-  _condition_wait.notify_all();
+  // This is the main function executed by the worker thread.
+  // Since we are the only consumer, the dequeue position
+  // does not need to be shared.
+  std::size_t pos = 0;
+
+  for(;;) {
+    slot& s = _slots[pos & slot_mask];
+
+    if(s.sequence.load(std::memory_order_acquire) == pos + 1) {
+      // Execute the task in place. The slot is only released afterwards,
+      // so that queue_size() includes the task currently being processed.
+      s.task();
+      s.task.reset();
+
+      s.sequence.store(pos + num_slots, std::memory_order_release);
+      ++pos;
+      _num_completed.store(pos, std::memory_order_release);
+
+      notify_waiters();
+    } else if (_is_overflow_active.load(std::memory_order_acquire)) {
+      // Tasks in the overflow list are newer than all tasks that
+      // have already claimed a position in the ring, so we can only
+      // process them once the ring has been fully drained.
+      if(_enqueue_pos.load(std::memory_order_acquire) == pos)
+        drain_overflow();
+      else
+        spin_pause();
+    } else if(!wait_for_work(pos)) {
+      return;
+    }
+  }
 }
 
 std::size_t worker_thread::queue_size() const
 {
-  std::lock_guard<std::mutex> lock(_mutex);
-  return _enqueued_operations.size();
+  // Read all completion counters before the enqueue counters. Since
+  // tasks are always enqueued before they complete, this guarantees that
+  // we never report an empty queue while work is pending.
+  std::size_t completed = _num_completed.load(std::memory_order_acquire);
+  std::size_t overflow_completed =
+      _num_overflow_completed.load(std::memory_order_acquire);
+  std::size_t overflow_enqueued =
+      _num_overflow_enqueued.load(std::memory_order_acquire);
+  std::size_t enqueued = _enqueue_pos.load(std::memory_order_acquire);
+  return (enqueued + overflow_enqueued) - (completed + overflow_completed);
 }
 
 
@@ -0,0 +1,181 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "hipSYCL/runtime/generic/host_thread_pool.hpp"
+#include "hipSYCL/common/debug.hpp"
+
+#include <algorithm>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace hipsycl {
+namespace rt {
+
+namespace {
+
+// Number of polling iterations before an idle worker goes to sleep
+constexpr int max_spin_iterations = 1 << 14;
+
+inline void spin_pause(int iteration) {
+  if(iteration % 64 == 63)
+    std::this_thread::yield();
+#if defined(__x86_64__) || defined(__i386__)
+  else
+    __builtin_ia32_pause();
+#endif
+}
+
+void pin_thread(std::thread& t, int cpu) {
+#ifdef __linux__
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  CPU_SET(cpu, &mask);
+  if(pthread_setaffinity_np(t.native_handle(), sizeof(mask), &mask) != 0) {
+    HIPSYCL_DEBUG_WARNING << "host_thread_pool: Could not pin worker thread to CPU "
+                          << cpu << std::endl;
+  }
+#endif
+}
+
+}
+
+host_thread_pool::host_thread_pool(int num_threads,
+                                   const std::vector<int> &cpus)
+    : _num_threads{std::max(num_threads, 1)}, _generation{0},
+      _num_pending{0}, _num_sleeping{0}, _is_shutting_down{false} {
+
+  for(int i = 1; i < _num_threads; ++i) {
+    _workers.emplace_back([this, i]() { work(i); });
+    // Leave the first CPU to the thread that calls run().
+    if(!cpus.empty())
+      pin_thread(_workers.back(), cpus[i % cpus.size()]);
+  }
+  HIPSYCL_DEBUG_INFO << "host_thread_pool: Started " << _workers.size()
+                     << " worker threads" << std::endl;
+}
+
+host_thread_pool::~host_thread_pool() {
+  _is_shutting_down.store(true);
+  {
+    std::lock_guard<std::mutex> lock{_sleep_mutex};
+    _generation.fetch_add(1);
+  }
+  _sleep_cv.notify_all();
+
+  for(auto& worker : _workers)
+    if(worker.joinable())
+      worker.join();
+}
+
+int host_thread_pool::get_num_threads() const {
+  return _num_threads;
+}
+
+void host_thread_pool::run(task_function f, void *data) {
+  std::lock_guard<std::mutex> launch_lock{_launch_mutex};
+
+  _task = f;
+  _task_data = data;
+  _num_pending.store(_num_threads - 1, std::memory_order_relaxed);
+  // Publishes task and data to the workers
+  _generation.fetch_add(1);
+
+  // Sleeping workers register themselves before checking the generation,
+  // so either they see the new generation or we see them here.
+  if(_num_sleeping.load() > 0) {
+    { std::lock_guard<std::mutex> lock{_sleep_mutex}; }
+    _sleep_cv.notify_all();
+  }
+
+  f(data, 0, _num_threads);
+
+  for(int i = 0; _num_pending.load(std::memory_order_acquire) > 0; ++i)
+    spin_pause(i);
+}
+
+void host_thread_pool::work(int thread_id) {
+  std::uint64_t last_generation = 0;
+
+  for(;;) {
+    std::uint64_t generation = _generation.load(std::memory_order_acquire);
+    for(int i = 0; generation == last_generation && i < max_spin_iterations;
+        ++i) {
+      spin_pause(i);
+      generation = _generation.load(std::memory_order_acquire);
+    }
+
+    if(generation == last_generation) {
+      std::unique_lock<std::mutex> lock{_sleep_mutex};
+      _num_sleeping.fetch_add(1);
+      _sleep_cv.wait(lock, [&]() {
+        generation = _generation.load();
+        return generation != last_generation;
+      });
+      _num_sleeping.fetch_sub(1);
+    }
+
+    if(_is_shutting_down.load())
+      return;
+
+    last_generation = generation;
+    _task(_task_data, thread_id, _num_threads);
+    _num_pending.fetch_sub(1, std::memory_order_release);
+  }
+}
+
+std::vector<int> get_process_cpus() {
+  std::vector<int> cpus;
+#ifdef __linux__
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  if(sched_getaffinity(0, sizeof(mask), &mask) == 0) {
+    for(int i = 0; i < CPU_SETSIZE; ++i)
+      if(CPU_ISSET(i, &mask))
+        cpus.push_back(i);
+  }
+#endif
+  return cpus;
+}
+
+bool bind_current_thread_to_cpus(const std::vector<int> &cpus) {
+#ifdef __linux__
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  for(int cpu : cpus)
+    if(cpu >= 0 && cpu < CPU_SETSIZE)
+      CPU_SET(cpu, &mask);
+  return pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask) == 0;
+#else
+  return false;
+#endif
+}
+
+}
+}
@@ -113,10 +113,16 @@ hip_hardware_context::hip_hardware_context(int dev) : _dev{dev} {
 
   _allocator = std::make_unique<hip_allocator>(
       backend_descriptor{hardware_platform::rocm, api_platform::hip}, _dev);
+  _caching_allocator = caching_allocator::create_if_enabled(
+      _allocator.get(),
+      device_id{backend_descriptor{hardware_platform::rocm, api_platform::hip},
+                _dev});
   _event_pool = std::make_unique<hip_event_pool>(_dev);
 }
 
-hip_allocator* hip_hardware_context::get_allocator() const {
+backend_allocator* hip_hardware_context::get_allocator() const {
+  if(_caching_allocator)
+    return _caching_allocator.get();
   return _allocator.get();
 }
 
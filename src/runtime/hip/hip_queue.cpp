@@ -37,7 +37,9 @@
 #include "hipSYCL/runtime/hip/hip_code_object.hpp"
 #include "hipSYCL/runtime/util.hpp"
 #include "hipSYCL/runtime/queue_completion_event.hpp"
+#include "hipSYCL/runtime/batch_completion_event.hpp"
 #include "hipSYCL/runtime/kernel_cache.hpp"
+#include "hipSYCL/runtime/kernel_argument_tracker.hpp"
 
 #ifdef HIPSYCL_WITH_SSCP_COMPILER
 
@@ -47,6 +49,7 @@
 #endif
 
 #include <cassert>
+#include <chrono>
 #include <memory>
 
 namespace hipsycl {
@@ -237,6 +240,10 @@ std::shared_ptr<dag_node_event> hip_queue::create_queue_completion_event() {
       this);
 }
 
+std::shared_ptr<dag_node_event> hip_queue::create_batch_completion_event() {
+  return std::make_shared<batch_completion_event<hipEvent_t>>(this);
+}
+
 
 
 result hip_queue::submit_memcpy(memcpy_operation & op, dag_node_ptr node) {
@@ -370,6 +377,21 @@ result hip_queue::submit_kernel(kernel_operation &op, dag_node_ptr node) {
   return make_success();
 }
 
+bool hip_queue::prepare_kernel(kernel_operation &op, dag_node_ptr node) {
+  rt::backend_kernel_launcher *l =
+      op.get_launcher().find_launcher(backend_id::hip);
+  if (!l)
+    // Error is reported by submit_kernel()
+    return true;
+
+  rt::backend_kernel_launch_capabilities cap;
+  cap.provide_multipass_invoker(&_multipass_code_object_invoker);
+  cap.provide_sscp_invoker(&_sscp_code_object_invoker);
+  l->set_backend_capabilities(cap);
+
+  return l->prepare(node.get(), op.get_launcher().get_kernel_configuration());
+}
+
 result hip_queue::submit_prefetch(prefetch_operation& op, dag_node_ptr node) {
   // Need to enable instrumentation even if we cannot enable actual
   // prefetches so that the user will be able to access instrumentation
@@ -590,15 +612,12 @@ result hip_queue::submit_multipass_kernel_from_code_object(
       kernel_args, arg_sizes, num_args);
 }
 
-result hip_queue::submit_sscp_kernel_from_code_object(
-      const kernel_operation &op, hcf_object_id hcf_object,
-      const std::string &kernel_name, const rt::range<3> &num_groups,
-      const rt::range<3> &group_size, unsigned local_mem_size, void **args,
-      std::size_t *arg_sizes, std::size_t num_args,
-      const glue::kernel_configuration &config) {
+result hip_queue::request_sscp_code_object(
+    const kernel_operation &op, hcf_object_id hcf_object,
+    const std::string &kernel_name, const glue::kernel_configuration &config,
+    kernel_cache::code_object_future &code_object_out,
+    const hcf_kernel_info *&kernel_info_out) {
 #ifdef HIPSYCL_WITH_SSCP_COMPILER
-  this->activate_device();
-  
   std::string global_kernel_name = op.get_global_kernel_name();
   const kernel_cache::kernel_name_index_t *kidx =
       _kernel_cache->get_global_kernel_index(global_kernel_name);
@@ -626,6 +645,7 @@ result hip_queue::submit_sscp_kernel_from_code_object(
         error_info{"hip_queue: Could not obtain hcf kernel info for kernel " +
             global_kernel_name});
   }
+  kernel_info_out = kernel_info;
 
   auto code_object_selector = [&](const code_object* candidate) -> bool {
     
@@ -640,16 +660,22 @@ result hip_queue::submit_sscp_kernel_from_code_object(
     if(obj->configuration_id() != configuration_id)
       return false;
 
+    // Objects may only contain some of the kernels of the image
+    if(!obj->contains(kernel_name))
+      return false;
+
     return obj->get_device() == device;
   };
 
-  auto code_object_constructor = [&]() -> code_object * {
+  std::vector<std::string> kernel_names;
+  std::string selected_image_name = glue::jit::select_image_and_kernels(
+      kernel_info, kernel_name, config, kernel_names);
+
+  // Runs on a JIT compilation thread, so everything needs to be
+  // captured by value.
+  auto code_object_constructor = [=]() -> code_object * {
     const common::hcf_container *hcf =
         rt::hcf_cache::get().get_hcf(hcf_object);
-    
-    std::vector<std::string> kernel_names;
-    std::string selected_image_name =
-        glue::jit::select_image(kernel_info, &kernel_names);
 
     // Construct amdgpu translator to compile the specified kernels
     std::unique_ptr<compiler::LLVMToBackendTranslator> translator = 
@@ -663,10 +689,15 @@ result hip_queue::submit_sscp_kernel_from_code_object(
         hcf, selected_image_name, config, amdgpu_image);
     
     if(!err.is_success()) {
-      register_error(err);
+      kernel_argument_tracker::get().report_failed_compilation(
+          hcf_object, kernel_name, config, err);
       return nullptr;
     }
 
+    // Loading the module requires the device to be active
+    // on the compilation thread
+    hip_device_manager::get().activate_device(device);
+
     hip_sscp_executable_object *exec_obj = new hip_sscp_executable_object{
         amdgpu_image, target_arch_name, hcf_object,
         kernel_names, device,           config};
@@ -677,7 +708,8 @@ result hip_queue::submit_sscp_kernel_from_code_object(
         << std::endl;
 
     if(!r.is_success()) {
-      register_error(r);
+      kernel_argument_tracker::get().report_failed_compilation(
+          hcf_object, kernel_name, config, r);
       delete exec_obj;
       return nullptr;
     }
@@ -685,19 +717,52 @@ result hip_queue::submit_sscp_kernel_from_code_object(
     return exec_obj;
   };
 
-  const code_object *obj = _kernel_cache->get_or_construct_code_object(
+  code_object_out = _kernel_cache->get_or_construct_code_object_async(
       *kidx, kernel_name, backend_id::hip, hcf_object,
+      kernel_cache::make_construction_key(backend_id::hip, device, hcf_object,
+                                          selected_image_name,
+                                          kernel_names, configuration_id),
       code_object_selector, code_object_constructor);
 
-  
-  if(!obj) {
-    return make_error(__hipsycl_here(),
-                      error_info{"hip_queue: Code object construction failed"});
-  }
+  return make_success();
+#else
+  return make_error(
+      __hipsycl_here(),
+      error_info{
+          "hip_queue: SSCP kernel launch was requested, but hipSYCL was "
+          "not built with HIP SSCP support."});
+#endif
+}
 
-  ihipModule_t *module =
-      static_cast<const hip_executable_object *>(obj)->get_module();
-  assert(module);
+bool hip_queue::prepare_sscp_kernel(const kernel_operation &op,
+                                    hcf_object_id hcf_object,
+                                    const std::string &kernel_name,
+                                    const glue::kernel_configuration &config) {
+  kernel_cache::code_object_future pending_object;
+  const hcf_kernel_info *kernel_info = nullptr;
+  // Errors are reported when the kernel is submitted
+  if (!request_sscp_code_object(op, hcf_object, kernel_name, config,
+                                pending_object, kernel_info)
+           .is_success())
+    return true;
+
+  return pending_object.wait_for(std::chrono::seconds{0}) ==
+         std::future_status::ready;
+}
+
+result hip_queue::submit_sscp_kernel_from_code_object(
+      const kernel_operation &op, hcf_object_id hcf_object,
+      const std::string &kernel_name, const rt::range<3> &num_groups,
+      const rt::range<3> &group_size, unsigned local_mem_size, void **args,
+      std::size_t *arg_sizes, std::size_t num_args,
+      const glue::kernel_configuration &config) {
+#ifdef HIPSYCL_WITH_SSCP_COMPILER
+  kernel_cache::code_object_future pending_object;
+  const hcf_kernel_info *kernel_info = nullptr;
+  result res = request_sscp_code_object(op, hcf_object, kernel_name, config,
+                                        pending_object, kernel_info);
+  if(!res.is_success())
+    return res;
 
   glue::jit::cxx_argument_mapper arg_mapper{*kernel_info, args, arg_sizes,
                                             num_args};
@@ -708,6 +773,41 @@ result hip_queue::submit_sscp_kernel_from_code_object(
             "hip_queue: Could not map C++ arguments to kernel arguments"});
   }
 
+  // If some scalar arguments have had the same values for a while, use the
+  // variant of the kernel specialized for them once it has been compiled.
+  // Since the variant is looked up by the argument values of this launch,
+  // it is only used if they match the values that it was compiled for.
+  const code_object *obj = nullptr;
+  glue::kernel_configuration specialized_config;
+  if (kernel_argument_tracker::get().record_launch(
+          *kernel_info, kernel_name, arg_mapper.get_mapped_args(),
+          arg_mapper.get_mapped_arg_sizes(), config, specialized_config)) {
+    kernel_cache::code_object_future specialized_object;
+    const hcf_kernel_info *specialized_kernel_info = nullptr;
+    if (request_sscp_code_object(op, hcf_object, kernel_name, specialized_config,
+                                 specialized_object, specialized_kernel_info)
+            .is_success() &&
+        specialized_object.wait_for(std::chrono::seconds{0}) ==
+            std::future_status::ready)
+      obj = specialized_object.get();
+  }
+
+  // Only blocks if the code object is still being compiled
+  if(!obj)
+    obj = pending_object.get();
+
+  if(!obj) {
+    return make_error(__hipsycl_here(),
+                      error_info{"hip_queue: Code object construction failed"});
+  }
+
+  this->activate_device();
+
+  ihipModule_t *module =
+      static_cast<const hip_executable_object *>(obj)->get_module();
+  assert(module);
+
+
   return launch_kernel_from_module(
       module, kernel_name, num_groups, group_size, local_mem_size, _stream,
       arg_mapper.get_mapped_args(),
@@ -759,6 +859,14 @@ result hip_sscp_code_object_invoker::submit_kernel(
       arg_sizes, num_args, config);
 }
 
+bool hip_sscp_code_object_invoker::prepare_kernel(
+    const kernel_operation &op, hcf_object_id hcf_object,
+    const std::string &kernel_name, unsigned local_mem_size,
+    const glue::kernel_configuration &config) {
+
+  return _queue->prepare_sscp_kernel(op, hcf_object, kernel_name, config);
+}
+
 }
 }
 
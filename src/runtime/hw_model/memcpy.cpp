@@ -26,27 +26,171 @@
  */
 
 #include "hipSYCL/runtime/hw_model/memcpy.hpp"
+#include "hipSYCL/runtime/application.hpp"
+#include "hipSYCL/runtime/allocator.hpp"
+#include "hipSYCL/runtime/backend.hpp"
+#include "hipSYCL/runtime/dag_node.hpp"
+#include "hipSYCL/runtime/executor.hpp"
+#include "hipSYCL/runtime/hardware.hpp"
+#include "hipSYCL/runtime/runtime.hpp"
+#include "hipSYCL/runtime/settings.hpp"
+#include "hipSYCL/common/debug.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
 #include <limits>
+#include <sstream>
 
 
 namespace hipsycl {
 namespace rt {
 
+namespace {
+
+memcpy_link_parameters get_default_parameters(const device_id &source,
+                                              const device_id &dest) {
+  // Strongly prefer transfers from the same device to the same device
+  if(source == dest)
+    return memcpy_link_parameters{2.e-6, 100.e9, 1.e-8};
+
+  if (source.get_full_backend_descriptor().hw_platform ==
+      dest.get_full_backend_descriptor().hw_platform)
+    return memcpy_link_parameters{5.e-6, 25.e9, 1.e-8};
+
+  return memcpy_link_parameters{1.e-5, 12.e9, 1.e-8};
+}
+
+// Number of contiguous memory chunks that a transfer of num_elements
+// from/to an allocation of the given shape consists of
+std::size_t get_num_contiguous_chunks(range<3> allocation_shape,
+                                      range<3> num_elements) {
+  if(num_elements[2] != allocation_shape[2])
+    return num_elements[0] * num_elements[1];
+  if(num_elements[1] != allocation_shape[1])
+    return num_elements[0];
+  return 1;
+}
+
+const char* get_backend_name(backend_id b) {
+  switch(b) {
+  case backend_id::cuda:
+    return "cuda";
+  case backend_id::hip:
+    return "hip";
+  case backend_id::level_zero:
+    return "ze";
+  case backend_id::ocl:
+    return "ocl";
+  case backend_id::omp:
+    return "omp";
+  }
+  return "unknown";
+}
+
+bool get_backend_from_name(const std::string& name, backend_id& out) {
+  for(backend_id b : {backend_id::cuda, backend_id::hip, backend_id::level_zero,
+                      backend_id::ocl, backend_id::omp}) {
+    if(name == get_backend_name(b)) {
+      out = b;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool is_host_device(const device_id& dev) {
+  return dev.get_full_backend_descriptor().hw_platform == hardware_platform::cpu;
+}
+
+class calibration_transfer {
+public:
+  calibration_transfer(runtime *rt, const device_id &source,
+                       const device_id &dest)
+      : _rt{rt}, _source{source}, _dest{dest} {}
+
+  // Returns the minimum runtime in seconds of a transfer of num_elements
+  // bytes between allocations of the given shape.
+  double measure(void *source_ptr, void *dest_ptr, range<3> allocation_shape,
+                 range<3> num_elements, int repetitions) const {
+    double best_time = std::numeric_limits<double>::max();
+    for(int i = 0; i < repetitions; ++i) {
+      memory_location src{_source, source_ptr, id<3>{}, allocation_shape, 1};
+      memory_location dest{_dest, dest_ptr, id<3>{}, allocation_shape, 1};
+
+      auto start = std::chrono::high_resolution_clock::now();
+      if(!run(std::make_unique<memcpy_operation>(src, dest, num_elements)))
+        return -1.0;
+      auto stop = std::chrono::high_resolution_clock::now();
+
+      best_time = std::min(
+          best_time, std::chrono::duration<double>(stop - start).count());
+    }
+    return best_time;
+  }
+
+private:
+  bool run(std::unique_ptr<memcpy_operation> op) const {
+    operation* op_ptr = op.get();
+    auto node = std::make_shared<dag_node>(execution_hints{}, node_list_t{},
+                                           std::move(op), _rt);
+    // Select the executor in the same way as the scheduler would
+    backend_id executor_backend;
+    device_id executor_device = _dest;
+    if(!op_ptr->has_preferred_backend(executor_backend, executor_device))
+      executor_backend = _dest.get_backend();
+
+    backend_executor *executor =
+        _rt->backends().get(executor_backend)->get_executor(executor_device);
+    if(!executor)
+      return false;
+
+    node->assign_to_device(executor_device);
+    node->assign_to_executor(executor);
+    executor->submit_directly(node, op_ptr, node_list_t{});
+    op_ptr->get_instrumentations().mark_set_complete();
+    if(!node->is_submitted() || node->is_cancelled())
+      return false;
+    node->wait();
+    return true;
+  }
+
+  runtime* _rt;
+  device_id _source;
+  device_id _dest;
+};
+
+}
+
+memcpy_model::memcpy_model(backend_manager* mgr) {
+  std::string filename =
+      application::get_settings().get<setting::memcpy_model_file>();
+  if(!filename.empty()) {
+    if(!load(filename)) {
+      HIPSYCL_DEBUG_WARNING << "memcpy_model: Could not load memcpy model from "
+                            << filename << ", using default model."
+                            << std::endl;
+    }
+  }
+}
 
 cost_type
 memcpy_model::estimate_runtime_cost(const memory_location &source,
                                     const memory_location &dest,
                                     range<3> num_elements) const
 {
-  // Strongly prefer transfers from the same device to the same device
-  if(source.get_device() == dest.get_device())
-    return 1.0;
+  memcpy_link_parameters params =
+      get_link_parameters(source.get_device(), dest.get_device());
 
-  if (source.get_device().get_full_backend_descriptor().hw_platform ==
-      dest.get_device().get_full_backend_descriptor().hw_platform)
-    return 2.0;
+  std::size_t num_bytes = num_elements.size() * source.get_element_size();
+  std::size_t num_chunks = std::max(
+      get_num_contiguous_chunks(source.get_allocation_shape(), num_elements),
+      get_num_contiguous_chunks(dest.get_allocation_shape(), num_elements));
 
-  return 3.0;
+  cost_type cost = params.latency + num_bytes / params.bandwidth;
+  if(num_chunks > 1)
+    cost += (num_chunks - 1) * params.chunk_overhead;
+  return cost;
 }
 
 memory_location memcpy_model::choose_source(
@@ -67,5 +211,183 @@ memory_location memcpy_model::choose_source(
   return candidate_sources[best_transfer_index];
 }
 
+memcpy_link_parameters
+memcpy_model::get_link_parameters(const device_id &source,
+                                  const device_id &dest) const {
+  std::lock_guard<std::mutex> lock{_mutex};
+  if(const link* l = find_link(source, dest))
+    return l->params;
+  return get_default_parameters(source, dest);
+}
+
+void memcpy_model::set_link_parameters(const device_id &source,
+                                       const device_id &dest,
+                                       const memcpy_link_parameters &params) {
+  std::lock_guard<std::mutex> lock{_mutex};
+  for(auto& l : _links) {
+    if (l.source_backend == source.get_backend() &&
+        l.source_device == source.get_id() &&
+        l.dest_backend == dest.get_backend() && l.dest_device == dest.get_id()) {
+      l.params = params;
+      return;
+    }
+  }
+  _links.push_back(link{source.get_backend(), source.get_id(),
+                        dest.get_backend(), dest.get_id(), params});
+}
+
+const memcpy_model::link *
+memcpy_model::find_link(const device_id &source, const device_id &dest) const {
+  for(const auto& l : _links) {
+    if (l.source_backend == source.get_backend() &&
+        l.source_device == source.get_id() &&
+        l.dest_backend == dest.get_backend() && l.dest_device == dest.get_id())
+      return &l;
+  }
+  return nullptr;
+}
+
+result memcpy_model::calibrate(runtime* rt) {
+  constexpr std::size_t small_size = 4096;
+  constexpr std::size_t large_size = 64 * 1024 * 1024;
+  // Strided transfers copy rows of row_size bytes out of rows
+  // of twice that size
+  constexpr std::size_t row_size = 256;
+  constexpr std::size_t num_rows = large_size / (2 * row_size);
+  constexpr int repetitions = 5;
+
+  std::vector<device_id> devices;
+  rt->backends().for_each_backend([&](backend* b) {
+    for (std::size_t i = 0; i < b->get_hardware_manager()->get_num_devices();
+         ++i)
+      devices.push_back(device_id{b->get_backend_descriptor(),
+                                  static_cast<int>(i)});
+  });
+
+  for(const device_id& source : devices) {
+    for(const device_id& dest : devices) {
+      // Transfers between different device backends are
+      // not supported by the runtime.
+      if (source.get_backend() != dest.get_backend() &&
+          !is_host_device(source) && !is_host_device(dest))
+        continue;
+
+      backend_allocator *source_allocator =
+          rt->backends().get(source.get_backend())->get_allocator(source);
+      backend_allocator *dest_allocator =
+          rt->backends().get(dest.get_backend())->get_allocator(dest);
+
+      void* source_ptr = source_allocator->allocate(0, large_size);
+      void* dest_ptr = dest_allocator->allocate(0, large_size);
+      if(!source_ptr || !dest_ptr) {
+        if(source_ptr)
+          source_allocator->free(source_ptr);
+        if(dest_ptr)
+          dest_allocator->free(dest_ptr);
+        return make_error(
+            __hipsycl_here(),
+            error_info{"memcpy_model: Could not allocate memory for calibration",
+                       error_type::memory_allocation_error});
+      }
+
+      calibration_transfer transfer{rt, source, dest};
+      range<3> contiguous_shape{1, 1, large_size};
+      double t_small = transfer.measure(source_ptr, dest_ptr, contiguous_shape,
+                                        range<3>{1, 1, small_size}, repetitions);
+      double t_large = transfer.measure(source_ptr, dest_ptr, contiguous_shape,
+                                        range<3>{1, 1, large_size}, repetitions);
+      double t_strided = transfer.measure(
+          source_ptr, dest_ptr, range<3>{1, num_rows, 2 * row_size},
+          range<3>{1, num_rows, row_size}, repetitions);
+
+      source_allocator->free(source_ptr);
+      dest_allocator->free(dest_ptr);
+
+      if(t_small < 0 || t_large < 0 || t_strided < 0) {
+        HIPSYCL_DEBUG_WARNING << "memcpy_model: Calibration transfer from "
+                              << get_backend_name(source.get_backend()) << ":"
+                              << source.get_id() << " to "
+                              << get_backend_name(dest.get_backend()) << ":"
+                              << dest.get_id() << " failed, skipping."
+                              << std::endl;
+        continue;
+      }
+
+      memcpy_link_parameters params = get_default_parameters(source, dest);
+      if(t_large > t_small) {
+        params.bandwidth = (large_size - small_size) / (t_large - t_small);
+        params.latency = std::max(0.0, t_small - small_size / params.bandwidth);
+      }
+      double t_strided_contiguous =
+          params.latency + num_rows * row_size / params.bandwidth;
+      params.chunk_overhead =
+          std::max(0.0, (t_strided - t_strided_contiguous) / (num_rows - 1));
+
+      HIPSYCL_DEBUG_INFO << "memcpy_model: "
+                         << get_backend_name(source.get_backend()) << ":"
+                         << source.get_id() << " -> "
+                         << get_backend_name(dest.get_backend()) << ":"
+                         << dest.get_id() << ": latency " << params.latency
+                         << " s, bandwidth " << params.bandwidth
+                         << " bytes/s, chunk overhead "
+                         << params.chunk_overhead << " s" << std::endl;
+      set_link_parameters(source, dest, params);
+    }
+  }
+  return make_success();
+}
+
+bool memcpy_model::load(const std::string& filename) {
+  std::ifstream file{filename};
+  if(!file.is_open())
+    return false;
+
+  std::vector<link> links;
+  std::string line;
+  while(std::getline(file, line)) {
+    if(line.empty() || line[0] == '#')
+      continue;
+
+    std::istringstream sstr{line};
+    std::string source_backend, dest_backend;
+    link l;
+    sstr >> source_backend >> l.source_device >> dest_backend >>
+        l.dest_device >> l.params.latency >> l.params.bandwidth >>
+        l.params.chunk_overhead;
+    if (sstr.fail() ||
+        !get_backend_from_name(source_backend, l.source_backend) ||
+        !get_backend_from_name(dest_backend, l.dest_backend) ||
+        l.params.bandwidth <= 0.0) {
+      HIPSYCL_DEBUG_ERROR << "memcpy_model: Invalid entry in " << filename
+                          << ": " << line << std::endl;
+      return false;
+    }
+    links.push_back(l);
+  }
+
+  std::lock_guard<std::mutex> lock{_mutex};
+  _links = links;
+  return true;
+}
+
+bool memcpy_model::store(const std::string& filename) const {
+  std::ofstream file{filename, std::ios::trunc};
+  if(!file.is_open())
+    return false;
+
+  std::lock_guard<std::mutex> lock{_mutex};
+  file << "# AdaptiveCpp memcpy model\n";
+  file << "# source-backend source-device dest-backend dest-device "
+          "latency[s] bandwidth[bytes/s] chunk-overhead[s]\n";
+  file.precision(10);
+  for(const auto& l : _links) {
+    file << get_backend_name(l.source_backend) << " " << l.source_device << " "
+         << get_backend_name(l.dest_backend) << " " << l.dest_device << " "
+         << l.params.latency << " " << l.params.bandwidth << " "
+         << l.params.chunk_overhead << "\n";
+  }
+  return file.good();
+}
+
 }
 }
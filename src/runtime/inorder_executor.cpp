@@ -25,12 +25,16 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <algorithm>
 #include <cassert>
 
 #include "hipSYCL/runtime/inorder_executor.hpp"
 #include "hipSYCL/runtime/inorder_queue.hpp"
+#include "hipSYCL/runtime/generic/multi_event.hpp"
 #include "hipSYCL/runtime/operations.hpp"
 #include "hipSYCL/runtime/serialization/serialization.hpp"
+#include "hipSYCL/runtime/submission_batch.hpp"
+#include "hipSYCL/runtime/tracing.hpp"
 
 namespace hipsycl {
 namespace rt {
@@ -86,12 +90,42 @@ std::size_t get_maximum_execution_index_for_lane(const node_list_t &nodes,
   return index;
 }
 
+// If the node is part of a batch, its event might otherwise only be inserted
+// at the end of the batch. Make sure that nodes waiting for it do not have
+// to wait for the remainder of the batch.
+void resolve_batch_event(const dag_node_ptr& node) {
+  if (auto *evt = dynamic_cast<batch_completion_event_base *>(
+          node->get_event().get()))
+    evt->resolve();
+}
+
+struct executor_registry {
+  std::mutex mutex;
+  std::vector<inorder_executor*> executors;
+};
+
+executor_registry& get_executor_registry() {
+  // Never destroyed, since executors may outlive static objects
+  static executor_registry* registry = new executor_registry;
+  return *registry;
+}
+
 } // anonymous namespace
 
 inorder_executor::inorder_executor(std::unique_ptr<inorder_queue> q)
-: _q{std::move(q)}, _num_submitted_operations{0} {}
+: _q{std::move(q)}, _num_submitted_operations{0} {
+  executor_registry& registry = get_executor_registry();
+  std::lock_guard<std::mutex> lock{registry.mutex};
+  registry.executors.push_back(this);
+}
 
-inorder_executor::~inorder_executor(){}
+inorder_executor::~inorder_executor(){
+  executor_registry& registry = get_executor_registry();
+  std::lock_guard<std::mutex> lock{registry.mutex};
+  registry.executors.erase(std::remove(registry.executors.begin(),
+                                       registry.executors.end(), this),
+                           registry.executors.end());
+}
 
 bool inorder_executor::is_inorder_queue() const {
   return true;
@@ -117,7 +151,12 @@ void inorder_executor::submit_directly(dag_node_ptr node, operation *op,
   if (node->is_submitted())
     return;
 
+  const bool is_traced = tracing::is_enabled();
+  const std::uint64_t trace_begin = is_traced ? tracing::now() : 0;
+
   node->assign_to_execution_lane(_q.get());
+  if(is_traced)
+    tracing::record_lane_assignment(node.get(), _q->get_device(), _q.get());
 
   node->assign_execution_index(++_num_submitted_operations);
 
@@ -136,6 +175,7 @@ void inorder_executor::submit_directly(dag_node_ptr node, operation *op,
         HIPSYCL_DEBUG_INFO
             << " --> Synchronizes with external node: " << req
             << std::endl;
+        resolve_batch_event(req);
         res = _q->submit_external_wait_for(req);
       } else {
         if (req->get_assigned_execution_lane() == _q.get()) {
@@ -170,6 +210,7 @@ void inorder_executor::submit_directly(dag_node_ptr node, operation *op,
                    "requirement follows in the same inorder queue)"
                 << std::endl;
           } else {
+            resolve_batch_event(req);
             res = _q->submit_queue_wait_for(req);
           }
         }
@@ -186,20 +227,115 @@ void inorder_executor::submit_directly(dag_node_ptr node, operation *op,
       << "inorder_executor: Dispatching to lane " << _q.get() << ": "
       << dump(op) << std::endl;
   
+  const bool is_coarse_grained =
+      node->get_execution_hints()
+          .has_hint<hints::coarse_grained_synchronization>();
+  submission_batch *batch =
+      is_coarse_grained ? nullptr : submission_batch::get_current();
+
+  // Consecutive operations in the same batch share one event, which is
+  // only inserted into the queue when the batch ends or another node
+  // needs to synchronize with it. Since that might happen from other
+  // threads, the event must not be resolved while the operation is
+  // dispatched - otherwise the operation could end up after the event.
+  std::unique_lock<std::mutex> batch_lock;
+  if (batch) {
+    if (_batch_event)
+      batch_lock = _batch_event_control->lock_unresolved();
+    if (!batch_lock.owns_lock()) {
+      _batch_event = _q->create_batch_completion_event();
+      _batch_event_control =
+          dynamic_cast<batch_completion_event_base *>(_batch_event.get());
+      assert(_batch_event_control);
+      batch->register_executor(this);
+      batch_lock = _batch_event_control->lock_unresolved();
+    }
+  }
+
   queue_operation_dispatcher dispatcher{_q.get()};
   res = op->dispatch(&dispatcher, node);
+  if (batch_lock.owns_lock())
+    batch_lock.unlock();
   if (!res.is_success()) {
     register_error(res);
     node->cancel();
     return;
   }
 
-  if (node->get_execution_hints()
-          .has_hint<hints::coarse_grained_synchronization>()) {
+  if (is_coarse_grained) {
     node->mark_submitted(_q->create_queue_completion_event());
+  } else if (batch) {
+    node->mark_submitted(_batch_event);
   } else {
     node->mark_submitted(_q->insert_event());
   }
+
+  {
+    std::lock_guard<std::mutex> lock{_pending_operations_mutex};
+    // Pruning requires querying events, so only do it when the backlog
+    // has grown large; otherwise this is done lazily on query.
+    if(_pending_operations.size() >= max_tracked_pending_operations) {
+      prune_pending_operations();
+      if(_pending_operations.size() >= max_tracked_pending_operations)
+        _pending_operations.pop_front();
+    }
+    _pending_operations.push_back(node);
+    _last_event = node->get_event();
+  }
+
+  if(is_traced)
+    tracing::record_submission(node.get(), trace_begin);
+}
+
+void inorder_executor::prune_pending_operations() const {
+  while(!_pending_operations.empty()) {
+    auto node = _pending_operations.front().lock();
+    if(node && !node->is_cancelled() && !node->is_complete())
+      return;
+    _pending_operations.pop_front();
+  }
+}
+
+std::size_t
+inorder_executor::get_num_pending_operations(const device_id &dev) const {
+  if(!(_q->get_device() == dev))
+    return 0;
+
+  std::lock_guard<std::mutex> lock{_pending_operations_mutex};
+  prune_pending_operations();
+  return _pending_operations.size();
+}
+
+std::shared_ptr<dag_node_event>
+inorder_executor::create_device_fence(const device_id &dev) {
+  std::vector<std::shared_ptr<dag_node_event>> events;
+  {
+    executor_registry& registry = get_executor_registry();
+    std::lock_guard<std::mutex> lock{registry.mutex};
+    for(inorder_executor* executor : registry.executors) {
+      if(!(executor->_q->get_device() == dev))
+        continue;
+      // Since the queue is in-order, the last operation
+      // completes after all others.
+      std::lock_guard<std::mutex> executor_lock{
+          executor->_pending_operations_mutex};
+      if(executor->_last_event && !executor->_last_event->is_complete())
+        events.push_back(executor->_last_event);
+    }
+  }
+  if(events.empty())
+    return nullptr;
+  if(events.size() == 1)
+    return events.front();
+  return std::make_shared<dag_multi_node_event>(std::move(events));
+}
+
+void inorder_executor::finalize_submission_batch() {
+  if(_batch_event) {
+    _batch_event_control->resolve();
+    _batch_event = nullptr;
+    _batch_event_control = nullptr;
+  }
 }
 
 inorder_queue* inorder_executor::get_queue() const {
@@ -216,5 +352,14 @@ bool inorder_executor::is_submitted_by_me(dag_node_ptr node) const {
   return node->get_assigned_executor() == this;
 }
 
+bool inorder_executor::prepare_operation(const device_id &dev, operation *op,
+                                         dag_node_ptr node) {
+  assert(can_execute_on_device(dev));
+  // Only kernels can require expensive preparation
+  if(auto* kernel_op = dynamic_cast<kernel_operation*>(op))
+    return _q->prepare_kernel(*kernel_op, node);
+  return true;
+}
+
 }
 }
\ No newline at end of file
@@ -0,0 +1,106 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+
+#include "hipSYCL/common/debug.hpp"
+#include "hipSYCL/runtime/jit_compilation_service.hpp"
+#include "hipSYCL/runtime/application.hpp"
+#include "hipSYCL/runtime/settings.hpp"
+
+namespace hipsycl {
+namespace rt {
+
+jit_compilation_service& jit_compilation_service::get() {
+  static jit_compilation_service service;
+  return service;
+}
+
+jit_compilation_service::jit_compilation_service()
+    : _max_concurrent_compilations{application::get_settings().get<
+          setting::sscp_jit_max_concurrent_compilations>()} {
+  if(_max_concurrent_compilations == 0)
+    _max_concurrent_compilations =
+        std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+jit_compilation_service::~jit_compilation_service() {
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _is_shutting_down = true;
+  }
+  _cv.notify_all();
+  for(auto& t : _threads)
+    if(t.joinable())
+      t.join();
+}
+
+void jit_compilation_service::submit(std::function<void()> job) {
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _jobs.push_back(std::move(job));
+
+    if(_num_idle_threads < _jobs.size() &&
+       _threads.size() < _max_concurrent_compilations) {
+      HIPSYCL_DEBUG_INFO << "jit_compilation_service: Spawning compilation "
+                            "thread "
+                         << _threads.size() << std::endl;
+      // The new thread counts as idle until it has picked up a job
+      ++_num_idle_threads;
+      _threads.emplace_back([this]() { work(); });
+    }
+  }
+  _cv.notify_one();
+}
+
+std::size_t jit_compilation_service::get_max_concurrent_compilations() const {
+  return _max_concurrent_compilations;
+}
+
+void jit_compilation_service::work() {
+  std::unique_lock<std::mutex> lock{_mutex};
+  for(;;) {
+    _cv.wait(lock, [this]() { return _is_shutting_down || !_jobs.empty(); });
+    // Outstanding jobs are still processed during shutdown, since
+    // other threads may be waiting for their results.
+    if(_jobs.empty())
+      return;
+
+    std::function<void()> job = std::move(_jobs.front());
+    _jobs.pop_front();
+    --_num_idle_threads;
+
+    lock.unlock();
+    job();
+    lock.lock();
+
+    ++_num_idle_threads;
+  }
+}
+
+}
+}
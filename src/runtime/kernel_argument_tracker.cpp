@@ -0,0 +1,135 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include "hipSYCL/common/debug.hpp"
+#include "hipSYCL/runtime/kernel_argument_tracker.hpp"
+#include "hipSYCL/runtime/application.hpp"
+#include "hipSYCL/runtime/settings.hpp"
+
+namespace hipsycl {
+namespace rt {
+
+kernel_argument_tracker& kernel_argument_tracker::get() {
+  static kernel_argument_tracker tracker;
+  return tracker;
+}
+
+kernel_argument_tracker::kernel_argument_tracker()
+    : _threshold{application::get_settings().get<
+          setting::sscp_jit_argument_specialization_threshold>()} {}
+
+bool kernel_argument_tracker::record_launch(
+    const hcf_kernel_info &kernel_info, const std::string &kernel_name,
+    void **args, const std::size_t *arg_sizes,
+    const glue::kernel_configuration &config,
+    glue::kernel_configuration &specialized_config_out) {
+
+  if(!is_enabled())
+    return false;
+
+  std::size_t num_params = kernel_info.get_num_parameters();
+
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  kernel_state &state =
+      _kernels[std::make_pair(kernel_info.get_hcf_object_id(), kernel_name)];
+  if(state.arguments.size() != num_params)
+    state.arguments.resize(num_params);
+
+  bool has_stable_arguments = false;
+  for(std::size_t i = 0; i < num_params; ++i) {
+    hcf_kernel_info::argument_type type = kernel_info.get_argument_type(i);
+    if((type != hcf_kernel_info::integer &&
+        type != hcf_kernel_info::floating_point) ||
+       arg_sizes[i] > sizeof(uint64_t))
+      continue;
+
+    uint64_t value = 0;
+    std::memcpy(&value, args[i], arg_sizes[i]);
+
+    argument_state &arg = state.arguments[i];
+    if(arg.num_stable_launches > 0 && arg.value == value) {
+      ++arg.num_stable_launches;
+    } else {
+      arg.value = value;
+      arg.num_stable_launches = 1;
+    }
+
+    if(arg.num_stable_launches >= _threshold) {
+      if(!has_stable_arguments)
+        specialized_config_out = config;
+      has_stable_arguments = true;
+      specialized_config_out.set_specialized_argument(i, args[i], arg_sizes[i]);
+    }
+  }
+
+  if(!has_stable_arguments)
+    return false;
+
+  auto variant = specialized_config_out.generate_id();
+  if(std::find(state.failed_variants.begin(), state.failed_variants.end(),
+               variant) != state.failed_variants.end())
+    return false;
+
+  if(std::find(state.variants.begin(), state.variants.end(), variant) ==
+     state.variants.end()) {
+    if(state.variants.size() >= max_variants_per_kernel)
+      return false;
+
+    HIPSYCL_DEBUG_INFO << "kernel_argument_tracker: Specializing kernel "
+                       << kernel_name << " for "
+                       << specialized_config_out.specialized_arguments().size()
+                       << " stable argument(s)" << std::endl;
+    state.variants.push_back(variant);
+  }
+
+  return true;
+}
+
+void kernel_argument_tracker::report_failed_compilation(
+    hcf_object_id hcf_object, const std::string &kernel_name,
+    const glue::kernel_configuration &config, const result &err) {
+  if(config.specialized_arguments().empty()) {
+    register_error(err);
+    return;
+  }
+
+  HIPSYCL_DEBUG_WARNING
+      << "kernel_argument_tracker: Compiling specialized variant of kernel "
+      << kernel_name << " failed, falling back to the generic kernel: "
+      << err.what() << std::endl;
+
+  std::lock_guard<std::mutex> lock{_mutex};
+  _kernels[std::make_pair(hcf_object, kernel_name)].failed_variants.push_back(
+      config.generate_id());
+}
+
+}
+}
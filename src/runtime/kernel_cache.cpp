@@ -100,6 +100,10 @@ hcf_kernel_info::hcf_kernel_info(
     std::size_t arg_original_index = std::stoll(*original_index);
     if(*type == "pointer") {
       _arg_types.push_back(pointer);
+    } else if(*type == "integer") {
+      _arg_types.push_back(integer);
+    } else if(*type == "floating-point") {
+      _arg_types.push_back(floating_point);
     } else {
       _arg_types.push_back(other);
     }
@@ -172,13 +176,10 @@ hcf_image_info::hcf_image_info(const common::hcf_container *hcf,
     return;
   
   std::string image_name = image_node->node_id;
-  for(const auto& kernel : kernels->get_subnodes()) {
-    std::vector<std::string> image_providers =
-        kernels->get_subnode(kernel)->get_as_list("image-providers");
-    for(const std::string& provider : image_providers) {
-      if(provider == image_name)
-        _contained_kernels.push_back(kernel);
-    }
+  for(const auto& kernel : kernels->subnodes) {
+    const auto* image_providers = kernel.get_subnode("image-providers");
+    if(image_providers && image_providers->has_subnode(image_name))
+      _contained_kernels.push_back(kernel.node_id);
   }
 
   _parsing_successful = true;
@@ -205,6 +206,87 @@ hcf_cache& hcf_cache::get() {
   return c;
 }
 
+const std::shared_ptr<const hcf_cache::snapshot> &
+hcf_cache::get_snapshot() const {
+  // There is only a single hcf_cache, so a thread_local cache suffices.
+  // Snapshots are only published when HCF objects are (un)registered,
+  // so the version check almost always succeeds and readers only perform
+  // a single load of a shared cache line.
+  thread_local std::shared_ptr<const snapshot> cached_snapshot;
+  thread_local std::size_t cached_version = 0;
+
+  std::size_t current_version = _version.load(std::memory_order_acquire);
+  if(current_version != cached_version) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    cached_snapshot = _snapshot;
+    cached_version = current_version;
+  }
+  return cached_snapshot;
+}
+
+void hcf_cache::publish(std::shared_ptr<const snapshot> s) {
+  _snapshot = std::move(s);
+  _version.fetch_add(1, std::memory_order_release);
+}
+
+hcf_cache::name_table::bucket_array::bucket_array(std::size_t size)
+    : mask{size - 1}, buckets{new std::atomic<const link *>[size]} {
+  assert((size & mask) == 0);
+  for(std::size_t i = 0; i < size; ++i)
+    buckets[i].store(nullptr, std::memory_order_relaxed);
+}
+
+hcf_cache::name_table::name_table() {
+  _bucket_arrays.push_back(std::make_unique<bucket_array>(64));
+  _current_buckets.store(_bucket_arrays.back().get(),
+                         std::memory_order_release);
+}
+
+const hcf_cache::name_table::entry *
+hcf_cache::name_table::find(const std::string &name, std::size_t hash) const {
+  const bucket_array *b = _current_buckets.load(std::memory_order_acquire);
+  for(const link *l = b->buckets[hash & b->mask].load(std::memory_order_acquire);
+      l; l = l->next) {
+    if(l->e->hash == hash && l->e->name == name)
+      return l->e;
+  }
+  return nullptr;
+}
+
+hcf_cache::name_id
+hcf_cache::name_table::find(const std::string &name) const {
+  const entry *e = find(name, std::hash<std::string>{}(name));
+  return e ? e->id : invalid_name_id;
+}
+
+void hcf_cache::name_table::add_link(bucket_array &b, const entry *e) {
+  std::atomic<const link *> &head = b.buckets[e->hash & b.mask];
+  _links.push_back(link{e, head.load(std::memory_order_relaxed)});
+  // Publishes the fully constructed link and entry to readers
+  head.store(&_links.back(), std::memory_order_release);
+}
+
+hcf_cache::name_id hcf_cache::name_table::insert(const std::string &name) {
+  std::size_t hash = std::hash<std::string>{}(name);
+  if(const entry *e = find(name, hash))
+    return e->id;
+
+  _entries.push_back(entry{name, hash, _entries.size()});
+  bucket_array *current = _current_buckets.load(std::memory_order_relaxed);
+  if(_entries.size() > current->mask + 1) {
+    // Build a larger bucket array from scratch before publishing it,
+    // readers continue to use the old one in the meantime.
+    auto grown = std::make_unique<bucket_array>(2 * (current->mask + 1));
+    for(const entry &e : _entries)
+      add_link(*grown, &e);
+    _current_buckets.store(grown.get(), std::memory_order_release);
+    _bucket_arrays.push_back(std::move(grown));
+  } else {
+    add_link(*current, &_entries.back());
+  }
+  return _entries.back().id;
+}
+
 hcf_object_id hcf_cache::register_hcf_object(const common::hcf_container &obj) {
 
   std::lock_guard<std::mutex> lock{_mutex};
@@ -219,14 +301,19 @@ hcf_object_id hcf_cache::register_hcf_object(const common::hcf_container &obj) {
   hcf_object_id id = std::stoull(*data);
   HIPSYCL_DEBUG_INFO << "hcf_cache: Registering HCF object " << id << "..." << std::endl;
 
-  if (_hcf_objects.count(id) > 0) {
+  if (_snapshot->hcf_objects.count(id) > 0) {
     HIPSYCL_DEBUG_ERROR
         << "hcf_cache: Detected hcf object id collision " << id
         << ", this should not happen. Some kernels might be unavailable."
         << std::endl;
   } else {
-    common::hcf_container* stored_obj = new common::hcf_container{obj};
-    _hcf_objects[id] = std::unique_ptr<common::hcf_container>{stored_obj};
+    // Only copies pointers to the per-object info
+    auto new_snapshot = std::make_shared<snapshot>(*_snapshot);
+
+    auto stored_obj = std::make_shared<const common::hcf_container>(obj);
+    new_snapshot->hcf_objects[id] = stored_obj;
+
+    auto object_info = std::make_shared<hcf_object_info>();
     // Check if the HCF exports some symbols
     for_each_exported_symbol_list(
         // Don't use obj here, since we have copied it into the cache, and need
@@ -237,7 +324,7 @@ hcf_object_id hcf_cache::register_hcf_object(const common::hcf_container &obj) {
 
           for (const auto &symbol : exported_symbols) {
 
-            _exported_symbol_providers[symbol].push_back(
+            object_info->exported_symbols[symbol].push_back(
                 device_image_id{id, image_node});
 
             HIPSYCL_DEBUG_INFO << "hcf_cache: Symbol " << symbol
@@ -246,11 +333,13 @@ hcf_object_id hcf_cache::register_hcf_object(const common::hcf_container &obj) {
                                << " @" << image_node << std::endl;
           }
         });
+
     // See if stored object has kernel nodes that we can parse
     if(auto* kernels_node = stored_obj->root_node()->get_subnode("kernels")) {
-      for(const auto& kernel_name : kernels_node->get_subnodes()) {
+      for(const auto& kernel_node : kernels_node->subnodes) {
+        const std::string& kernel_name = kernel_node.node_id;
         std::unique_ptr<hcf_kernel_info> kernel_info{
-            new hcf_kernel_info{id, kernels_node->get_subnode(kernel_name)}};
+            new hcf_kernel_info{id, &kernel_node}};
         if(kernel_info->is_valid()) {
           HIPSYCL_DEBUG_INFO << "hcf_cache: Registering kernel info for kernel "
                              << kernel_name << " from HCF object " << id
@@ -265,26 +354,32 @@ hcf_object_id hcf_cache::register_hcf_object(const common::hcf_container &obj) {
                 << " original index = "
                 << kernel_info->get_original_argument_index(i) << std::endl;
           }
-          _hcf_kernel_info[std::make_pair(id, kernel_name)] =
+          object_info->kernels[_names.insert(kernel_name)] =
               std::move(kernel_info);
         }
       }
     }
     // Same for image nodes
     if(auto* images_node = stored_obj->root_node()->get_subnode("images")) {
-      for(const auto& image_name : images_node->get_subnodes()) {
-        std::unique_ptr<hcf_image_info> image_info{new hcf_image_info{
-            stored_obj, images_node->get_subnode(image_name)}};
+      for(const auto& image_node : images_node->subnodes) {
+        const std::string& image_name = image_node.node_id;
+        std::unique_ptr<hcf_image_info> image_info{
+            new hcf_image_info{stored_obj.get(), &image_node}};
         
         if(image_info->is_valid()) {
           HIPSYCL_DEBUG_INFO << "hcf_cache: Registering image info for image "
                              << image_name << " from HCF object " << id
                              << std::endl;
-          _hcf_image_info[std::make_pair(id, image_name)] =
+          object_info->images[_names.insert(image_name)] =
               std::move(image_info);
         }
       }
     }
+    if(!object_info->exported_symbols.empty())
+      new_snapshot->symbol_exporters.push_back(object_info);
+    new_snapshot->object_info[id] = std::move(object_info);
+
+    publish(std::move(new_snapshot));
   }
 
   std::string hcf_dump_dir =
@@ -314,52 +409,55 @@ hcf_object_id hcf_cache::register_hcf_object(const common::hcf_container &obj) {
 void hcf_cache::unregister_hcf_object(hcf_object_id id) {
   std::lock_guard<std::mutex> lock{_mutex};
 
-  auto it = _hcf_objects.find(id);
-  if(it != _hcf_objects.end()) {
+  auto it = _snapshot->hcf_objects.find(id);
+  if(it != _snapshot->hcf_objects.end()) {
+    auto new_snapshot = std::make_shared<snapshot>(*_snapshot);
     // First remove the HCF object as a symbol provider for runtime linking and
     // symbol resolution. This ensures that it gets no longer selected
     // for symbol resolution.
+    auto info = new_snapshot->object_info.find(id);
+    if(info != new_snapshot->object_info.end()) {
+      auto& exporters = new_snapshot->symbol_exporters;
+      exporters.erase(std::remove(exporters.begin(), exporters.end(),
+                                  info->second),
+                      exporters.end());
+    }
+    // Then we can remove the HCF itself. It is destroyed once no thread
+    // uses an older snapshot anymore.
+    new_snapshot->hcf_objects.erase(id);
 
-    // 1. Go through each symbol list (all device images) exported by this
-    // HCF file
-    for_each_exported_symbol_list(
-        *(it->second), [&](const common::hcf_container::node* image_node,
-                 const std::vector<std::string> &exported_symbols) {
-          // 2. Iterate over all symbols exported in this HCF
-          for (const auto &symbol : exported_symbols) {
-            // 3. Remove all references to this HCF in the symbol providers map  
-            auto& symbol_providers = _exported_symbol_providers[symbol];
-            symbol_providers.erase(
-                std::remove_if(symbol_providers.begin(), symbol_providers.end(),
-                               [&](const device_image_id &img) {
-                                 return img.hcf_id == id;
-                               }),
-                symbol_providers.end());
-          }
-        });
-    // Then we can remove the HCF itself.
-    // Note: We don't necessarily need to remove the HCF kernel info, since
-    // just maintaining this data won't have any side effects as long as 
-    // the HCF object is no longer selected for execution.
-    _hcf_objects.erase(id);
+    publish(std::move(new_snapshot));
   }
 }
 
 const common::hcf_container* hcf_cache::get_hcf(hcf_object_id obj) const {
-  std::lock_guard<std::mutex> lock{_mutex};
+  const snapshot& s = *get_snapshot();
 
-  auto it = _hcf_objects.find(obj);
-  if(it == _hcf_objects.end())
+  auto it = s.hcf_objects.find(obj);
+  if(it == s.hcf_objects.end())
     return nullptr;
   return it->second.get();
 }
 
+hcf_cache::name_id hcf_cache::get_name_id(const std::string &name) const {
+  return _names.find(name);
+}
+
 const hcf_kernel_info *
 hcf_cache::get_kernel_info(hcf_object_id obj,
                            const std::string &kernel_name) const {
-  std::lock_guard<std::mutex> lock{_mutex};
-  auto it = _hcf_kernel_info.find(std::make_pair(obj, kernel_name));
-  if(it == _hcf_kernel_info.end())
+  return get_kernel_info(obj, get_name_id(kernel_name));
+}
+
+const hcf_kernel_info *
+hcf_cache::get_kernel_info(hcf_object_id obj, name_id kernel_name) const {
+  const snapshot& s = *get_snapshot();
+
+  auto info = s.object_info.find(obj);
+  if(info == s.object_info.end())
+    return nullptr;
+  auto it = info->second->kernels.find(kernel_name);
+  if(it == info->second->kernels.end())
     return nullptr;
   return it->second.get();
 }
@@ -367,9 +465,18 @@ hcf_cache::get_kernel_info(hcf_object_id obj,
 const hcf_image_info *
 hcf_cache::get_image_info(hcf_object_id obj,
                           const std::string &image_name) const {
-  std::lock_guard<std::mutex> lock{_mutex};
-  auto it = _hcf_image_info.find(std::make_pair(obj, image_name));
-  if(it == _hcf_image_info.end())
+  return get_image_info(obj, get_name_id(image_name));
+}
+
+const hcf_image_info *
+hcf_cache::get_image_info(hcf_object_id obj, name_id image_name) const {
+  const snapshot& s = *get_snapshot();
+
+  auto info = s.object_info.find(obj);
+  if(info == s.object_info.end())
+    return nullptr;
+  auto it = info->second->images.find(image_name);
+  if(it == info->second->images.end())
     return nullptr;
   return it->second.get();
 }
@@ -384,7 +491,32 @@ kernel_cache::get_global_kernel_index(const std::string &kernel_name) const {
 }
 
 
+std::string kernel_cache::make_construction_key(
+    backend_id b, std::size_t device_index, hcf_object_id source_object,
+    const std::string &image_name, const std::vector<std::string> &kernel_names,
+    const glue::kernel_configuration::id_type &config_id) {
+  std::string key = std::to_string(static_cast<int>(b)) + "." +
+                    std::to_string(device_index) + "." +
+                    std::to_string(source_object) + "." + image_name + "." +
+                    std::to_string(config_id[0]) + "." +
+                    std::to_string(config_id[1]);
+  // Objects compiled from the whole image are identified by the image
+  // name alone, which keeps the key short for images with many kernels.
+  if(kernel_names.size() == 1)
+    key += "." + kernel_names.front();
+  return key;
+}
+
 void kernel_cache::unload() {
+  std::vector<code_object_future> pending_constructions;
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    for(const auto& construction : _pending_constructions)
+      pending_constructions.push_back(construction.second);
+  }
+  for(const auto& construction : pending_constructions)
+    construction.wait();
+
   std::lock_guard<std::mutex> lock{_mutex};
 
   _kernel_code_objects.clear();
@@ -247,6 +247,22 @@ bool multi_queue_executor::can_execute_on_device(const device_id &dev) const {
   return _backend == dev.get_backend();
 }
 
+bool multi_queue_executor::prepare_operation(const device_id &dev,
+                                             operation *op, dag_node_ptr node) {
+  // Nodes may be bound to devices that do not exist; these
+  // fail later on submission.
+  if(dev.get_backend() != _backend ||
+     static_cast<std::size_t>(dev.get_id()) >= _device_data.size())
+    return true;
+  const per_device_data& data = _device_data[dev.get_id()];
+  if(data.kernel_lanes.num_lanes == 0)
+    return true;
+  // The preparations concern the device and not a particular lane, so
+  // it does not matter which lane the operation is submitted to later.
+  return data.executors[data.kernel_lanes.begin]->prepare_operation(dev, op,
+                                                                   node);
+}
+
 bool multi_queue_executor::is_submitted_by_me(dag_node_ptr node) const {
   if(!node->is_submitted())
     return false;
@@ -261,6 +277,17 @@ bool multi_queue_executor::is_submitted_by_me(dag_node_ptr node) const {
   return false;
 }
 
+std::size_t
+multi_queue_executor::get_num_pending_operations(const device_id &dev) const {
+  if(dev.get_backend() != _backend || dev.get_id() >= _device_data.size())
+    return 0;
+
+  std::size_t num_pending = 0;
+  for(const auto& executor : _device_data[dev.get_id()].executors)
+    num_pending += executor->get_num_pending_operations(dev);
+  return num_pending;
+}
+
 bool multi_queue_executor::find_assigned_lane_index(dag_node_ptr node, std::size_t& index_out) const {
   if(!node->is_submitted())
     return false;
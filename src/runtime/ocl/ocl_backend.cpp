@@ -55,7 +55,17 @@ namespace rt {
 ocl_backend::ocl_backend()
 : _executor(*this, [this](device_id dev){
   return std::make_unique<ocl_queue>(&(this->_hw_manager), dev.get_id());
-}) {}
+}) {
+  for(std::size_t i = 0; i < _hw_manager.get_num_devices(); ++i) {
+    auto *dev_ctx =
+        static_cast<ocl_hardware_context *>(_hw_manager.get_device(i));
+    auto alloc = caching_allocator::create_if_enabled(
+        dev_ctx->get_allocator(), _hw_manager.get_device_id(i));
+    if(!alloc)
+      break;
+    _caching_allocators.push_back(std::move(alloc));
+  }
+}
 
 ocl_backend::~ocl_backend(){}
 
@@ -96,6 +106,9 @@ backend_allocator *ocl_backend::get_allocator(device_id dev) const {
     return nullptr;
   }
 
+  if(dev.get_id() < _caching_allocators.size())
+    return _caching_allocators[dev.get_id()].get();
+
   ocl_hardware_context *dev_ctx =
       static_cast<ocl_hardware_context *>(_hw_manager.get_device(dev.get_id()));
   return dev_ctx->get_allocator();
@@ -49,6 +49,17 @@ result ocl_sscp_code_object_invoker::submit_kernel(
       arg_sizes, num_args, config);
 }
 
+bool ocl_sscp_code_object_invoker::prepare_kernel(
+    const kernel_operation &op, hcf_object_id hcf_object,
+    const std::string &kernel_name, unsigned int local_mem_size,
+    const glue::kernel_configuration &config) {
+
+  assert(_queue);
+
+  return _queue->prepare_sscp_kernel(op, hcf_object, kernel_name,
+                                     local_mem_size, config);
+}
+
 ocl_executable_object::ocl_executable_object(const cl::Context& ctx, cl::Device& dev,
     hcf_object_id source, const std::string& code_image, const glue::kernel_configuration &config)
 : _source{source}, _ctx{ctx}, _dev{dev}, _id{config.generate_id()} {
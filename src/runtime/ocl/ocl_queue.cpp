@@ -29,15 +29,20 @@
 #include "hipSYCL/runtime/error.hpp"
 #include "hipSYCL/runtime/serialization/serialization.hpp"
 #include "hipSYCL/runtime/kernel_cache.hpp"
+#include "hipSYCL/runtime/kernel_argument_tracker.hpp"
 #include "hipSYCL/runtime/inorder_queue.hpp"
 #include "hipSYCL/runtime/executor.hpp"
 #include "hipSYCL/runtime/code_object_invoker.hpp"
 #include "hipSYCL/runtime/ocl/ocl_code_object.hpp"
 #include "hipSYCL/runtime/queue_completion_event.hpp"
+#include "hipSYCL/runtime/batch_completion_event.hpp"
 #include "hipSYCL/runtime/ocl/ocl_event.hpp"
 #include "hipSYCL/runtime/ocl/ocl_queue.hpp"
 #include "hipSYCL/runtime/ocl/ocl_hardware_manager.hpp"
 
+#include <chrono>
+#include <future>
+
 #ifdef HIPSYCL_WITH_SSCP_COMPILER
 
 #include "hipSYCL/compiler/llvm-to-backend/spirv/LLVMToSpirvFactory.hpp"
@@ -182,6 +187,10 @@ std::shared_ptr<dag_node_event> ocl_queue::create_queue_completion_event() {
       this);
 }
 
+std::shared_ptr<dag_node_event> ocl_queue::create_batch_completion_event() {
+  return std::make_shared<batch_completion_event<cl::Event>>(this);
+}
+
 result ocl_queue::submit_memcpy(memcpy_operation &op, dag_node_ptr) {
 
   HIPSYCL_DEBUG_INFO << "ocl_queue: On device "
@@ -264,6 +273,20 @@ result ocl_queue::submit_kernel(kernel_operation &op, dag_node_ptr node) {
   return make_success();
 }
 
+bool ocl_queue::prepare_kernel(kernel_operation &op, dag_node_ptr node) {
+  rt::backend_kernel_launcher *l =
+      op.get_launcher().find_launcher(backend_id::ocl);
+  if (!l)
+    // Error is reported by submit_kernel()
+    return true;
+
+  rt::backend_kernel_launch_capabilities cap;
+  cap.provide_sscp_invoker(&_sscp_invoker);
+  l->set_backend_capabilities(cap);
+
+  return l->prepare(node.get(), op.get_launcher().get_kernel_configuration());
+}
+
 result ocl_queue::submit_prefetch(prefetch_operation &op, dag_node_ptr) {
   ocl_hardware_context *ocl_ctx = static_cast<ocl_hardware_context *>(
         _hw_manager->get_device(_device_index));
@@ -402,13 +425,12 @@ ocl_hardware_manager *ocl_queue::get_hardware_manager() const {
   return _hw_manager;
 }
 
-result ocl_queue::submit_sscp_kernel_from_code_object(
+result ocl_queue::request_sscp_code_object(
     const kernel_operation &op, hcf_object_id hcf_object,
-    const std::string &kernel_name, const rt::range<3> &num_groups,
-    const rt::range<3> &group_size, unsigned local_mem_size, void **args,
-    std::size_t *arg_sizes, std::size_t num_args,
-    const glue::kernel_configuration &initial_config) {
-
+    const std::string &kernel_name, unsigned local_mem_size,
+    const glue::kernel_configuration &initial_config,
+    kernel_cache::code_object_future &code_object_out,
+    const hcf_kernel_info *&kernel_info_out) {
 
 #ifdef HIPSYCL_WITH_SSCP_COMPILER
 
@@ -442,6 +464,7 @@ result ocl_queue::submit_sscp_kernel_from_code_object(
         error_info{"ocl_queue: Could not obtain hcf kernel info for kernel " +
             global_kernel_name});
   }
+  kernel_info_out = kernel_info;
 
   auto code_object_selector = [&](const code_object *candidate) -> bool {
     if ((candidate->managing_backend() != backend_id::ocl) ||
@@ -455,15 +478,21 @@ result ocl_queue::submit_sscp_kernel_from_code_object(
     if(obj->configuration_id() != configuration_id)
       return false;
 
+    // Objects may only contain some of the kernels of the image
+    if(!obj->contains(kernel_name))
+      return false;
+
     return obj->get_cl_device() == dev && obj->get_cl_context() == ctx;
   };
 
-  auto code_object_constructor = [&]() -> code_object* {
+  std::vector<std::string> kernel_names;
+  std::string selected_image_name = glue::jit::select_image_and_kernels(
+      kernel_info, kernel_name, config, kernel_names);
+
+  // Runs on a JIT compilation thread, so everything needs to be
+  // captured by value.
+  auto code_object_constructor = [=]() mutable -> code_object* {
     const common::hcf_container* hcf = rt::hcf_cache::get().get_hcf(hcf_object);
-    
-    std::vector<std::string> kernel_names;
-    std::string selected_image_name =
-        glue::jit::select_image(kernel_info, &kernel_names);
 
     // Construct SPIR-V translator to compile the specified kernels
     std::unique_ptr<compiler::LLVMToBackendTranslator> translator = 
@@ -480,7 +509,8 @@ result ocl_queue::submit_sscp_kernel_from_code_object(
         hcf, selected_image_name, config, compiled_image);
     
     if(!err.is_success()) {
-      register_error(err);
+      kernel_argument_tracker::get().report_failed_compilation(
+          hcf_object, kernel_name, initial_config, err);
       return nullptr;
     }
 
@@ -489,7 +519,8 @@ result ocl_queue::submit_sscp_kernel_from_code_object(
     result r = exec_obj->get_build_result();
 
     if(!r.is_success()) {
-      register_error(r);
+      kernel_argument_tracker::get().report_failed_compilation(
+          hcf_object, kernel_name, initial_config, r);
       delete exec_obj;
       return nullptr;
     }
@@ -497,15 +528,99 @@ result ocl_queue::submit_sscp_kernel_from_code_object(
     return exec_obj;
   };
 
-  const code_object *obj = _kernel_cache->get_or_construct_code_object(
+  code_object_out = _kernel_cache->get_or_construct_code_object_async(
       *kidx, kernel_name, backend_id::ocl, hcf_object,
+      kernel_cache::make_construction_key(backend_id::ocl, _device_index,
+                                          hcf_object, selected_image_name,
+                                          kernel_names, configuration_id),
       code_object_selector, code_object_constructor);
 
+  return make_success();
+#else
+  return make_error(
+      __hipsycl_here(),
+      error_info{"ocl_queue: SSCP kernel launch was requested, but hipSYCL was "
+                 "not built with OpenCL SSCP support."});
+#endif
+}
+
+bool ocl_queue::prepare_sscp_kernel(const kernel_operation &op,
+                                    hcf_object_id hcf_object,
+                                    const std::string &kernel_name,
+                                    unsigned local_mem_size,
+                                    const glue::kernel_configuration &config) {
+  kernel_cache::code_object_future pending_object;
+  const hcf_kernel_info *kernel_info = nullptr;
+  // Errors are reported when the kernel is submitted
+  if (!request_sscp_code_object(op, hcf_object, kernel_name, local_mem_size,
+                                config, pending_object, kernel_info)
+           .is_success())
+    return true;
+
+  return pending_object.wait_for(std::chrono::seconds{0}) ==
+         std::future_status::ready;
+}
+
+result ocl_queue::submit_sscp_kernel_from_code_object(
+    const kernel_operation &op, hcf_object_id hcf_object,
+    const std::string &kernel_name, const rt::range<3> &num_groups,
+    const rt::range<3> &group_size, unsigned local_mem_size, void **args,
+    std::size_t *arg_sizes, std::size_t num_args,
+    const glue::kernel_configuration &initial_config) {
+
+
+#ifdef HIPSYCL_WITH_SSCP_COMPILER
+
+  kernel_cache::code_object_future pending_object;
+  const hcf_kernel_info *kernel_info = nullptr;
+  result request_res = request_sscp_code_object(
+      op, hcf_object, kernel_name, local_mem_size, initial_config,
+      pending_object, kernel_info);
+  if(!request_res.is_success())
+    return request_res;
+
+  glue::jit::cxx_argument_mapper arg_mapper{*kernel_info, args, arg_sizes,
+                                            num_args};
+  if(!arg_mapper.mapping_available()) {
+    return make_error(
+        __hipsycl_here(),
+        error_info{
+            "ocl_queue: Could not map C++ arguments to kernel arguments"});
+  }
+
+  // If some scalar arguments have had the same values for a while, use the
+  // variant of the kernel specialized for them once it has been compiled.
+  // Since the variant is looked up by the argument values of this launch,
+  // it is only used if they match the values that it was compiled for.
+  const code_object *obj = nullptr;
+  glue::kernel_configuration specialized_config;
+  if (kernel_argument_tracker::get().record_launch(
+          *kernel_info, kernel_name, arg_mapper.get_mapped_args(),
+          arg_mapper.get_mapped_arg_sizes(), initial_config,
+          specialized_config)) {
+    kernel_cache::code_object_future specialized_object;
+    const hcf_kernel_info *specialized_kernel_info = nullptr;
+    if (request_sscp_code_object(op, hcf_object, kernel_name, local_mem_size,
+                                 specialized_config, specialized_object,
+                                 specialized_kernel_info)
+            .is_success() &&
+        specialized_object.wait_for(std::chrono::seconds{0}) ==
+            std::future_status::ready)
+      obj = specialized_object.get();
+  }
+
+  // Only blocks if the code object is still being compiled
+  if(!obj)
+    obj = pending_object.get();
+
   if(!obj) {
     return make_error(__hipsycl_here(),
                       error_info{"ocl_queue: Code object construction failed"});
   }
 
+  ocl_hardware_context *hw_ctx = static_cast<ocl_hardware_context *>(
+      _hw_manager->get_device(_device_index));
+
   cl::Kernel kernel;
   result res = static_cast<const ocl_executable_object *>(obj)->get_kernel(
       kernel_name, kernel);
@@ -516,16 +631,6 @@ result ocl_queue::submit_sscp_kernel_from_code_object(
   HIPSYCL_DEBUG_INFO << "ocl_queue: Attempting to submit SSCP kernel"
                      << std::endl;
 
-
-  glue::jit::cxx_argument_mapper arg_mapper{*kernel_info, args, arg_sizes,
-                                            num_args};
-  if(!arg_mapper.mapping_available()) {
-    return make_error(
-        __hipsycl_here(),
-        error_info{
-            "ocl_queue: Could not map C++ arguments to kernel arguments"});
-  }
-
   cl::Event completion_evt;
   auto submission_err = submit_ocl_kernel(
       kernel, _queue, group_size, num_groups, arg_mapper.get_mapped_args(),
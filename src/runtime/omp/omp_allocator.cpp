@@ -26,18 +26,77 @@
  */
 #include <cstdlib>
 
+#include "hipSYCL/runtime/application.hpp"
 #include "hipSYCL/runtime/device_id.hpp"
 #include "hipSYCL/runtime/error.hpp"
+#include "hipSYCL/runtime/generic/host_thread_pool.hpp"
 #include "hipSYCL/runtime/omp/omp_allocator.hpp"
+#include "hipSYCL/runtime/omp/omp_hardware_manager.hpp"
 #include "hipSYCL/runtime/util.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <omp.h>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 namespace hipsycl {
 namespace rt {
 
-omp_allocator::omp_allocator(const device_id &my_device)
-    : _my_device{my_device} {}
+namespace {
+
+// Smaller allocations are served by the C allocator, since placing
+// them individually would waste too much memory
+constexpr std::size_t numa_placement_min_size = 1024 * 1024;
+
+struct first_touch_args {
+  char *ptr;
+  std::size_t num_pages;
+  std::size_t page_size;
+};
+
+// Touches the pages that the given thread would process if the allocation
+// were processed with the static schedule that kernels use by default.
+void touch_pages(void *data, int thread_id, int num_threads) {
+  first_touch_args *args = static_cast<first_touch_args *>(data);
+
+  std::size_t t = static_cast<std::size_t>(thread_id);
+  std::size_t remainder = args->num_pages % num_threads;
+  std::size_t pages_per_thread = args->num_pages / num_threads;
+  std::size_t begin = t * pages_per_thread + std::min(t, remainder);
+  std::size_t num_pages = pages_per_thread + (t < remainder ? 1 : 0);
+
+  std::memset(args->ptr + begin * args->page_size, 0,
+              num_pages * args->page_size);
+}
+
+}
+
+omp_allocator::omp_allocator(const device_id &my_device,
+                             host_thread_pool *thread_pool,
+                             const omp_hardware_manager &hw)
+    : _my_device{my_device}, _thread_pool{thread_pool},
+      _is_numa_device{false}, _numa_placement{omp_numa_placement::none} {
+
+  if (const numa_domain *device_domain =
+          hw.get_device_numa_domain(my_device.get_id())) {
+    _numa_domains.push_back(*device_domain);
+    _is_numa_device = true;
+  } else if (hw.get_numa_domains().size() > 1) {
+    _numa_placement =
+        application::get_settings().get<setting::omp_numa_placement>();
+    if (_numa_placement != omp_numa_placement::none)
+      _numa_domains = hw.get_numa_domains();
+  }
+}
 
 void *omp_allocator::allocate(size_t min_alignment, size_t size_bytes) {
+  if(is_numa_placed(min_alignment, size_bytes))
+    return allocate_numa_placed(size_bytes);
+
 #if !defined(_WIN32)
   // posix requires alignment to be a multiple of sizeof(void*)
   if (min_alignment < sizeof(void*))
@@ -72,6 +131,23 @@ void *omp_allocator::allocate_optimized_host(size_t min_alignment,
 };
 
 void omp_allocator::free(void *mem) {
+#ifdef __linux__
+  if(!_numa_domains.empty()) {
+    std::size_t mapped_size = 0;
+    {
+      std::lock_guard<std::mutex> lock{_mapped_allocations_mutex};
+      auto it = _mapped_allocations.find(mem);
+      if(it != _mapped_allocations.end()) {
+        mapped_size = it->second;
+        _mapped_allocations.erase(it);
+      }
+    }
+    if(mapped_size > 0) {
+      munmap(mem, mapped_size);
+      return;
+    }
+  }
+#endif
 #if !defined(_WIN32)
   std::free(mem);
 #else
@@ -108,5 +184,55 @@ result omp_allocator::mem_advise(const void *addr, std::size_t num_bytes,
   return make_success();
 }
 
+bool omp_allocator::is_numa_placed(std::size_t min_alignment,
+                                   std::size_t size_bytes) const {
+#ifdef __linux__
+  return !_numa_domains.empty() && size_bytes >= numa_placement_min_size &&
+         min_alignment <= static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#else
+  return false;
+#endif
+}
+
+void *omp_allocator::allocate_numa_placed(std::size_t size_bytes) {
+#ifdef __linux__
+  std::size_t page_size = sysconf(_SC_PAGESIZE);
+  std::size_t mapped_size = (size_bytes + page_size - 1) / page_size * page_size;
+
+  void *ptr = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if(ptr == MAP_FAILED)
+    return nullptr;
+
+  if(_is_numa_device)
+    numa_prefer_node(ptr, mapped_size, _numa_domains[0]);
+  else if(_numa_placement == omp_numa_placement::interleave)
+    numa_interleave(ptr, mapped_size, _numa_domains);
+  else if(_numa_placement == omp_numa_placement::first_touch)
+    first_touch(ptr, mapped_size);
+
+  std::lock_guard<std::mutex> lock{_mapped_allocations_mutex};
+  _mapped_allocations[ptr] = mapped_size;
+  return ptr;
+#else
+  return nullptr;
+#endif
+}
+
+void omp_allocator::first_touch(void *ptr, std::size_t size_bytes) {
+#ifdef __linux__
+  first_touch_args args{static_cast<char *>(ptr),
+                        size_bytes / sysconf(_SC_PAGESIZE),
+                        static_cast<std::size_t>(sysconf(_SC_PAGESIZE))};
+
+  if(_thread_pool) {
+    _thread_pool->run(touch_pages, &args);
+  } else {
+#pragma omp parallel
+    touch_pages(&args, omp_get_thread_num(), omp_get_num_threads());
+  }
+#endif
+}
+
 }
 }
@@ -33,8 +33,11 @@
 #include "hipSYCL/runtime/device_id.hpp"
 #include "hipSYCL/runtime/error.hpp"
 #include "hipSYCL/runtime/multi_queue_executor.hpp"
+#include "hipSYCL/common/debug.hpp"
 #include <memory>
 
+#include <omp.h>
+
 
 HIPSYCL_PLUGIN_API_EXPORT
 hipsycl::rt::backend *hipsycl_backend_plugin_create() {
@@ -55,19 +58,80 @@ namespace rt {
 
 namespace {
 
-std::unique_ptr<inorder_queue> make_omp_queue(device_id dev) {
-  return std::make_unique<omp_queue>(dev.get_backend());
+std::unique_ptr<inorder_queue> make_omp_queue(device_id dev,
+                                              host_thread_pool *thread_pool,
+                                              const numa_domain *domain) {
+  auto q = std::make_unique<omp_queue>(dev, thread_pool);
+  if(domain) {
+    std::vector<int> cpus = domain->cpus;
+    // The worker thread participates in kernel execution
+    q->get_worker()([cpus]() { bind_current_thread_to_cpus(cpus); });
+  }
+  return q;
+}
+
+std::vector<std::unique_ptr<host_thread_pool>>
+make_thread_pools(const omp_hardware_manager &hw) {
+  std::vector<std::unique_ptr<host_thread_pool>> pools;
+  bool pin_threads = application::get_settings().get<setting::omp_pin_threads>();
+  bool use_thread_pool =
+      application::get_settings().get<setting::omp_thread_pool>();
+
+  for(std::size_t i = 0; i < hw.get_num_devices(); ++i) {
+    const numa_domain *domain = hw.get_device_numa_domain(i);
+    if(!use_thread_pool) {
+      if(domain) {
+        HIPSYCL_DEBUG_WARNING
+            << "omp_backend: Thread pool is disabled, kernels on NUMA "
+               "devices will not be restricted to their NUMA node"
+            << std::endl;
+      }
+      pools.push_back(nullptr);
+    } else if(domain) {
+      pools.push_back(std::make_unique<host_thread_pool>(
+          static_cast<int>(domain->cpus.size()), domain->cpus));
+    } else {
+      int num_threads = omp_get_max_threads();
+      std::vector<int> cpus;
+      if(pin_threads) {
+        cpus = get_process_cpus();
+        // If the pool only uses some of the CPUs, pinning would pile the
+        // workers onto the first CPUs of the mask, and they would compete
+        // with other threads of the process that the scheduler could
+        // otherwise move elsewhere.
+        if(cpus.size() != static_cast<std::size_t>(num_threads)) {
+          HIPSYCL_DEBUG_WARNING
+              << "omp_backend: Not pinning worker threads, the thread pool "
+                 "size ("
+              << num_threads << ") does not match the number of CPUs ("
+              << cpus.size() << ")" << std::endl;
+          cpus.clear();
+        }
+      }
+      pools.push_back(std::make_unique<host_thread_pool>(num_threads, cpus));
+    }
+  }
+  return pools;
 }
 
 }
 
 omp_backend::omp_backend()
-    : _allocator{device_id{
-          backend_descriptor{omp_backend::get_hardware_platform(), omp_backend::get_api_platform()}, 0}},
-      _hw{},
-      _executor(*this, [](device_id dev) -> std::unique_ptr<inorder_queue> {
-        return make_omp_queue(dev);
-      }) {}
+    : _hw{},
+      _thread_pools{make_thread_pools(_hw)},
+      _executor(*this, [this](device_id dev) -> std::unique_ptr<inorder_queue> {
+        return make_omp_queue(dev, _thread_pools[dev.get_id()].get(),
+                              _hw.get_device_numa_domain(dev.get_id()));
+      }) {
+
+  for(std::size_t i = 0; i < _hw.get_num_devices(); ++i) {
+    _allocators.push_back(std::make_unique<omp_allocator>(
+        _hw.get_device_id(i), _thread_pools[i].get(), _hw));
+    _caching_allocators.push_back(
+        caching_allocator::create_if_enabled(_allocators.back().get(),
+                                             _hw.get_device_id(i)));
+  }
+}
 
 api_platform omp_backend::get_api_platform() const {
   return api_platform::omp;
@@ -103,7 +167,17 @@ backend_allocator* omp_backend::get_allocator(device_id dev) const {
                               error_type::invalid_parameter_error});
     return nullptr;
   }
-  return &_allocator;
+  if(dev.get_id() < 0 ||
+     static_cast<std::size_t>(dev.get_id()) >= _allocators.size()) {
+    register_error(__hipsycl_here(),
+                   error_info{"omp_backend: Requested allocator for "
+                              "non-existent device",
+                              error_type::invalid_parameter_error});
+    return nullptr;
+  }
+  if(_caching_allocators[dev.get_id()])
+    return _caching_allocators[dev.get_id()].get();
+  return _allocators[dev.get_id()].get();
 }
 
 std::string omp_backend::get_name() const {
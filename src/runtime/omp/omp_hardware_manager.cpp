@@ -27,15 +27,51 @@
 
 
 #include <omp.h>
+#include <algorithm>
 #include <limits>
 
 #include "hipSYCL/runtime/omp/omp_hardware_manager.hpp"
+#include "hipSYCL/runtime/application.hpp"
 #include "hipSYCL/runtime/error.hpp"
 #include "hipSYCL/runtime/device_id.hpp"
+#include "hipSYCL/runtime/settings.hpp"
 
 namespace hipsycl {
 namespace rt {
 
+namespace {
+
+std::size_t get_native_vector_width() {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_cpu_init();
+  if(__builtin_cpu_supports("avx512f"))
+    return 16;
+  if(__builtin_cpu_supports("avx"))
+    return 8;
+  return 4;
+#elif defined(__aarch64__) || defined(__ARM_NEON) || defined(__powerpc64__)
+  return 4;
+#else
+  return 1;
+#endif
+}
+
+}
+
+std::size_t get_omp_sub_group_size() {
+  static const std::size_t sub_group_size = []() -> std::size_t {
+    std::size_t size =
+        application::get_settings().get<setting::omp_sub_group_size>();
+    if(size == 0)
+      size = get_native_vector_width();
+    // Sub-groups cannot be larger than the maximum work group size
+    return std::min(size, std::size_t{1024});
+  }();
+  return sub_group_size;
+}
+
+omp_hardware_context::omp_hardware_context(const numa_domain &domain)
+    : _numa_node{domain.node}, _num_cpus{domain.cpus.size()} {}
 
 bool omp_hardware_context::is_cpu() const {
   return true;
@@ -55,6 +91,9 @@ std::size_t omp_hardware_context::get_max_memcpy_concurrency() const {
 }
 
 std::string omp_hardware_context::get_device_name() const {
+  if(_numa_node >= 0)
+    return "hipSYCL OpenMP host device (NUMA node " +
+           std::to_string(_numa_node) + ")";
   return "hipSYCL OpenMP host device";
 }
 
@@ -133,6 +172,8 @@ std::size_t
 omp_hardware_context::get_property(device_uint_property prop) const {
   switch (prop) {
   case device_uint_property::max_compute_units:
+    if(_numa_node >= 0)
+      return _num_cpus;
     return omp_get_num_procs();
     break;
   case device_uint_property::max_global_size0:
@@ -285,7 +326,7 @@ std::vector<std::size_t> omp_hardware_context::get_property(device_uint_list_pro
 {
   switch(prop) {
   case device_uint_list_property::sub_group_sizes:
-    return std::vector<std::size_t>{1};
+    return std::vector<std::size_t>{get_omp_sub_group_size()};
     break;
   }
   assert(false && "Invalid device property");
@@ -298,11 +339,26 @@ std::string omp_hardware_context::get_profile() const {
   return "FULL_PROFILE";
 }
 
-std::size_t omp_hardware_manager::get_num_devices() const { return 1; }
+omp_hardware_manager::omp_hardware_manager()
+    : _numa_domains{rt::get_numa_domains()}, _has_numa_devices{false} {
+
+  if (_numa_domains.size() > 1 &&
+      application::get_settings().get<setting::omp_numa_devices>()) {
+    _has_numa_devices = true;
+    for(const auto& domain : _numa_domains)
+      _devices.push_back(omp_hardware_context{domain});
+  } else {
+    _devices.push_back(omp_hardware_context{});
+  }
+}
+
+std::size_t omp_hardware_manager::get_num_devices() const {
+  return _devices.size();
+}
 
 
 hardware_context* omp_hardware_manager::get_device(std::size_t index) {
-  if(index != 0) {
+  if(index >= _devices.size()) {
     register_error(__hipsycl_here(),
                    error_info{"omp_hardware_manager: Requested device " +
                                   std::to_string(index) + " does not exist.",
@@ -310,7 +366,7 @@ hardware_context* omp_hardware_manager::get_device(std::size_t index) {
     return nullptr;
   }
 
-  return &_device;
+  return &_devices[index];
 }
 
 device_id omp_hardware_manager::get_device_id(std::size_t index) const {
@@ -319,6 +375,17 @@ device_id omp_hardware_manager::get_device_id(std::size_t index) const {
       static_cast<int>(index)};
 }
 
+const numa_domain *
+omp_hardware_manager::get_device_numa_domain(std::size_t index) const {
+  if(!_has_numa_devices || index >= _numa_domains.size())
+    return nullptr;
+  return &_numa_domains[index];
+}
+
+const std::vector<numa_domain>& omp_hardware_manager::get_numa_domains() const {
+  return _numa_domains;
+}
+
 
 }
 }
@@ -0,0 +1,140 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "hipSYCL/runtime/omp/omp_numa.hpp"
+#include "hipSYCL/runtime/generic/host_thread_pool.hpp"
+#include "hipSYCL/common/debug.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace hipsycl {
+namespace rt {
+
+namespace {
+
+// Memory policies as defined in linux/mempolicy.h
+constexpr int mpol_preferred = 1;
+constexpr int mpol_interleave = 3;
+
+constexpr int max_numa_nodes = 1024;
+constexpr std::size_t node_mask_words =
+    max_numa_nodes / (8 * sizeof(unsigned long));
+
+// Parses CPU lists in the format used by sysfs, e.g. "0-3,8-11"
+std::vector<int> parse_cpu_list(const std::string& list) {
+  std::vector<int> result;
+  std::stringstream sstr{list};
+  std::string range;
+  while(std::getline(sstr, range, ',')) {
+    if(range.empty())
+      continue;
+    std::size_t separator = range.find('-');
+    try {
+      if(separator == std::string::npos) {
+        result.push_back(std::stoi(range));
+      } else {
+        int first = std::stoi(range.substr(0, separator));
+        int last = std::stoi(range.substr(separator + 1));
+        for(int i = first; i <= last; ++i)
+          result.push_back(i);
+      }
+    } catch(...) {
+      return {};
+    }
+  }
+  return result;
+}
+
+bool set_memory_policy(void *ptr, std::size_t bytes, int mode,
+                       const std::vector<numa_domain> &domains) {
+#ifdef __linux__
+  unsigned long node_mask[node_mask_words] = {};
+  for(const auto& d : domains) {
+    if(d.node < 0 || d.node >= max_numa_nodes)
+      return false;
+    node_mask[d.node / (8 * sizeof(unsigned long))] |=
+        1ul << (d.node % (8 * sizeof(unsigned long)));
+  }
+  if(syscall(SYS_mbind, ptr, bytes, mode, node_mask, max_numa_nodes, 0) != 0) {
+    HIPSYCL_DEBUG_WARNING << "omp_numa: Could not set memory policy"
+                          << std::endl;
+    return false;
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+}
+
+std::vector<numa_domain> get_numa_domains() {
+  std::vector<numa_domain> result;
+#ifdef __linux__
+  std::vector<int> available_cpus = get_process_cpus();
+
+  for(int node = 0; node < max_numa_nodes; ++node) {
+    std::ifstream file{"/sys/devices/system/node/node" + std::to_string(node) +
+                       "/cpulist"};
+    if(!file.is_open())
+      continue;
+
+    std::string cpu_list;
+    std::getline(file, cpu_list);
+
+    numa_domain domain{node, {}};
+    for(int cpu : parse_cpu_list(cpu_list)) {
+      if(std::find(available_cpus.begin(), available_cpus.end(), cpu) !=
+         available_cpus.end())
+        domain.cpus.push_back(cpu);
+    }
+    if(!domain.cpus.empty())
+      result.push_back(domain);
+  }
+#endif
+  return result;
+}
+
+bool numa_prefer_node(void *ptr, std::size_t bytes, const numa_domain &domain) {
+  return set_memory_policy(ptr, bytes, mpol_preferred, {domain});
+}
+
+bool numa_interleave(void *ptr, std::size_t bytes,
+                     const std::vector<numa_domain> &domains) {
+  return set_memory_policy(ptr, bytes, mpol_interleave, domains);
+}
+
+}
+}
@@ -33,11 +33,13 @@
 #include "hipSYCL/runtime/inorder_queue.hpp"
 #include "hipSYCL/runtime/instrumentation.hpp"
 #include "hipSYCL/runtime/omp/omp_event.hpp"
+#include "hipSYCL/runtime/omp/omp_hardware_manager.hpp"
 #include "hipSYCL/runtime/application.hpp"
 #include "hipSYCL/runtime/error.hpp"
 #include "hipSYCL/runtime/kernel_launcher.hpp"
 #include "hipSYCL/runtime/operations.hpp"
 #include "hipSYCL/runtime/queue_completion_event.hpp"
+#include "hipSYCL/runtime/batch_completion_event.hpp"
 #include "hipSYCL/runtime/signal_channel.hpp"
 
 #include <memory>
@@ -172,8 +174,9 @@ private:
 }
 
 
-omp_queue::omp_queue(backend_id id)
-: _backend_id(id) {}
+omp_queue::omp_queue(device_id dev, host_thread_pool *thread_pool)
+: _backend_id(dev.get_backend()), _dev{dev}, _thread_pool{thread_pool},
+  _sub_group_size{get_omp_sub_group_size()} {}
 
 omp_queue::~omp_queue() {
   _worker.halt();
@@ -198,6 +201,11 @@ std::shared_ptr<dag_node_event> omp_queue::create_queue_completion_event() {
       this);
 }
 
+std::shared_ptr<dag_node_event> omp_queue::create_batch_completion_event() {
+  return std::make_shared<
+      batch_completion_event<std::shared_ptr<signal_channel>>>(this);
+}
+
 
 result omp_queue::submit_memcpy(memcpy_operation &op, dag_node_ptr node) {
   HIPSYCL_DEBUG_INFO << "omp_queue: Submitting memcpy operation..." << std::endl;
@@ -310,6 +318,8 @@ result omp_queue::submit_kernel(kernel_operation &op, dag_node_ptr node) {
   }
 
   
+  launcher->set_params(this);
+
   rt::dag_node* node_ptr = node.get();
   const glue::kernel_configuration *config =
       &(op.get_launcher().get_kernel_configuration());
@@ -416,8 +426,7 @@ result omp_queue::submit_external_wait_for(dag_node_ptr node) {
 worker_thread &omp_queue::get_worker() { return _worker; }
 
 device_id omp_queue::get_device() const {
-  return device_id{
-      backend_descriptor{hardware_platform::cpu, api_platform::omp}, 0};
+  return _dev;
 }
 
 void *omp_queue::get_native_type() const {
@@ -0,0 +1,351 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "hipSYCL/runtime/persistent_kernel_cache.hpp"
+#include "hipSYCL/runtime/application.hpp"
+#include "hipSYCL/runtime/settings.hpp"
+#include "hipSYCL/common/config.hpp"
+#include "hipSYCL/common/debug.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include HIPSYCL_CXX_FILESYSTEM_HEADER
+namespace fs = HIPSYCL_CXX_FILESYSTEM_NAMESPACE;
+
+namespace hipsycl {
+namespace rt {
+
+namespace {
+
+constexpr const char entry_magic[] = "ACPPJIT1";
+constexpr std::size_t entry_magic_size = sizeof(entry_magic) - 1;
+constexpr const char entry_extension[] = ".acppjit";
+constexpr const char temporary_extension[] = ".tmp";
+// Temporary files older than this are assumed to have been left behind
+// by crashed writers. Younger ones may still be written to.
+constexpr auto stale_temporary_age = std::chrono::hours{1};
+
+bool ends_with(const std::string &s, const char *suffix) {
+  std::size_t suffix_size = std::strlen(suffix);
+  return s.size() >= suffix_size &&
+         s.compare(s.size() - suffix_size, suffix_size, suffix) == 0;
+}
+
+enum class read_result { hit, missing, invalid };
+
+// Entry layout:
+// magic | uint64 key size | key | uint64 payload size | payload
+// The file name is derived from the key, so the stored key cannot detect
+// hash collisions. It does however detect files that were corrupted
+// or copied under a different name.
+read_result read_entry(const std::string &path, const std::string &expected_key,
+                       std::string &out) {
+  std::ifstream file{path, std::ios::binary};
+  if(!file.is_open())
+    return read_result::missing;
+
+  file.seekg(0, std::ios::end);
+  std::streamoff file_size = file.tellg();
+  file.seekg(0, std::ios::beg);
+  if(!file || file_size < 0)
+    return read_result::invalid;
+
+  char magic[entry_magic_size];
+  if(!file.read(magic, entry_magic_size) ||
+     std::memcmp(magic, entry_magic, entry_magic_size) != 0)
+    return read_result::invalid;
+
+  std::uint64_t key_size = 0;
+  if(!file.read(reinterpret_cast<char *>(&key_size), sizeof(key_size)) ||
+     key_size != expected_key.size())
+    return read_result::invalid;
+
+  std::string key(key_size, '\0');
+  if(!file.read(key.data(), key_size) || key != expected_key)
+    return read_result::invalid;
+
+  std::uint64_t payload_size = 0;
+  if(!file.read(reinterpret_cast<char *>(&payload_size), sizeof(payload_size)))
+    return read_result::invalid;
+
+  // Never trust the stored size for the allocation - a corrupt entry
+  // must not turn into a std::bad_alloc or std::length_error.
+  std::streamoff payload_offset = file.tellg();
+  if(payload_offset < 0 ||
+     payload_size != static_cast<std::uint64_t>(file_size - payload_offset))
+    return read_result::invalid;
+
+  std::string payload(payload_size, '\0');
+  if(!file.read(payload.data(), payload_size))
+    return read_result::invalid;
+
+  out = std::move(payload);
+  return read_result::hit;
+}
+
+bool write_entry(const std::string &path, const std::string &key,
+                 const std::string &data) {
+  std::ofstream file{path, std::ios::binary | std::ios::trunc};
+  if(!file.is_open())
+    return false;
+
+  std::uint64_t key_size = key.size();
+  std::uint64_t payload_size = data.size();
+
+  file.write(entry_magic, entry_magic_size);
+  file.write(reinterpret_cast<const char *>(&key_size), sizeof(key_size));
+  file.write(key.data(), key.size());
+  file.write(reinterpret_cast<const char *>(&payload_size), sizeof(payload_size));
+  file.write(data.data(), data.size());
+  file.flush();
+
+  return static_cast<bool>(file);
+}
+
+std::string generate_temporary_suffix() {
+  static thread_local std::mt19937_64 rng{std::random_device{}()};
+  std::stringstream sstr;
+  sstr << temporary_extension << std::hex << rng();
+  return sstr.str();
+}
+
+}
+
+std::string persistent_kernel_cache::key_builder::get_key() const {
+  // Results from different AdaptiveCpp versions must never be mixed
+  key_builder versioned = *this;
+  versioned(std::string{"acpp-" + std::to_string(ACPP_VERSION_MAJOR) + "." +
+                        std::to_string(ACPP_VERSION_MINOR) + "." +
+                        std::to_string(ACPP_VERSION_PATCH) +
+                        ACPP_VERSION_SUFFIX});
+
+  std::stringstream sstr;
+  sstr << std::hex << std::setfill('0') << std::setw(16)
+       << versioned._high.get_current_hash() << std::setw(16)
+       << versioned._low.get_current_hash();
+  return sstr.str();
+}
+
+persistent_kernel_cache& persistent_kernel_cache::get() {
+  static persistent_kernel_cache c;
+  return c;
+}
+
+persistent_kernel_cache::persistent_kernel_cache()
+    : persistent_kernel_cache{
+          application::get_settings().get<setting::sscp_jit_cache_directory>(),
+          application::get_settings().get<setting::sscp_jit_cache_max_size>() *
+              1024 * 1024} {}
+
+persistent_kernel_cache::persistent_kernel_cache(const std::string &directory,
+                                                 std::size_t max_size)
+    : _directory{directory}, _max_size{max_size}, _is_enabled{false},
+      _num_hits{0}, _num_misses{0} {
+
+  if(_directory.empty() || _max_size == 0)
+    return;
+
+  std::error_code ec;
+  fs::create_directories(_directory, ec);
+  if(ec || !fs::is_directory(_directory, ec)) {
+    HIPSYCL_DEBUG_WARNING << "persistent_kernel_cache: Could not create cache "
+                             "directory "
+                          << _directory << ", disabling persistent JIT cache."
+                          << std::endl;
+    return;
+  }
+
+  HIPSYCL_DEBUG_INFO << "persistent_kernel_cache: Using cache directory "
+                     << _directory << " with a maximum size of " << _max_size
+                     << " bytes" << std::endl;
+  _is_enabled = true;
+}
+
+bool persistent_kernel_cache::is_enabled() const {
+  return _is_enabled;
+}
+
+std::string
+persistent_kernel_cache::get_entry_path(const std::string &key) const {
+  return (fs::path{_directory} / (key + entry_extension)).string();
+}
+
+bool persistent_kernel_cache::retrieve(const std::string &key,
+                                       std::string &out) {
+  if(!_is_enabled)
+    return false;
+
+  std::string path = get_entry_path(key);
+  read_result result = read_entry(path, key, out);
+  if(result == read_result::hit) {
+    std::size_t num_hits = ++_num_hits;
+    // Mark entry as recently used for LRU eviction
+    std::error_code ec;
+    fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+
+    HIPSYCL_DEBUG_INFO << "persistent_kernel_cache: Cache hit for entry " << key
+                       << " (" << num_hits << " hits, " << _num_misses.load()
+                       << " misses)" << std::endl;
+    return true;
+  }
+
+  if(result == read_result::invalid) {
+    HIPSYCL_DEBUG_WARNING << "persistent_kernel_cache: Removing invalid entry "
+                          << path << std::endl;
+    std::error_code ec;
+    fs::remove(path, ec);
+  }
+
+  std::size_t num_misses = ++_num_misses;
+  HIPSYCL_DEBUG_INFO << "persistent_kernel_cache: Cache miss for entry " << key
+                     << " (" << _num_hits.load() << " hits, " << num_misses
+                     << " misses)" << std::endl;
+  return false;
+}
+
+void persistent_kernel_cache::store(const std::string &key,
+                                    const std::string &data) {
+  if(!_is_enabled)
+    return;
+
+  std::string path = get_entry_path(key);
+  // Write to a temporary file first and then rename it, so that other
+  // processes never observe partially written entries.
+  std::string temporary_path = path + generate_temporary_suffix();
+
+  std::error_code ec;
+  if(!write_entry(temporary_path, key, data)) {
+    HIPSYCL_DEBUG_WARNING << "persistent_kernel_cache: Could not write "
+                          << temporary_path << std::endl;
+    fs::remove(temporary_path, ec);
+    return;
+  }
+
+  fs::rename(temporary_path, path, ec);
+  if(ec) {
+    HIPSYCL_DEBUG_WARNING << "persistent_kernel_cache: Could not move "
+                          << temporary_path << " to " << path << ": "
+                          << ec.message() << std::endl;
+    fs::remove(temporary_path, ec);
+    return;
+  }
+
+  HIPSYCL_DEBUG_INFO << "persistent_kernel_cache: Stored entry " << key << " ("
+                     << data.size() << " bytes)" << std::endl;
+
+  evict_entries();
+}
+
+void persistent_kernel_cache::evict_entries() {
+  std::lock_guard<std::mutex> lock{_eviction_mutex};
+
+  struct entry {
+    fs::path path;
+    fs::file_time_type last_use;
+    std::uintmax_t size;
+  };
+
+  std::vector<entry> entries;
+  std::uintmax_t total_size = 0;
+  const fs::file_time_type now = fs::file_time_type::clock::now();
+
+  std::error_code ec;
+  for (fs::directory_iterator it{_directory, ec}, end; !ec && it != end;
+       it.increment(ec)) {
+    std::error_code entry_ec;
+    if(!fs::is_regular_file(it->status(entry_ec)) || entry_ec)
+      continue;
+
+    const std::string filename = it->path().filename().string();
+    std::size_t extension_pos = filename.find(entry_extension);
+    if(extension_pos == std::string::npos)
+      continue;
+
+    fs::file_time_type last_use = fs::last_write_time(it->path(), entry_ec);
+    if(entry_ec)
+      continue;
+
+    if(!ends_with(filename, entry_extension)) {
+      // Temporary files may belong to a store() in progress in another
+      // process, so only remove those that have been abandoned.
+      if (filename.compare(extension_pos + std::strlen(entry_extension),
+                           std::strlen(temporary_extension),
+                           temporary_extension) == 0 &&
+          now - last_use > stale_temporary_age) {
+        if(fs::remove(it->path(), entry_ec)) {
+          HIPSYCL_DEBUG_INFO << "persistent_kernel_cache: Removed stale "
+                             << it->path().string() << std::endl;
+        }
+      }
+      continue;
+    }
+
+    std::uintmax_t size = fs::file_size(it->path(), entry_ec);
+    if(entry_ec)
+      continue;
+
+    entries.push_back(entry{it->path(), last_use, size});
+    total_size += size;
+  }
+
+  if(total_size <= _max_size)
+    return;
+
+  std::sort(entries.begin(), entries.end(),
+            [](const entry &a, const entry &b) {
+              return a.last_use < b.last_use;
+            });
+
+  for(const auto& e : entries) {
+    if(total_size <= _max_size)
+      break;
+    // Other processes might remove the same entry concurrently,
+    // so we cannot rely on the removal succeeding.
+    if(fs::remove(e.path, ec)) {
+      HIPSYCL_DEBUG_INFO << "persistent_kernel_cache: Evicted "
+                         << e.path.string() << std::endl;
+    }
+    total_size -= std::min(total_size, e.size);
+  }
+}
+
+std::size_t persistent_kernel_cache::get_num_hits() const {
+  return _num_hits.load();
+}
+
+std::size_t persistent_kernel_cache::get_num_misses() const {
+  return _num_misses.load();
+}
+
+}
+}
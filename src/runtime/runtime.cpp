@@ -26,6 +26,7 @@
  */
 
 #include "hipSYCL/runtime/runtime.hpp"
+#include "hipSYCL/runtime/tracing.hpp"
 #include "hipSYCL/common/debug.hpp"
 
 namespace hipsycl {
@@ -34,6 +35,10 @@ namespace rt {
 runtime::runtime()
 : _dag_manager{this}
 {
+  // Initializing the tracer before the runtime is fully constructed makes
+  // sure that it outlives the runtime, so that nodes destroyed during
+  // runtime shutdown are still recorded.
+  tracing::initialize();
   HIPSYCL_DEBUG_INFO << "runtime: ******* rt launch initiated ********"
                       << std::endl;
 }
@@ -47,6 +47,44 @@ std::istream &operator>>(std::istream &istr, scheduler_type &out) {
   return istr;
 }
 
+std::istream &operator>>(std::istream &istr, placement_strategy &out) {
+  std::string str;
+  istr >> str;
+  if (str == "cost_model")
+    out = placement_strategy::cost_model;
+  else if (str == "round_robin")
+    out = placement_strategy::round_robin;
+  else
+    istr.setstate(std::ios_base::failbit);
+  return istr;
+}
+
+std::istream &operator>>(std::istream &istr, omp_schedule_type &out) {
+  std::string str;
+  istr >> str;
+  if (str == "static")
+    out = omp_schedule_type::static_schedule;
+  else if (str == "work_stealing")
+    out = omp_schedule_type::work_stealing;
+  else
+    istr.setstate(std::ios_base::failbit);
+  return istr;
+}
+
+std::istream &operator>>(std::istream &istr, omp_numa_placement &out) {
+  std::string str;
+  istr >> str;
+  if (str == "none")
+    out = omp_numa_placement::none;
+  else if (str == "interleave")
+    out = omp_numa_placement::interleave;
+  else if (str == "first_touch")
+    out = omp_numa_placement::first_touch;
+  else
+    istr.setstate(std::ios_base::failbit);
+  return istr;
+}
+
 namespace {
 
 void trim(std::string& str) {
@@ -0,0 +1,70 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+
+#include "hipSYCL/runtime/submission_batch.hpp"
+#include "hipSYCL/runtime/executor.hpp"
+
+namespace hipsycl {
+namespace rt {
+
+namespace {
+
+submission_batch*& current_batch() {
+  static thread_local submission_batch* batch = nullptr;
+  return batch;
+}
+
+}
+
+submission_batch::submission_batch()
+: _is_outermost{current_batch() == nullptr} {
+  if(_is_outermost)
+    current_batch() = this;
+}
+
+submission_batch::~submission_batch() {
+  if(_is_outermost) {
+    current_batch() = nullptr;
+    for(backend_executor* executor : _executors)
+      executor->finalize_submission_batch();
+  }
+}
+
+void submission_batch::register_executor(backend_executor *executor) {
+  if(std::find(_executors.begin(), _executors.end(), executor) ==
+     _executors.end())
+    _executors.push_back(executor);
+}
+
+submission_batch* submission_batch::get_current() {
+  return current_batch();
+}
+
+}
+}
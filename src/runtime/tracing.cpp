@@ -0,0 +1,467 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "hipSYCL/common/debug.hpp"
+#include "hipSYCL/runtime/tracing.hpp"
+#include "hipSYCL/runtime/application.hpp"
+#include "hipSYCL/runtime/dag_node.hpp"
+#include "hipSYCL/runtime/instrumentation.hpp"
+#include "hipSYCL/runtime/operations.hpp"
+#include "hipSYCL/runtime/settings.hpp"
+#include "hipSYCL/runtime/serialization/serialization.hpp"
+
+namespace hipsycl {
+namespace rt {
+namespace tracing {
+
+namespace {
+
+enum class event_type {
+  build,
+  requirement_resolution,
+  lane_assignment,
+  submission,
+  migration,
+  execution
+};
+
+struct event {
+  event_type type;
+  std::uint64_t node_id;
+  // In profiler_clock ticks; begin == end for instant events
+  std::uint64_t begin;
+  std::uint64_t end;
+  // Execution lane and its device for lane assignment and execution
+  // events, destination device for migrations
+  const void* lane;
+  device_id dev;
+  // Only for migrations
+  device_id source_dev;
+  std::size_t num_bytes;
+  // Operation name for build and execution events
+  std::string label;
+};
+
+// Holds the most recent events of one thread. Once the capacity is
+// reached, the oldest events are overwritten. Slots are reused, so that
+// after the buffer has filled up, recording an event does not allocate
+// unless a label is longer than any label stored in the slot before.
+class event_buffer {
+public:
+  event_buffer(std::size_t capacity, int thread_index)
+  : _capacity{std::max(capacity, std::size_t{1})}, _num_recorded{0},
+    _thread_index{thread_index} {}
+
+  // The lock is only contended while the trace is written.
+  template<class F>
+  void record(F&& initialize_event) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    if(_events.size() < _capacity)
+      _events.emplace_back();
+    event& e = _events[_num_recorded % _capacity];
+    e.lane = nullptr;
+    e.num_bytes = 0;
+    e.label.clear();
+    initialize_event(e);
+    ++_num_recorded;
+  }
+
+  template<class F>
+  void for_each_event(F&& f) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    for(const event& e : _events)
+      f(e);
+  }
+
+  std::size_t get_num_dropped_events() {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _num_recorded - _events.size();
+  }
+
+  int get_thread_index() const {
+    return _thread_index;
+  }
+private:
+  std::mutex _mutex;
+  std::vector<event> _events;
+  std::size_t _capacity;
+  std::size_t _num_recorded;
+  int _thread_index;
+};
+
+std::atomic<bool> trace_enabled{false};
+std::atomic<std::uint64_t> node_counter{0};
+thread_local event_buffer* thread_buffer = nullptr;
+
+const char* get_event_name(event_type t) {
+  switch(t) {
+  case event_type::build:
+    return "build";
+  case event_type::requirement_resolution:
+    return "resolve requirements";
+  case event_type::lane_assignment:
+    return "assign lane";
+  case event_type::submission:
+    return "submit";
+  case event_type::migration:
+    return "migration";
+  case event_type::execution:
+    return "execute";
+  }
+  return "<unknown>";
+}
+
+const std::string& get_operation_label(const operation* op) {
+  static const std::string memcpy_label = "memcpy";
+  static const std::string prefetch_label = "prefetch";
+  static const std::string memset_label = "memset";
+  static const std::string requirement_label = "requirement";
+  static const std::string other_label = "operation";
+
+  if(auto* kernel_op = dynamic_cast<const kernel_operation*>(op))
+    return kernel_op->get_global_kernel_name();
+  if(dynamic_cast<const memcpy_operation*>(op))
+    return memcpy_label;
+  if(dynamic_cast<const prefetch_operation*>(op))
+    return prefetch_label;
+  if(dynamic_cast<const memset_operation*>(op))
+    return memset_label;
+  if(op && op->is_requirement())
+    return requirement_label;
+  return other_label;
+}
+
+std::string get_device_name(device_id dev) {
+  std::stringstream sstr;
+  sstr << dev.get_backend() << " device " << dev.get_id();
+  return sstr.str();
+}
+
+void write_json_string(std::ostream& ostr, const std::string& str) {
+  ostr << '"';
+  for(char c : str) {
+    if(c == '"' || c == '\\')
+      ostr << '\\' << c;
+    else if(static_cast<unsigned char>(c) < 0x20)
+      ostr << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+           << static_cast<int>(c) << std::dec << std::setfill(' ');
+    else
+      ostr << c;
+  }
+  ostr << '"';
+}
+
+class tracer {
+public:
+  static tracer& get() {
+    static tracer t;
+    return t;
+  }
+
+  ~tracer() {
+    if(trace_enabled.exchange(false))
+      write();
+  }
+
+  event_buffer& get_thread_buffer() {
+    if(!thread_buffer) {
+      std::lock_guard<std::mutex> lock{_mutex};
+      _buffers.push_back(std::make_unique<event_buffer>(
+          _buffer_size, static_cast<int>(_buffers.size()) + 1));
+      thread_buffer = _buffers.back().get();
+    }
+    return *thread_buffer;
+  }
+private:
+  // Thread ids of the lane tracks start here, so that they cannot
+  // collide with the ids of runtime threads
+  static constexpr int lane_track_offset = 1 << 20;
+
+  tracer()
+  : _output_file{application::get_settings().get<setting::trace_file>()},
+    _buffer_size{application::get_settings().get<setting::trace_buffer_size>()} {
+    if(!_output_file.empty()) {
+      HIPSYCL_DEBUG_INFO << "tracing: Recording trace to " << _output_file
+                         << std::endl;
+      trace_enabled = true;
+    }
+  }
+
+  void write() {
+    std::ofstream ostr{_output_file, std::ios::trunc};
+    if(!ostr.is_open()) {
+      HIPSYCL_DEBUG_ERROR << "tracing: Could not open trace file "
+                          << _output_file << std::endl;
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    std::vector<std::pair<int, event>> events;
+    std::size_t num_dropped_events = 0;
+    for(auto& buff : _buffers) {
+      buff->for_each_event([&](const event& e) {
+        events.push_back(std::make_pair(buff->get_thread_index(), e));
+      });
+      num_dropped_events += buff->get_num_dropped_events();
+    }
+    if(num_dropped_events > 0) {
+      HIPSYCL_DEBUG_WARNING
+          << "tracing: " << num_dropped_events
+          << " events were dropped because the per-thread buffers were full; "
+             "consider increasing ACPP_RT_TRACE_BUFFER_SIZE."
+          << std::endl;
+    }
+
+    std::stable_sort(events.begin(), events.end(),
+                     [](const auto& a, const auto& b) {
+                       return a.second.begin < b.second.begin;
+                     });
+
+    std::uint64_t t0 = events.empty() ? 0 : events.front().second.begin;
+
+    std::unordered_map<std::uint64_t, std::string> node_labels;
+    std::unordered_map<const void*, int> lane_tracks;
+    std::vector<device_id> lane_devices;
+    for(const auto& entry : events) {
+      const event& e = entry.second;
+      if(e.type == event_type::build ||
+         (e.type == event_type::execution && !node_labels.count(e.node_id)))
+        node_labels[e.node_id] = e.label;
+      if(e.lane && !lane_tracks.count(e.lane)) {
+        lane_tracks[e.lane] = static_cast<int>(lane_devices.size());
+        lane_devices.push_back(e.dev);
+      }
+    }
+
+    // Trace event timestamps and durations are in microseconds
+    auto write_microseconds = [&](std::uint64_t ticks) {
+      ostr << std::fixed << std::setprecision(3)
+           << static_cast<double>(ticks) / 1.e3;
+    };
+
+    ostr << "{\"displayTimeUnit\":\"ns\",\"otherData\":{\"dropped_events\":"
+         << num_dropped_events << "},\"traceEvents\":[\n";
+    ostr << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,"
+            "\"args\":{\"name\":\"AdaptiveCpp runtime\"}}";
+    for(const auto& buff : _buffers)
+      ostr << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+           << buff->get_thread_index() << ",\"args\":{\"name\":\"thread "
+           << buff->get_thread_index() << "\"}}";
+    // Lanes are numbered per device
+    std::vector<std::string> lane_names;
+    for(std::size_t i = 0; i < lane_devices.size(); ++i) {
+      int lane_index = 0;
+      for(std::size_t j = 0; j < i; ++j)
+        if(lane_devices[j] == lane_devices[i])
+          ++lane_index;
+      lane_names.push_back(get_device_name(lane_devices[i]) + " lane " +
+                           std::to_string(lane_index));
+      ostr << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+           << lane_track_offset + i << ",\"args\":{\"name\":";
+      write_json_string(ostr, lane_names.back());
+      ostr << "}}";
+    }
+
+    for(const auto& entry : events) {
+      const event& e = entry.second;
+      int tid = entry.first;
+      if(e.type == event_type::execution)
+        tid = lane_track_offset + lane_tracks[e.lane];
+
+      const char* name = get_event_name(e.type);
+      std::string label;
+      auto label_it = node_labels.find(e.node_id);
+      if(label_it != node_labels.end())
+        label = label_it->second;
+
+      ostr << ",\n{\"name\":";
+      write_json_string(ostr, e.type == event_type::execution ? e.label
+                                                              : name);
+      ostr << ",\"cat\":\"" << name << "\",\"pid\":1,\"tid\":" << tid
+           << ",\"ts\":";
+      write_microseconds(e.begin - t0);
+      if(e.type == event_type::lane_assignment ||
+         e.type == event_type::migration) {
+        ostr << ",\"ph\":\"i\",\"s\":\"t\"";
+      } else {
+        ostr << ",\"ph\":\"X\",\"dur\":";
+        write_microseconds(e.end - std::min(e.end, e.begin));
+      }
+      ostr << ",\"args\":{\"node\":" << e.node_id << ",\"operation\":";
+      write_json_string(ostr, label);
+      if(e.type == event_type::lane_assignment) {
+        ostr << ",\"lane\":";
+        write_json_string(ostr, lane_names[lane_tracks[e.lane]]);
+      } else if(e.type == event_type::migration) {
+        ostr << ",\"from\":";
+        write_json_string(ostr, get_device_name(e.source_dev));
+        ostr << ",\"to\":";
+        write_json_string(ostr, get_device_name(e.dev));
+        ostr << ",\"bytes\":" << e.num_bytes;
+      }
+      ostr << "}}";
+
+      // Flow arrows from submission to execution of a node
+      if(e.type == event_type::submission ||
+         e.type == event_type::execution) {
+        ostr << ",\n{\"name\":\"node\",\"cat\":\"node\",\"id\":" << e.node_id
+             << ",\"pid\":1,\"tid\":" << tid << ",\"ts\":";
+        write_microseconds(e.begin - t0);
+        if(e.type == event_type::submission)
+          ostr << ",\"ph\":\"s\"}";
+        else
+          ostr << ",\"ph\":\"f\",\"bp\":\"e\"}";
+      }
+    }
+    ostr << "\n]}\n";
+  }
+
+  std::string _output_file;
+  std::size_t _buffer_size;
+  std::mutex _mutex;
+  std::vector<std::unique_ptr<event_buffer>> _buffers;
+};
+
+template<class F>
+void record(F&& initialize_event) {
+  tracer::get().get_thread_buffer().record(initialize_event);
+}
+
+}
+
+void initialize() {
+  tracer::get();
+}
+
+bool is_enabled() {
+  return trace_enabled.load(std::memory_order_relaxed);
+}
+
+std::uint64_t make_node_id() {
+  return ++node_counter;
+}
+
+std::uint64_t now() {
+  return profiler_clock::ns_ticks(profiler_clock::now());
+}
+
+void record_build(const dag_node *node, std::uint64_t begin) {
+  std::uint64_t end = now();
+  record([&](event& e) {
+    e.type = event_type::build;
+    e.node_id = node->get_node_id();
+    e.begin = begin;
+    e.end = end;
+    e.label = get_operation_label(node->get_operation());
+  });
+}
+
+void record_requirement_resolution(const dag_node *node, std::uint64_t begin) {
+  std::uint64_t end = now();
+  record([&](event& e) {
+    e.type = event_type::requirement_resolution;
+    e.node_id = node->get_node_id();
+    e.begin = begin;
+    e.end = end;
+  });
+}
+
+void record_lane_assignment(const dag_node *node, device_id dev,
+                            const void *lane) {
+  std::uint64_t t = now();
+  record([&](event& e) {
+    e.type = event_type::lane_assignment;
+    e.node_id = node->get_node_id();
+    e.begin = t;
+    e.end = t;
+    e.lane = lane;
+    e.dev = dev;
+  });
+}
+
+void record_submission(const dag_node *node, std::uint64_t begin) {
+  std::uint64_t end = now();
+  record([&](event& e) {
+    e.type = event_type::submission;
+    e.node_id = node->get_node_id();
+    e.begin = begin;
+    e.end = end;
+  });
+}
+
+void record_migration(const dag_node *node, const memcpy_operation &op) {
+  std::uint64_t t = now();
+  record([&](event& e) {
+    e.type = event_type::migration;
+    e.node_id = node->get_node_id();
+    e.begin = t;
+    e.end = t;
+    e.dev = op.dest().get_device();
+    e.source_dev = op.source().get_device();
+    e.num_bytes = op.get_num_transferred_bytes();
+  });
+}
+
+void record_execution(dag_node *node) {
+  if(!node->is_submitted() || node->is_virtual() || node->is_cancelled() ||
+     !node->get_assigned_execution_lane() || !node->is_complete())
+    return;
+
+  node->for_each_executed_operation([&](operation* op) {
+    const instrumentation_set& instr = op->get_instrumentations();
+    auto start = instr.get<instrumentations::execution_start_timestamp>();
+    auto finish = instr.get<instrumentations::execution_finish_timestamp>();
+    if(!start || !finish)
+      return;
+
+    record([&](event& e) {
+      e.type = event_type::execution;
+      e.node_id = node->get_node_id();
+      e.begin = profiler_clock::ns_ticks(start->get_time_point());
+      e.end = profiler_clock::ns_ticks(finish->get_time_point());
+      e.lane = node->get_assigned_execution_lane();
+      e.dev = node->get_assigned_device();
+      e.label = get_operation_label(op);
+    });
+  });
+}
+
+}
+}
+}
@@ -65,6 +65,13 @@ ze_backend::ze_backend() {
         static_cast<ze_hardware_context *>(_hardware_manager->get_device(i)),
         _hardware_manager.get()});
   }
+  for(std::size_t i = 0; i < _allocators.size(); ++i) {
+    auto caching_alloc = caching_allocator::create_if_enabled(
+        &_allocators[i], _hardware_manager->get_device_id(i));
+    if(!caching_alloc)
+      break;
+    _caching_allocators.push_back(std::move(caching_alloc));
+  }
 
   _executor = std::make_unique<multi_queue_executor>(
       *this, [this](device_id dev) {
@@ -96,6 +103,9 @@ backend_executor* ze_backend::get_executor(device_id dev) const {
 backend_allocator *ze_backend::get_allocator(device_id dev) const {
   assert(dev.get_id() < _allocators.size());
 
+  if(dev.get_id() < _caching_allocators.size())
+    return _caching_allocators[dev.get_id()].get();
+
   return &(_allocators[dev.get_id()]);
 }
 
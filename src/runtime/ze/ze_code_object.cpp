@@ -75,6 +75,17 @@ result ze_sscp_code_object_invoker::submit_kernel(
       arg_sizes, num_args, config);
 }
 
+bool ze_sscp_code_object_invoker::prepare_kernel(
+    const kernel_operation &op, hcf_object_id hcf_object,
+    const std::string &kernel_name, unsigned int local_mem_size,
+    const glue::kernel_configuration &config) {
+
+  assert(_queue);
+
+  return _queue->prepare_sscp_kernel(op, hcf_object, kernel_name,
+                                     local_mem_size, config);
+}
+
 ze_executable_object::ze_executable_object(ze_context_handle_t ctx,
                                            ze_device_handle_t dev,
                                            hcf_object_id source,
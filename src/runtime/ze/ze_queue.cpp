@@ -39,12 +39,14 @@
 #include "hipSYCL/runtime/event.hpp"
 #include "hipSYCL/runtime/hints.hpp"
 #include "hipSYCL/runtime/inorder_queue.hpp"
+#include "hipSYCL/runtime/kernel_argument_tracker.hpp"
 #include "hipSYCL/runtime/ze/ze_code_object.hpp"
 #include "hipSYCL/runtime/ze/ze_queue.hpp"
 #include "hipSYCL/runtime/ze/ze_hardware_manager.hpp"
 #include "hipSYCL/runtime/ze/ze_event.hpp"
 #include "hipSYCL/runtime/util.hpp"
 #include "hipSYCL/runtime/queue_completion_event.hpp"
+#include "hipSYCL/runtime/batch_completion_event.hpp"
 
 #ifdef HIPSYCL_WITH_SSCP_COMPILER
 
@@ -234,6 +236,10 @@ std::shared_ptr<dag_node_event> ze_queue::create_queue_completion_event() {
       this);
 }
 
+std::shared_ptr<dag_node_event> ze_queue::create_batch_completion_event() {
+  return std::make_shared<batch_completion_event<ze_event_handle_t>>(this);
+}
+
 
 std::shared_ptr<dag_node_event> ze_queue::insert_event() {
   std::lock_guard<std::mutex> lock{_mutex};
@@ -330,6 +336,21 @@ result ze_queue::submit_kernel(kernel_operation& op, dag_node_ptr node) {
   return make_success();
 }
 
+bool ze_queue::prepare_kernel(kernel_operation &op, dag_node_ptr node) {
+  rt::backend_kernel_launcher *l =
+      op.get_launcher().find_launcher(backend_id::level_zero);
+  if (!l)
+    // Error is reported by submit_kernel()
+    return true;
+
+  rt::backend_kernel_launch_capabilities cap;
+  cap.provide_multipass_invoker(&_multipass_code_object_invoker);
+  cap.provide_sscp_invoker(&_sscp_code_object_invoker);
+  l->set_backend_capabilities(cap);
+
+  return l->prepare(node.get(), op.get_launcher().get_kernel_configuration());
+}
+
 result ze_queue::submit_prefetch(prefetch_operation &, dag_node_ptr node) {
   return make_success();
 }
@@ -548,12 +569,12 @@ result ze_queue::submit_multipass_kernel_from_code_object(
   return make_success();
 }
 
-result ze_queue::submit_sscp_kernel_from_code_object(
-      const kernel_operation &op, hcf_object_id hcf_object,
-      const std::string &kernel_name, const rt::range<3> &num_groups,
-      const rt::range<3> &group_size, unsigned local_mem_size, void **args,
-      std::size_t *arg_sizes, std::size_t num_args,
-      const glue::kernel_configuration &initial_config) {
+result ze_queue::request_sscp_code_object(
+    const kernel_operation &op, hcf_object_id hcf_object,
+    const std::string &kernel_name, unsigned local_mem_size,
+    const glue::kernel_configuration &initial_config,
+    kernel_cache::code_object_future &code_object_out,
+    const hcf_kernel_info *&kernel_info_out) {
 
 #ifdef HIPSYCL_WITH_SSCP_COMPILER
 
@@ -587,6 +608,7 @@ result ze_queue::submit_sscp_kernel_from_code_object(
         error_info{"ze_queue: Could not obtain hcf kernel info for kernel " +
             global_kernel_name});
   }
+  kernel_info_out = kernel_info;
 
   auto code_object_selector = [&](const code_object *candidate) -> bool {
     if ((candidate->managing_backend() != backend_id::level_zero) ||
@@ -600,15 +622,21 @@ result ze_queue::submit_sscp_kernel_from_code_object(
     if(obj->configuration_id() != configuration_id)
       return false;
 
+    // Objects may only contain some of the kernels of the image
+    if(!obj->contains(kernel_name))
+      return false;
+
     return obj->get_ze_device() == dev && obj->get_ze_context() == ctx;
   };
 
-  auto code_object_constructor = [&]() -> code_object* {
+  std::vector<std::string> kernel_names;
+  std::string selected_image_name = glue::jit::select_image_and_kernels(
+      kernel_info, kernel_name, config, kernel_names);
+
+  // Runs on a JIT compilation thread, so everything needs to be
+  // captured by value.
+  auto code_object_constructor = [=]() -> code_object* {
     const common::hcf_container* hcf = rt::hcf_cache::get().get_hcf(hcf_object);
-    
-    std::vector<std::string> kernel_names;
-    std::string selected_image_name =
-        glue::jit::select_image(kernel_info, &kernel_names);
 
     // Construct SPIR-V translator to compile the specified kernels
     std::unique_ptr<compiler::LLVMToBackendTranslator> translator = 
@@ -626,7 +654,8 @@ result ze_queue::submit_sscp_kernel_from_code_object(
         hcf, selected_image_name, config, compiled_image);
     
     if(!err.is_success()) {
-      register_error(err);
+      kernel_argument_tracker::get().report_failed_compilation(
+          hcf_object, kernel_name, initial_config, err);
       return nullptr;
     }
 
@@ -635,7 +664,8 @@ result ze_queue::submit_sscp_kernel_from_code_object(
     result r = exec_obj->get_build_result();
 
     if(!r.is_success()) {
-      register_error(r);
+      kernel_argument_tracker::get().report_failed_compilation(
+          hcf_object, kernel_name, initial_config, r);
       delete exec_obj;
       return nullptr;
     }
@@ -643,10 +673,91 @@ result ze_queue::submit_sscp_kernel_from_code_object(
     return exec_obj;
   };
 
-  const code_object *obj = _kernel_cache->get_or_construct_code_object(
+  code_object_out = _kernel_cache->get_or_construct_code_object_async(
       *kidx, kernel_name, backend_id::level_zero, hcf_object,
+      kernel_cache::make_construction_key(backend_id::level_zero,
+                                          _device_index, hcf_object,
+                                          selected_image_name,
+                                          kernel_names, configuration_id),
       code_object_selector, code_object_constructor);
 
+  return make_success();
+#else
+  return make_error(
+      __hipsycl_here(),
+      error_info{"ze_queue: SSCP kernel launch was requested, but hipSYCL was "
+                 "not built with Level Zero SSCP support."});
+#endif
+}
+
+bool ze_queue::prepare_sscp_kernel(const kernel_operation &op,
+                                   hcf_object_id hcf_object,
+                                   const std::string &kernel_name,
+                                   unsigned local_mem_size,
+                                   const glue::kernel_configuration &config) {
+  kernel_cache::code_object_future pending_object;
+  const hcf_kernel_info *kernel_info = nullptr;
+  // Errors are reported when the kernel is submitted
+  if (!request_sscp_code_object(op, hcf_object, kernel_name, local_mem_size,
+                                config, pending_object, kernel_info)
+           .is_success())
+    return true;
+
+  return pending_object.wait_for(std::chrono::seconds{0}) ==
+         std::future_status::ready;
+}
+
+result ze_queue::submit_sscp_kernel_from_code_object(
+      const kernel_operation &op, hcf_object_id hcf_object,
+      const std::string &kernel_name, const rt::range<3> &num_groups,
+      const rt::range<3> &group_size, unsigned local_mem_size, void **args,
+      std::size_t *arg_sizes, std::size_t num_args,
+      const glue::kernel_configuration &initial_config) {
+
+#ifdef HIPSYCL_WITH_SSCP_COMPILER
+
+  kernel_cache::code_object_future pending_object;
+  const hcf_kernel_info *kernel_info = nullptr;
+  result request_res = request_sscp_code_object(
+      op, hcf_object, kernel_name, local_mem_size, initial_config,
+      pending_object, kernel_info);
+  if(!request_res.is_success())
+    return request_res;
+
+  glue::jit::cxx_argument_mapper arg_mapper{*kernel_info, args, arg_sizes,
+                                            num_args};
+  if(!arg_mapper.mapping_available()) {
+    return make_error(
+        __hipsycl_here(),
+        error_info{
+            "ze_queue: Could not map C++ arguments to kernel arguments"});
+  }
+
+  // If some scalar arguments have had the same values for a while, use the
+  // variant of the kernel specialized for them once it has been compiled.
+  // Since the variant is looked up by the argument values of this launch,
+  // it is only used if they match the values that it was compiled for.
+  const code_object *obj = nullptr;
+  glue::kernel_configuration specialized_config;
+  if (kernel_argument_tracker::get().record_launch(
+          *kernel_info, kernel_name, arg_mapper.get_mapped_args(),
+          arg_mapper.get_mapped_arg_sizes(), initial_config,
+          specialized_config)) {
+    kernel_cache::code_object_future specialized_object;
+    const hcf_kernel_info *specialized_kernel_info = nullptr;
+    if (request_sscp_code_object(op, hcf_object, kernel_name, local_mem_size,
+                                 specialized_config, specialized_object,
+                                 specialized_kernel_info)
+            .is_success() &&
+        specialized_object.wait_for(std::chrono::seconds{0}) ==
+            std::future_status::ready)
+      obj = specialized_object.get();
+  }
+
+  // Only blocks if the code object is still being compiled
+  if(!obj)
+    obj = pending_object.get();
+
   if(!obj) {
     return make_error(__hipsycl_here(),
                       error_info{"ze_queue: Code object construction failed"});
@@ -666,16 +777,6 @@ result ze_queue::submit_sscp_kernel_from_code_object(
   HIPSYCL_DEBUG_INFO << "ze_queue: Attempting to submit SSCP kernel"
                      << std::endl;
 
-
-  glue::jit::cxx_argument_mapper arg_mapper{*kernel_info, args, arg_sizes,
-                                            num_args};
-  if(!arg_mapper.mapping_available()) {
-    return make_error(
-        __hipsycl_here(),
-        error_info{
-            "ze_queue: Could not map C++ arguments to kernel arguments"});
-  }
-
   auto submission_err = submit_ze_kernel(
       kernel, get_ze_command_list(),
       static_cast<ze_node_event *>(completion_evt.get())->get_event_handle(),
@@ -30,13 +30,17 @@
 #include <iostream>
 #include <fstream>
 #include "hipSYCL/common/hcf_container.hpp"
+#include "hipSYCL/common/mapped_file.hpp"
 
 void help() {
   std::cout <<
   "Usage: acpp-hcf-tool <hcf-file> <-x|-r <file>|-p> root [subnode] [subsubnode] ...\n" <<
+  "       acpp-hcf-tool <hcf-file> <-t|-b>\n" <<
   "  -x: Extract binary attachment and print to stdout\n" <<
   "  -r <file>: Replace binary attachment with file content and print to stdout\n" << 
-  "  -p: Print node content" << std::endl;
+  "  -p: Print node content\n" <<
+  "  -t: Convert HCF to text format and print to stdout\n" <<
+  "  -b: Convert HCF to binary format and print to stdout" << std::endl;
 }
 
 enum class mode {
@@ -114,19 +118,29 @@ int main(int argc, char** argv) {
     args.push_back(std::string{argv[i]});
   }
 
-  if(args.size() < 3) {
+  if(args.size() < 2) {
     help();
     return -1;
   }
 
   std::string filename = args[0];
 
-  std::string hcf_content;
-  if(!read_file(filename, hcf_content)) {
+  hipsycl::common::mapped_file hcf_file;
+  if(!hcf_file.open(filename)) {
     std::cout << "Could not read file: " << filename << std::endl;
     return -1;
   }
-  hipsycl::common::hcf_container hcf{hcf_content};
+  // Modified HCF data is printed in the format of the input
+  bool is_binary_input =
+      hipsycl::common::hcf_binary_view::is_binary_hcf(hcf_file.data());
+  auto hcf = hipsycl::common::hcf_container::from_static_data(hcf_file.data());
+
+  auto print_hcf = [&](const hipsycl::common::hcf_container& c) {
+    if(is_binary_input)
+      std::cout << c.serialize_binary();
+    else
+      std::cout << c.serialize();
+  };
 
   mode m = mode::print_node_content;
   std::string replacement_filename;
@@ -135,12 +149,18 @@ int main(int argc, char** argv) {
   if(args[1] == "-x") {
     m = mode::print_attachment;
   }
-  else if(args[1] == "-r") {
+  else if(args[1] == "-r" && args.size() > 2) {
     m = mode::replace_attachment;
     replacement_filename = args[2];
     ++target_node_start;
   } else if(args[1] == "-p") {
     m = mode::print_node_content;
+  } else if(args[1] == "-t") {
+    std::cout << hcf.serialize();
+    return 0;
+  } else if(args[1] == "-b") {
+    std::cout << hcf.serialize_binary();
+    return 0;
   } else {
     std::cout << "Unknown mode of operation: " << args[1] << std::endl;
     return -1;
@@ -208,7 +228,7 @@ int main(int argc, char** argv) {
 
     if(!current->has_binary_data_attached()) {
       hcf.attach_binary_content(current, content);
-      std::cout << hcf.serialize();
+      print_hcf(hcf);
     } else {
       hipsycl::common::hcf_container new_container;
 
@@ -235,7 +255,7 @@ int main(int argc, char** argv) {
         return -1;
       }
 
-      std::cout << new_container.serialize();
+      print_hcf(new_container);
     }
   }
 
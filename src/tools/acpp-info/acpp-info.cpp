@@ -32,6 +32,7 @@
 #include "hipSYCL/runtime/runtime.hpp"
 #include "hipSYCL/runtime/hardware.hpp"
 #include "hipSYCL/runtime/executor.hpp"
+#include "hipSYCL/runtime/hw_model/hw_model.hpp"
 
 using namespace hipsycl;
 
@@ -197,10 +198,35 @@ void print_help(const char* exe_name)
     std::cout << "Options:\n";
     std::cout << "\t-h, --help              Show this message.\n";
     std::cout << "\t-l, --list-devices      Only list backends and devices, without detailed information.\n";
+    std::cout << "\t--calibrate-memcpy-model <file>\n"
+              << "\t                        Measure transfer latencies and bandwidths between all\n"
+              << "\t                        devices and store them in <file> for use with\n"
+              << "\t                        ACPP_RT_MEMCPY_MODEL_FILE.\n";
+}
+
+int calibrate_memcpy_model(rt::runtime* rt, const std::string& filename) {
+  rt::memcpy_model *model =
+      rt->backends().hardware_model().get_memcpy_model();
+
+  std::cout << "Calibrating memcpy model, this may take a while..."
+            << std::endl;
+  auto res = model->calibrate(rt);
+  if(!res.is_success()) {
+    res.dump(std::cerr);
+    std::cerr << std::endl;
+    return 1;
+  }
+  if(!model->store(filename)) {
+    std::cerr << "Could not write memcpy model to " << filename << std::endl;
+    return 1;
+  }
+  std::cout << "Memcpy model written to " << filename << std::endl;
+  return 0;
 }
 
 int main(int argc, char *argv[]) {
   bool print_device_details = true;
+  std::string memcpy_model_file;
   for (int arg = 1; arg < argc; arg++) {
     const std::string current_arg{argv[arg]};
     if (current_arg == "-h" || current_arg == "--help") {
@@ -210,6 +236,9 @@ int main(int argc, char *argv[]) {
     else if (current_arg == "-l" || current_arg == "--list-devices") {
       print_device_details = false;
     }
+    else if (current_arg == "--calibrate-memcpy-model" && arg + 1 < argc) {
+      memcpy_model_file = argv[++arg];
+    }
     else {
       std::cerr << "Unknown option: " << argv[arg] << std::endl;
       print_help(argv[0]);
@@ -220,6 +249,9 @@ int main(int argc, char *argv[]) {
   rt::runtime_keep_alive_token rt_token;
   rt::runtime* rt = rt_token.get();
 
+  if (!memcpy_model_file.empty())
+    return calibrate_memcpy_model(rt, memcpy_model_file);
+
   std::cout << "=================Backend information==================="
             << std::endl;
   list_backends(rt);
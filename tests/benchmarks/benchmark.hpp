@@ -0,0 +1,156 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HIPSYCL_BENCHMARKS_BENCHMARK_HPP
+#define HIPSYCL_BENCHMARKS_BENCHMARK_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace hipsycl::benchmarks {
+
+/// Returns the median of the given samples.
+inline double median(std::vector<double> samples) {
+  if(samples.empty())
+    return 0.0;
+  std::sort(samples.begin(), samples.end());
+  return samples[samples.size() / 2];
+}
+
+/// Runs f() \c repetitions times after \c warmup untimed runs and returns
+/// the median runtime of a single run in seconds.
+template<class F>
+double median_runtime(F&& f, std::size_t repetitions = 10,
+                      std::size_t warmup = 2) {
+  for(std::size_t i = 0; i < warmup; ++i)
+    f();
+
+  std::vector<double> times;
+  for(std::size_t i = 0; i < repetitions; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto stop = std::chrono::steady_clock::now();
+    times.push_back(std::chrono::duration<double>(stop - start).count());
+  }
+  return median(times);
+}
+
+/// Collects all reported results, and writes them as JSON to the file
+/// given in the ACPP_BENCHMARK_JSON environment variable when the
+/// benchmark exits.
+class json_output {
+public:
+  struct result {
+    std::string benchmark;
+    std::string metric;
+    double value;
+    std::string unit;
+  };
+
+  static json_output& get() {
+    static json_output output;
+    return output;
+  }
+
+  void add(const result& r) {
+    _results.push_back(r);
+  }
+
+  ~json_output() {
+    const char* filename = std::getenv("ACPP_BENCHMARK_JSON");
+    if(!filename)
+      return;
+
+    std::ofstream out{filename};
+    if(!out.is_open()) {
+      std::cerr << "Could not open " << filename << " for writing"
+                << std::endl;
+      return;
+    }
+    out.precision(17);
+    out << "{\n  \"results\": [";
+    for(std::size_t i = 0; i < _results.size(); ++i) {
+      const result& r = _results[i];
+      out << (i == 0 ? "\n" : ",\n");
+      out << "    {\"benchmark\": " << quote(r.benchmark)
+          << ", \"metric\": " << quote(r.metric)
+          << ", \"value\": ";
+      // JSON has no representation for inf and nan
+      if(std::isfinite(r.value))
+        out << r.value;
+      else
+        out << "null";
+      out << ", \"unit\": " << quote(r.unit) << "}";
+    }
+    out << "\n  ]\n}\n";
+  }
+private:
+  json_output() = default;
+
+  static std::string quote(const std::string& str) {
+    std::string out = "\"";
+    for(char c : str) {
+      if(c == '"' || c == '\\') {
+        out += '\\';
+        out += c;
+      } else if(c == '\n') {
+        out += "\\n";
+      } else if(c == '\t') {
+        out += "\\t";
+      } else if(static_cast<unsigned char>(c) < 0x20) {
+        char escaped[7];
+        std::snprintf(escaped, sizeof(escaped), "\\u%04x",
+                      static_cast<unsigned>(static_cast<unsigned char>(c)));
+        out += escaped;
+      } else {
+        out += c;
+      }
+    }
+    return out + "\"";
+  }
+
+  std::vector<result> _results;
+};
+
+inline void report(const std::string& benchmark, const std::string& metric,
+                   double value, const std::string& unit) {
+  std::cout << benchmark << " " << metric << ": " << value << " " << unit
+            << std::endl;
+  json_output::get().add({benchmark, metric, value, unit});
+}
+
+}
+
+#endif
@@ -0,0 +1,89 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// Measures the cost of building DAG nodes for command groups with many
+// buffer accessors, which is dominated by dag_builder::build_node() and
+// the requirement analysis it performs. Only the time spent in submit()
+// is reported.
+
+#include <array>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <sycl/sycl.hpp>
+
+#include "benchmark.hpp"
+
+int main(int argc, char** argv) {
+  std::size_t num_command_groups = 1000;
+  if(argc > 1)
+    num_command_groups = std::stoull(argv[1]);
+
+  constexpr std::size_t max_accessors = 64;
+  constexpr std::size_t buffer_size = 256;
+  using accessor_type = sycl::accessor<int, 1, sycl::access_mode::read>;
+
+  sycl::queue q{sycl::system_selector_v};
+
+  std::vector<sycl::buffer<int>> buffers;
+  for(std::size_t i = 0; i < max_accessors; ++i) {
+    buffers.emplace_back(sycl::range<1>{buffer_size});
+    q.submit([&](sycl::handler& cgh) {
+      sycl::accessor acc{buffers.back(), cgh, sycl::no_init};
+      cgh.parallel_for(sycl::range<1>{buffer_size},
+                       [=](sycl::id<1> idx) { acc[idx] = 0; });
+    });
+  }
+  q.wait();
+
+  for(std::size_t num_accessors : {1, 4, 16, 64}) {
+    std::vector<double> submission_times;
+    hipsycl::benchmarks::median_runtime([&]() {
+      auto start = std::chrono::steady_clock::now();
+      for(std::size_t i = 0; i < num_command_groups; ++i) {
+        q.submit([&](sycl::handler& cgh) {
+          // Buffers are accessed read-only, so that command groups
+          // do not depend on each other. All accessors need to be captured
+          // by the kernel, unused entries remain default-constructed.
+          std::array<accessor_type, max_accessors> accessors;
+          for(std::size_t j = 0; j < num_accessors; ++j)
+            accessors[j] = accessor_type{buffers[j], cgh};
+          cgh.single_task([=]() { (void)accessors; });
+        });
+      }
+      auto stop = std::chrono::steady_clock::now();
+      submission_times.push_back(
+          std::chrono::duration<double>(stop - start).count());
+      q.wait();
+    }, 5, 1);
+
+    std::string label =
+        "dag_build/accessors=" + std::to_string(num_accessors);
+    hipsycl::benchmarks::report(
+        label, "submit", hipsycl::benchmarks::median(submission_times) /
+                             num_command_groups * 1e6, "us");
+  }
+}
@@ -0,0 +1,95 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// Measures work group collectives in nd_range kernels on the host device
+// for group sizes between 64 and 1024 work items.
+
+#include <string>
+#include <sycl/sycl.hpp>
+
+#include "benchmark.hpp"
+
+namespace {
+
+constexpr std::size_t problem_size = 1 << 18;
+constexpr int collectives_per_item = 8;
+
+template<class Kernel>
+void run(sycl::queue& q, const std::string& name, std::size_t group_size,
+         Kernel k) {
+  double t = hipsycl::benchmarks::median_runtime([&]() {
+    q.submit([&](sycl::handler& cgh) {
+      cgh.parallel_for(sycl::nd_range<1>{problem_size, group_size}, k);
+    });
+    q.wait();
+  }, 5, 1);
+  hipsycl::benchmarks::report("group_algorithms/" + name + "/" +
+                                  std::to_string(group_size),
+                              "collective_runtime",
+                              t / (problem_size / group_size) /
+                                  collectives_per_item,
+                              "s");
+}
+
+}
+
+int main() {
+  sycl::queue q{sycl::system_selector_v, sycl::property::queue::in_order{}};
+  float* data = sycl::malloc_device<float>(problem_size, q);
+  q.fill(data, 1.0f, problem_size).wait();
+
+  for(std::size_t group_size : {64, 128, 256, 512, 1024}) {
+    run(q, "reduce", group_size, [=](sycl::nd_item<1> item) {
+      float x = data[item.get_global_linear_id()];
+      for(int i = 0; i < collectives_per_item; ++i)
+        x = sycl::reduce_over_group(item.get_group(), x, sycl::plus<float>{});
+      data[item.get_global_linear_id()] = x / group_size;
+    });
+    run(q, "inclusive_scan", group_size, [=](sycl::nd_item<1> item) {
+      float x = data[item.get_global_linear_id()];
+      for(int i = 0; i < collectives_per_item; ++i)
+        x = sycl::inclusive_scan_over_group(item.get_group(), x,
+                                            sycl::plus<float>{}) /
+            group_size;
+      data[item.get_global_linear_id()] = x;
+    });
+    run(q, "broadcast", group_size, [=](sycl::nd_item<1> item) {
+      float x = data[item.get_global_linear_id()];
+      for(int i = 0; i < collectives_per_item; ++i)
+        x = sycl::group_broadcast(item.get_group(), x, i);
+      data[item.get_global_linear_id()] = x;
+    });
+    run(q, "any_of", group_size, [=](sycl::nd_item<1> item) {
+      bool pred = data[item.get_global_linear_id()] > 2.0f;
+      for(int i = 0; i < collectives_per_item; ++i)
+        pred = sycl::any_of_group(item.get_group(), pred);
+      if(pred)
+        data[item.get_global_linear_id()] = 1.0f;
+    });
+  }
+
+  sycl::free(data, q);
+}
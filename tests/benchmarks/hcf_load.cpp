@@ -0,0 +1,114 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// Measures how long it takes to load an HCF object similar to what the SSCP
+// compilation flow embeds into applications with many kernels, in the text
+// and in the binary format, as well as looking up kernel nodes and the
+// device image without materializing the node tree.
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "hipSYCL/common/hcf_container.hpp"
+
+#include "benchmark.hpp"
+
+int main(int argc, char** argv) {
+  std::size_t num_kernels = 200;
+  if(argc > 1)
+    num_kernels = std::stoull(argv[1]);
+
+  constexpr std::size_t params_per_kernel = 8;
+  constexpr std::size_t image_size = 16 * 1024 * 1024;
+
+  hipsycl::common::hcf_container hcf;
+  hcf.root_node()->set("object-id", "18446744073709551557");
+  hcf.root_node()->set("generator", "benchmark");
+  auto* images = hcf.root_node()->add_subnode("images");
+  auto* image = images->add_subnode("llvm-ir.global");
+  image->set("variant", "global-module");
+  image->set("format", "llvm-ir");
+  hcf.attach_binary_content(image, std::string(image_size, 'x'));
+
+  std::vector<std::string> kernel_names;
+  auto* kernels = hcf.root_node()->add_subnode("kernels");
+  for(std::size_t i = 0; i < num_kernels; ++i) {
+    kernel_names.push_back("_Z19__acpp_sscp_kernelI" + std::to_string(i) +
+                           "benchmark_kernelEvT_");
+    auto* kernel = kernels->add_subnode(kernel_names.back());
+    kernel->set_as_list("image-providers", {"llvm-ir.global"});
+    auto* params = kernel->add_subnode("parameters");
+    for(std::size_t j = 0; j < params_per_kernel; ++j) {
+      auto* p = params->add_subnode(std::to_string(j));
+      p->set("byte-offset", std::to_string(8 * j));
+      p->set("byte-size", "8");
+      p->set("original-index", "0");
+      p->set("type", "integer");
+    }
+  }
+
+  std::string text_data = hcf.serialize();
+  std::string binary_data = hcf.serialize_binary();
+
+  std::size_t num_nodes = 0;
+  double text_load = hipsycl::benchmarks::median_runtime([&]() {
+    auto c = hipsycl::common::hcf_container::from_static_data(text_data);
+    num_nodes += c.root_node()->get_subnode("kernels")->subnodes.size();
+  });
+  double binary_load = hipsycl::benchmarks::median_runtime([&]() {
+    auto c = hipsycl::common::hcf_container::from_static_data(binary_data);
+    num_nodes += c.root_node()->get_subnode("kernels")->subnodes.size();
+  });
+
+  std::size_t num_found = 0;
+  double view_lookup = hipsycl::benchmarks::median_runtime([&]() {
+    hipsycl::common::hcf_binary_view view{binary_data};
+    auto kernels_node = view.get_subnode(view.root(), "kernels");
+    for(const auto& name : kernel_names) {
+      std::string_view type;
+      auto params = view.get_subnode(view.get_subnode(kernels_node, name),
+                                     "parameters");
+      if(view.get_value(view.get_subnode(params, "0"), "type", type))
+        ++num_found;
+    }
+    std::string_view bitcode;
+    if(view.get_binary_attachment(
+           view.get_subnode(view.get_subnode(view.root(), "images"),
+                            "llvm-ir.global"),
+           bitcode))
+      num_found += (bitcode.size() == image_size);
+  });
+
+  if(num_nodes == 0 || num_found == 0)
+    return -1;
+
+  hipsycl::benchmarks::report("hcf_load", "text_load", text_load * 1e3, "ms");
+  hipsycl::benchmarks::report("hcf_load", "binary_load", binary_load * 1e3,
+                              "ms");
+  hipsycl::benchmarks::report("hcf_load", "binary_view_lookup",
+                              view_lookup * 1e3, "ms");
+}
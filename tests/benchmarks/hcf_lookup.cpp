@@ -0,0 +1,96 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// Measures the throughput of hcf_cache::symbol_lookup(), which is used to
+// resolve imported symbols when JIT-compiling kernels. A synthetic HCF object
+// exporting symbols from multiple device images is registered, and batches of
+// symbol names - some of which are not exported - are looked up.
+
+#include <string>
+#include <vector>
+
+#include "hipSYCL/common/hcf_container.hpp"
+#include "hipSYCL/runtime/kernel_cache.hpp"
+
+#include "benchmark.hpp"
+
+int main(int argc, char** argv) {
+  std::size_t num_lookups = 1 << 16;
+  if(argc > 1)
+    num_lookups = std::stoull(argv[1]);
+
+  constexpr std::size_t num_images = 16;
+  constexpr std::size_t symbols_per_image = 256;
+  constexpr std::size_t batch_size = 64;
+  // Unlikely to collide with the ids of HCF objects embedded by the compiler
+  const std::string object_id = "18446744073709551557";
+
+  hipsycl::common::hcf_container hcf;
+  hcf.root_node()->set("object-id", object_id);
+  auto* images = hcf.root_node()->add_subnode("images");
+  for(std::size_t i = 0; i < num_images; ++i) {
+    std::vector<std::string> symbols;
+    for(std::size_t j = 0; j < symbols_per_image; ++j)
+      symbols.push_back("__acpp_benchmark_symbol_" + std::to_string(i) + "_" +
+                        std::to_string(j));
+    auto* image = images->add_subnode("image" + std::to_string(i));
+    image->set("format", "llvm-ir.global");
+    image->set("variant", "global-module");
+    image->set_as_list("exported-symbols", symbols);
+  }
+  auto id = hipsycl::rt::hcf_cache::get().register_hcf_object(hcf);
+
+  // Every fourth symbol is not exported by any image
+  std::vector<std::string> names;
+  for(std::size_t i = 0; i < batch_size; ++i) {
+    std::size_t image = (i * 7) % num_images;
+    std::size_t symbol = (i * 31) % symbols_per_image;
+    std::string prefix = (i % 4 == 3) ? "__acpp_benchmark_missing_"
+                                      : "__acpp_benchmark_symbol_";
+    names.push_back(prefix + std::to_string(image) + "_" +
+                    std::to_string(symbol));
+  }
+
+  std::size_t num_found = 0;
+  double t = hipsycl::benchmarks::median_runtime([&]() {
+    for(std::size_t i = 0; i < num_lookups / batch_size; ++i) {
+      hipsycl::rt::hcf_cache::get().symbol_lookup(
+          names, [&](const std::string &,
+                     const hipsycl::rt::hcf_cache::symbol_resolver_list &l) {
+            if(!l.empty())
+              ++num_found;
+          });
+    }
+  });
+  hipsycl::rt::hcf_cache::get().unregister_hcf_object(id);
+
+  if(num_found == 0)
+    return -1;
+
+  hipsycl::benchmarks::report("hcf_symbol_lookup", "throughput",
+                              (num_lookups / batch_size) * batch_size / t,
+                              "lookups/s");
+}
@@ -0,0 +1,94 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// Measures basic parallel for and nd_range kernels with irregular cost per
+// work item on the host device, using the static and the work stealing
+// OpenMP schedule.
+
+#include <cstdint>
+#include <string>
+#include <sycl/sycl.hpp>
+
+#include "benchmark.hpp"
+
+namespace {
+
+constexpr std::size_t problem_size = 1 << 16;
+
+// Per-item cost that grows towards the end of the range, with
+// a few very expensive items, similar to sparse rows of
+// varying length or early exits.
+inline std::uint64_t work(std::size_t i) {
+  std::size_t iterations = i / 64;
+  if(i % 1021 == 0)
+    iterations += 1 << 14;
+
+  std::uint64_t x = i;
+  for(std::size_t j = 0; j < iterations; ++j)
+    x = x * 6364136223846793005ull + 1442695040888963407ull;
+  return x;
+}
+
+template<class Property>
+void run(sycl::queue& q, std::uint64_t* out, const std::string& schedule) {
+  double t_basic = hipsycl::benchmarks::median_runtime([&]() {
+    q.submit({Property{}}, [&](sycl::handler& cgh) {
+      cgh.parallel_for(sycl::range<1>{problem_size},
+                       [=](sycl::id<1> idx) { out[idx[0]] = work(idx[0]); });
+    });
+    q.wait();
+  }, 5, 1);
+  hipsycl::benchmarks::report("load_imbalance/basic/" + schedule, "runtime",
+                              t_basic, "s");
+
+  constexpr std::size_t group_size = 32;
+  double t_nd = hipsycl::benchmarks::median_runtime([&]() {
+    q.submit({Property{}}, [&](sycl::handler& cgh) {
+      cgh.parallel_for(
+          sycl::nd_range<1>{problem_size, group_size},
+          [=](sycl::nd_item<1> item) {
+            std::size_t i = item.get_global_linear_id();
+            out[i] = work(i);
+          });
+    });
+    q.wait();
+  }, 5, 1);
+  hipsycl::benchmarks::report("load_imbalance/nd_range/" + schedule, "runtime",
+                              t_nd, "s");
+}
+
+}
+
+int main() {
+  sycl::queue q{sycl::system_selector_v, sycl::property::queue::in_order{}};
+  std::uint64_t* out = sycl::malloc_device<std::uint64_t>(problem_size, q);
+
+  run<sycl::property::command_group::hipSYCL_static_schedule>(q, out, "static");
+  run<sycl::property::command_group::hipSYCL_work_stealing_schedule>(
+      q, out, "work_stealing");
+
+  sycl::free(out, q);
+}
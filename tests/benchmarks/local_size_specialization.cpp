@@ -0,0 +1,109 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Measures barrier-heavy nd_range kernels for work group sizes that the
+// omp.accelerated compilation flow compiles specialized kernel versions for.
+// Run with ACPP_RT_OMP_LOCAL_SIZE_SPECIALIZATION=0 to obtain the runtime of
+// the generic kernel versions.
+
+#include <string>
+#include <sycl/sycl.hpp>
+
+#include "benchmark.hpp"
+
+namespace {
+
+constexpr std::size_t problem_size = 1 << 18;
+constexpr int iterations_per_kernel = 8;
+
+template<class KernelFactory>
+void run(sycl::queue& q, const std::string& name, std::size_t group_size,
+         KernelFactory make_kernel) {
+  double t = hipsycl::benchmarks::median_runtime([&]() {
+    q.submit([&](sycl::handler& cgh) {
+      sycl::local_accessor<float> scratch{group_size, cgh};
+      cgh.parallel_for(sycl::nd_range<1>{problem_size, group_size},
+                       make_kernel(scratch));
+    });
+    q.wait();
+  }, 7, 1);
+  hipsycl::benchmarks::report("local_size_specialization/" + name + "/" +
+                                  std::to_string(group_size),
+                              "runtime", t, "s");
+}
+
+}
+
+int main() {
+  sycl::queue q{sycl::system_selector_v, sycl::property::queue::in_order{}};
+  float* data = sycl::malloc_device<float>(problem_size, q);
+  q.fill(data, 1.0f, problem_size).wait();
+
+  for(std::size_t group_size : {64, 128, 256}) {
+    // Tree reduction in local memory, one barrier per level
+    run(q, "local_reduction", group_size, [=](sycl::local_accessor<float> s) {
+      return [=](sycl::nd_item<1> item) {
+        std::size_t lid = item.get_local_id(0);
+        std::size_t gid = item.get_global_id(0);
+        float x = data[gid];
+        for(int i = 0; i < iterations_per_kernel; ++i) {
+          s[lid] = x;
+          for(std::size_t stride = item.get_local_range(0) / 2; stride > 0;
+              stride /= 2) {
+            sycl::group_barrier(item.get_group());
+            if(lid < stride)
+              s[lid] += s[lid + stride];
+          }
+          sycl::group_barrier(item.get_group());
+          x = x * 0.5f + s[0] / item.get_local_range(0);
+          sycl::group_barrier(item.get_group());
+        }
+        data[gid] = x;
+      };
+    });
+    // 3-point stencil that exchanges values through local memory
+    run(q, "local_stencil", group_size, [=](sycl::local_accessor<float> s) {
+      return [=](sycl::nd_item<1> item) {
+        std::size_t lid = item.get_local_id(0);
+        std::size_t n = item.get_local_range(0);
+        std::size_t gid = item.get_global_id(0);
+        float x = data[gid];
+        for(int i = 0; i < iterations_per_kernel; ++i) {
+          s[lid] = x;
+          sycl::group_barrier(item.get_group());
+          float left = s[lid == 0 ? n - 1 : lid - 1];
+          float right = s[lid == n - 1 ? 0 : lid + 1];
+          x = 0.25f * left + 0.5f * x + 0.25f * right;
+          sycl::group_barrier(item.get_group());
+        }
+        data[gid] = x;
+      };
+    });
+  }
+
+  sycl::free(data, q);
+}
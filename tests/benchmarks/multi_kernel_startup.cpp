@@ -0,0 +1,112 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// Measures startup of an application whose device image contains 200
+// kernels: the time until the first kernel has completed, until a small
+// working set of kernels has completed, and until all kernels have
+// completed. On devices that use the generic SSCP compilation flow, kernels
+// are compiled individually when they are first needed and in parallel by
+// default. Run with ACPP_SSCP_JIT_PER_KERNEL_COMPILATION=0 to compile the
+// whole image at once instead, and with ACPP_SSCP_JIT_CACHE_DIRECTORY unset
+// to avoid measuring the persistent cache.
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <utility>
+#include <sycl/sycl.hpp>
+
+#include "benchmark.hpp"
+
+namespace {
+
+constexpr std::size_t problem_size = 1 << 12;
+constexpr std::size_t num_kernels = 200;
+constexpr std::size_t working_set_size = 8;
+
+template<std::size_t I>
+class startup_kernel;
+
+// Shared by all kernels, so that they have common code in the device image
+float transform(float x, float a) {
+  for(int i = 0; i < 4; ++i)
+    x = x * a + 1.0f / (1.0f + x * x);
+  return x;
+}
+
+template<std::size_t I>
+sycl::event submit_kernel(sycl::queue& q, float* data) {
+  return q.parallel_for<startup_kernel<I>>(
+      sycl::range{problem_size}, [=](sycl::id<1> idx) {
+        float* out = data + (I % working_set_size) * problem_size;
+        out[idx] = transform(out[idx], static_cast<float>(I + 1));
+      });
+}
+
+template<std::size_t Offset, std::size_t... I>
+std::array<sycl::event, sizeof...(I)>
+submit_kernels(sycl::queue& q, float* data, std::index_sequence<I...>) {
+  return {submit_kernel<Offset + I>(q, data)...};
+}
+
+double seconds_since(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       start)
+      .count();
+}
+
+}
+
+int main() {
+  auto start = std::chrono::steady_clock::now();
+
+  sycl::queue q;
+  float* data = sycl::malloc_device<float>(working_set_size * problem_size, q);
+  q.memset(data, 0, working_set_size * problem_size * sizeof(float)).wait();
+  double startup = seconds_since(start);
+
+  submit_kernel<0>(q, data).wait();
+  double first_kernel = seconds_since(start);
+
+  submit_kernels<1>(q, data, std::make_index_sequence<working_set_size - 1>{});
+  q.wait();
+  double working_set = seconds_since(start);
+
+  submit_kernels<working_set_size>(
+      q, data, std::make_index_sequence<num_kernels - working_set_size>{});
+  q.wait();
+  double all_kernels = seconds_since(start);
+
+  hipsycl::benchmarks::report("multi_kernel_startup", "startup", startup, "s");
+  hipsycl::benchmarks::report("multi_kernel_startup", "first_kernel",
+                              first_kernel, "s");
+  hipsycl::benchmarks::report("multi_kernel_startup", "working_set",
+                              working_set, "s");
+  hipsycl::benchmarks::report("multi_kernel_startup", "all_kernels",
+                              all_kernels, "s");
+
+  sycl::free(data, q);
+}
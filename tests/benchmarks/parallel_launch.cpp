@@ -0,0 +1,85 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// Measures the per-launch overhead of small parallel kernels on the host
+// device. Unlike single_task, these kernels have to be distributed across
+// all threads, so this includes the cost of starting and joining the
+// threads for each kernel. Run with ACPP_RT_OMP_THREAD_POOL=0 to compare
+// against kernels executing in OpenMP parallel regions.
+
+#include <string>
+#include <sycl/sycl.hpp>
+
+#include "benchmark.hpp"
+
+int main(int argc, char** argv) {
+  std::size_t num_kernels = 10000;
+  if(argc > 1)
+    num_kernels = std::stoull(argv[1]);
+
+  std::string label =
+      std::string{"parallel_launch/"} +
+      (hipsycl::rt::application::get_settings()
+               .get<hipsycl::rt::setting::omp_thread_pool>()
+           ? "thread_pool"
+           : "omp_parallel");
+
+  sycl::queue q{sycl::system_selector_v, sycl::property::queue::in_order{}};
+  int* data = sycl::malloc_device<int>(1024, q);
+
+  double t_basic = hipsycl::benchmarks::median_runtime([&]() {
+    for(std::size_t i = 0; i < num_kernels; ++i)
+      q.parallel_for(sycl::range<1>{1024}, [=](sycl::id<1> idx) {
+        data[idx] += 1;
+      });
+    q.wait();
+  });
+  hipsycl::benchmarks::report(label + "/basic", "per_kernel",
+                              t_basic / num_kernels * 1e6, "us");
+
+  double t_round_trip = hipsycl::benchmarks::median_runtime([&]() {
+    for(std::size_t i = 0; i < num_kernels / 10; ++i)
+      q.parallel_for(sycl::range<1>{1024}, [=](sycl::id<1> idx) {
+        data[idx] += 1;
+      }).wait();
+  });
+  hipsycl::benchmarks::report(label + "/basic", "round_trip",
+                              t_round_trip / (num_kernels / 10) * 1e6, "us");
+
+  int* sum = sycl::malloc_device<int>(1, q);
+  double t_reduction = hipsycl::benchmarks::median_runtime([&]() {
+    for(std::size_t i = 0; i < num_kernels; ++i)
+      q.parallel_for(sycl::range<1>{1024},
+                     sycl::reduction(sum, sycl::plus<int>{}),
+                     [=](sycl::id<1> idx, auto& s) { s += data[idx]; });
+    q.wait();
+  });
+  hipsycl::benchmarks::report(label + "/reduction", "per_kernel",
+                              t_reduction / num_kernels * 1e6, "us");
+
+  sycl::free(sum, q);
+  sycl::free(data, q);
+}
@@ -0,0 +1,91 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Compares the cost-model based device placement of the unbound scheduler
+// with round-robin placement. The placement strategy is a runtime setting,
+// so this benchmark needs to be run once for each strategy:
+//
+//   ACPP_RT_PLACEMENT_STRATEGY=cost_model ./placement
+//   ACPP_RT_PLACEMENT_STRATEGY=round_robin ./placement
+//
+// The workload consists of independent chains of kernels, each operating
+// repeatedly on its own buffer. Good placement keeps each chain on one device,
+// while round-robin placement migrates the buffer on every kernel.
+// On nodes where the OpenMP backend is the only backend, both strategies
+// select the same device and the benchmark measures scheduling overhead.
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <sycl/sycl.hpp>
+
+#include "benchmark.hpp"
+
+int main(int argc, char** argv) {
+  std::size_t num_chains = 8;
+  std::size_t chain_length = 16;
+  std::size_t problem_size = 1 << 20;
+  if(argc > 1)
+    num_chains = std::stoull(argv[1]);
+  if(argc > 2)
+    chain_length = std::stoull(argv[2]);
+  if(argc > 3)
+    problem_size = std::stoull(argv[3]);
+
+  sycl::queue q{sycl::system_selector_v};
+
+  std::vector<sycl::buffer<float>> buffers;
+  for(std::size_t i = 0; i < num_chains; ++i) {
+    buffers.emplace_back(sycl::range<1>{problem_size});
+    q.submit([&](sycl::handler& cgh) {
+      sycl::accessor acc{buffers.back(), cgh, sycl::no_init};
+      cgh.parallel_for(sycl::range<1>{problem_size},
+                       [=](sycl::id<1> idx) { acc[idx] = 1.0f; });
+    });
+  }
+  q.wait();
+
+  double t = hipsycl::benchmarks::median_runtime([&]() {
+    for(std::size_t step = 0; step < chain_length; ++step) {
+      for(auto& buff : buffers) {
+        q.submit([&](sycl::handler& cgh) {
+          sycl::accessor acc{buff, cgh};
+          cgh.parallel_for(sycl::range<1>{problem_size},
+                           [=](sycl::id<1> idx) { acc[idx] *= 1.0001f; });
+        });
+      }
+    }
+    q.wait();
+  }, 5, 1);
+
+  const char* strategy = std::getenv("ACPP_RT_PLACEMENT_STRATEGY");
+  std::string label = std::string{"placement/"} +
+                      (strategy ? strategy : "cost_model");
+  hipsycl::benchmarks::report(label, "runtime", t, "s");
+  hipsycl::benchmarks::report(label, "kernels_per_second",
+                              num_chains * chain_length / t, "1/s");
+}
@@ -0,0 +1,72 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// Measures the throughput of sum reductions using sycl::reduction on the host
+// device, for multiple problem sizes.
+
+#include <string>
+#include <sycl/sycl.hpp>
+
+#include "benchmark.hpp"
+
+template<class T>
+void run(sycl::queue& q, const std::string& type_name) {
+  constexpr std::size_t max_size = std::size_t{1} << 24;
+  T* data = sycl::malloc_device<T>(max_size, q);
+  T* result = sycl::malloc_device<T>(1, q);
+  q.parallel_for(sycl::range<1>{max_size},
+                 [=](sycl::id<1> idx) { data[idx] = T{1}; });
+  q.wait();
+
+  for(std::size_t size = std::size_t{1} << 12; size <= max_size; size <<= 4) {
+    std::size_t num_reductions = std::max(std::size_t{1}, max_size / size / 16);
+
+    double t = hipsycl::benchmarks::median_runtime([&]() {
+      for(std::size_t i = 0; i < num_reductions; ++i) {
+        q.memset(result, 0, sizeof(T));
+        q.parallel_for(sycl::range<1>{size},
+                       sycl::reduction(result, sycl::plus<T>{}),
+                       [=](sycl::id<1> idx, auto& sum) { sum += data[idx]; });
+      }
+      q.wait();
+    }, 5, 1);
+
+    std::string label =
+        "reduction/" + type_name + "/size=" + std::to_string(size);
+    hipsycl::benchmarks::report(label, "throughput",
+                                num_reductions * size / t, "elements/s");
+  }
+
+  sycl::free(data, q);
+  sycl::free(result, q);
+}
+
+int main() {
+  sycl::queue q{sycl::system_selector_v, sycl::property::queue::in_order{}};
+  run<int>(q, "int");
+  run<float>(q, "float");
+  run<double>(q, "double");
+}
@@ -0,0 +1,113 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// Measures the throughput of the hcf_cache lookups that are performed on
+// every SSCP kernel launch - kernel info, image info and HCF object
+// retrieval - when kernels are submitted from 1 to 32 threads concurrently.
+// Ideally, throughput scales with the number of threads up to the number
+// of available cores.
+
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "hipSYCL/common/hcf_container.hpp"
+#include "hipSYCL/runtime/kernel_cache.hpp"
+
+#include "benchmark.hpp"
+
+int main(int argc, char** argv) {
+  std::size_t lookups_per_thread = 1 << 16;
+  if(argc > 1)
+    lookups_per_thread = std::stoull(argv[1]);
+
+  constexpr std::size_t num_kernels = 200;
+  constexpr std::size_t max_threads = 32;
+  // Unlikely to collide with the ids of HCF objects embedded by the compiler
+  const std::string object_id = "18446744073709551533";
+
+  hipsycl::common::hcf_container hcf;
+  hcf.root_node()->set("object-id", object_id);
+  auto* image = hcf.root_node()->add_subnode("images")->add_subnode("llvm-ir.global");
+  image->set("format", "llvm-ir");
+  image->set("variant", "global-module");
+
+  std::vector<std::string> kernel_names;
+  auto* kernels = hcf.root_node()->add_subnode("kernels");
+  for(std::size_t i = 0; i < num_kernels; ++i) {
+    kernel_names.push_back("_Z30__acpp_benchmark_sscp_kernel_" +
+                           std::to_string(i) + "RKN7hipsycl4sycl7handlerE");
+    auto* kernel = kernels->add_subnode(kernel_names.back());
+    kernel->add_subnode("image-providers")->add_subnode("llvm-ir.global");
+    auto* param = kernel->add_subnode("parameters")->add_subnode("0");
+    param->set("byte-offset", "0");
+    param->set("byte-size", "8");
+    param->set("original-index", "0");
+    param->set("type", "pointer");
+  }
+  auto id = hipsycl::rt::hcf_cache::get().register_hcf_object(hcf);
+
+  auto submitter = [&](std::size_t thread_id, std::size_t& num_found) {
+    auto& cache = hipsycl::rt::hcf_cache::get();
+    for(std::size_t i = 0; i < lookups_per_thread; ++i) {
+      const std::string& name =
+          kernel_names[(thread_id * 13 + i) % num_kernels];
+      auto* kernel_info = cache.get_kernel_info(id, name);
+      if(!kernel_info)
+        continue;
+      auto* image_info = cache.get_image_info(
+          id, kernel_info->get_images_containing_kernel().front());
+      if(image_info && cache.get_hcf(id))
+        ++num_found;
+    }
+  };
+
+  bool success = true;
+  for(std::size_t num_threads = 1; num_threads <= max_threads;
+      num_threads *= 2) {
+    // Counters are spread out to avoid false sharing between the threads
+    std::vector<std::size_t> num_found(num_threads * 8, 0);
+    double t = hipsycl::benchmarks::median_runtime([&]() {
+      std::vector<std::thread> threads;
+      for(std::size_t i = 0; i < num_threads; ++i)
+        threads.emplace_back(submitter, i, std::ref(num_found[i * 8]));
+      for(auto& t : threads)
+        t.join();
+    }, 5, 1);
+
+    for(std::size_t i = 0; i < num_threads; ++i)
+      if(num_found[i * 8] == 0)
+        success = false;
+
+    hipsycl::benchmarks::report(
+        "sscp_launch_lookup/" + std::to_string(num_threads) + "_threads",
+        "throughput", num_threads * lookups_per_thread / t, "launches/s");
+  }
+  hipsycl::rt::hcf_cache::get().unregister_hcf_object(id);
+
+  return success ? 0 : -1;
+}
@@ -0,0 +1,75 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// Measures the latency of queue::submit() on the host device.
+// Reports the time spent in submit() alone, the time per kernel when a batch
+// of kernels is submitted and waited for, and the round-trip latency
+// of submitting a single kernel and waiting for it.
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <sycl/sycl.hpp>
+
+#include "benchmark.hpp"
+
+int main(int argc, char** argv) {
+  std::size_t num_kernels = 10000;
+  if(argc > 1)
+    num_kernels = std::stoull(argv[1]);
+
+  for(bool in_order : {true, false}) {
+    sycl::queue q = in_order ? sycl::queue{sycl::system_selector_v,
+                                           sycl::property::queue::in_order{}}
+                             : sycl::queue{sycl::system_selector_v};
+    std::string label = std::string{"submit_latency/"} +
+                        (in_order ? "in_order" : "out_of_order");
+
+    std::vector<double> submission_times;
+    double t = hipsycl::benchmarks::median_runtime([&]() {
+      auto start = std::chrono::steady_clock::now();
+      for(std::size_t i = 0; i < num_kernels; ++i)
+        q.single_task([=]() {});
+      auto stop = std::chrono::steady_clock::now();
+      submission_times.push_back(
+          std::chrono::duration<double>(stop - start).count());
+      q.wait();
+    });
+
+    hipsycl::benchmarks::report(
+        label, "submit", hipsycl::benchmarks::median(submission_times) /
+                             num_kernels * 1e6, "us");
+    hipsycl::benchmarks::report(label, "submit_and_complete",
+                                t / num_kernels * 1e6, "us");
+
+    double round_trip = hipsycl::benchmarks::median_runtime([&]() {
+      for(std::size_t i = 0; i < num_kernels / 10; ++i)
+        q.single_task([=]() {}).wait();
+    });
+    hipsycl::benchmarks::report(label, "round_trip",
+                                round_trip / (num_kernels / 10) * 1e6, "us");
+  }
+}
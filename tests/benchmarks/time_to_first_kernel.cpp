@@ -0,0 +1,97 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Measures how long it takes after startup until the first kernel and until
+// a set of distinct kernels have completed. On devices that use the generic
+// SSCP compilation flow, this is dominated by JIT compilation, and the time
+// spent in submission shows whether the submitting thread is blocked by it.
+// Run with ACPP_SSCP_JIT_MAX_CONCURRENT_COMPILATIONS=1 to serialize
+// compilations, and with ACPP_SSCP_JIT_CACHE_DIRECTORY unset to
+// avoid measuring the persistent cache.
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <utility>
+#include <sycl/sycl.hpp>
+
+#include "benchmark.hpp"
+
+namespace {
+
+constexpr std::size_t problem_size = 1 << 16;
+constexpr std::size_t num_kernels = 8;
+
+template<std::size_t I>
+class distinct_kernel;
+
+template<std::size_t... I>
+std::array<sycl::event, num_kernels>
+submit_kernels(sycl::queue& q, float* data, std::index_sequence<I...>) {
+  return {q.parallel_for<distinct_kernel<I>>(
+      sycl::range{problem_size}, [=](sycl::id<1> idx) {
+        float* out = data + I * problem_size;
+        out[idx] = out[idx] * static_cast<float>(I + 1) + 1.0f;
+      })...};
+}
+
+double seconds_since(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       start)
+      .count();
+}
+
+}
+
+int main() {
+  auto start = std::chrono::steady_clock::now();
+
+  sycl::queue q;
+  float* data = sycl::malloc_device<float>(num_kernels * problem_size, q);
+  q.memset(data, 0, num_kernels * problem_size * sizeof(float)).wait();
+  double startup = seconds_since(start);
+
+  auto submission_start = std::chrono::steady_clock::now();
+  auto events = submit_kernels(q, data,
+                               std::make_index_sequence<num_kernels>{});
+  double submission = seconds_since(submission_start);
+
+  events[0].wait();
+  double first_kernel = seconds_since(start);
+  q.wait();
+  double all_kernels = seconds_since(start);
+
+  hipsycl::benchmarks::report("time_to_first_kernel", "startup", startup, "s");
+  hipsycl::benchmarks::report("time_to_first_kernel", "submission", submission,
+                              "s");
+  hipsycl::benchmarks::report("time_to_first_kernel", "first_kernel",
+                              first_kernel, "s");
+  hipsycl::benchmarks::report("time_to_first_kernel", "all_kernels",
+                              all_kernels, "s");
+
+  sycl::free(data, q);
+}
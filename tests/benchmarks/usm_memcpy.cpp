@@ -0,0 +1,64 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// Measures the throughput of USM memcpy operations on the host device,
+// which are executed by the omp_queue of the OpenMP backend.
+
+#include <string>
+#include <sycl/sycl.hpp>
+
+#include "benchmark.hpp"
+
+int main() {
+  sycl::queue q{sycl::system_selector_v, sycl::property::queue::in_order{}};
+
+  constexpr std::size_t max_size = std::size_t{1} << 28;
+  char* src = sycl::malloc_device<char>(max_size, q);
+  char* dest = sycl::malloc_device<char>(max_size, q);
+  q.memset(src, 1, max_size);
+  q.memset(dest, 0, max_size);
+  q.wait();
+
+  for(std::size_t size = std::size_t{1} << 12; size <= max_size; size <<= 4) {
+    // Keep the total amount of data per repetition roughly constant
+    std::size_t num_copies = std::max(std::size_t{1}, (max_size / size) / 4);
+
+    double t = hipsycl::benchmarks::median_runtime([&]() {
+      for(std::size_t i = 0; i < num_copies; ++i)
+        q.memcpy(dest, src, size);
+      q.wait();
+    }, 5, 1);
+
+    std::string label = "usm_memcpy/bytes=" + std::to_string(size);
+    hipsycl::benchmarks::report(label, "bandwidth",
+                                num_copies * size / t * 1e-9, "GB/s");
+    hipsycl::benchmarks::report(label, "time_per_copy",
+                                t / num_copies * 1e6, "us");
+  }
+
+  sycl::free(src, q);
+  sycl::free(dest, q);
+}
@@ -0,0 +1,70 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Measures the submission throughput of the runtime's worker_thread,
+// which is used e.g. by the OpenMP backend queues and the DAG flush path.
+// Multiple producer threads enqueue trivial tasks; the benchmark reports
+// the number of tasks processed per second.
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "hipSYCL/runtime/generic/async_worker.hpp"
+
+#include "benchmark.hpp"
+
+int main(int argc, char** argv) {
+  std::size_t num_tasks = 1 << 20;
+  if(argc > 1)
+    num_tasks = std::stoull(argv[1]);
+
+  for(std::size_t num_producers : {1, 2, 4}) {
+    hipsycl::rt::worker_thread worker;
+    std::atomic<std::size_t> counter{0};
+
+    double t = hipsycl::benchmarks::median_runtime([&]() {
+      std::vector<std::thread> producers;
+      for(std::size_t p = 0; p < num_producers; ++p) {
+        producers.emplace_back([&]() {
+          for(std::size_t i = 0; i < num_tasks / num_producers; ++i)
+            worker([&counter]() {
+              counter.fetch_add(1, std::memory_order_relaxed);
+            });
+        });
+      }
+      for(auto& p : producers)
+        p.join();
+      worker.wait();
+    }, 5, 1);
+
+    std::string label =
+        "worker_submission/producers=" + std::to_string(num_producers);
+    hipsycl::benchmarks::report(label, "throughput", num_tasks / t, "ops/s");
+  }
+}
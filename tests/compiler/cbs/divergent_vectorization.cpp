@@ -0,0 +1,65 @@
+// RUN: %acpp %s -o %t --acpp-targets=omp --acpp-use-accelerated-cpu
+// RUN: %t | FileCheck %s
+// RUN: %acpp %s -o %t --acpp-targets=omp --acpp-use-accelerated-cpu -O
+// RUN: %t | FileCheck %s
+// RUN: %acpp %s -o %t --acpp-targets=omp --acpp-use-accelerated-cpu -O -march=native -Rpass=hipsycl-region-vectorizer 2>&1 | FileCheck %s --check-prefix=REMARK
+// RUN: %t | FileCheck %s
+
+#include <iostream>
+
+#include <CL/sycl.hpp>
+
+int main()
+{
+  // not a multiple of any vector width, so the remainder loop is exercised as well
+  constexpr size_t local_size = 100;
+  constexpr size_t global_size = 400;
+
+  cl::sycl::queue queue;
+  std::vector<int> host_in;
+  for(size_t i = 0; i < global_size; ++i)
+  {
+    host_in.push_back(static_cast<int>(i));
+  }
+  std::vector<int> host_out(global_size);
+
+  {
+    cl::sycl::buffer<int, 1> in_buf{host_in.data(), host_in.size()};
+    cl::sycl::buffer<int, 1> out_buf{host_out.data(), host_out.size()};
+
+    queue.submit([&](cl::sycl::handler &cgh) {
+      using namespace cl::sycl::access;
+      auto in = in_buf.get_access<mode::read>(cgh);
+      auto out = out_buf.get_access<mode::discard_write>(cgh);
+
+      // REMARK: remark: vectorized work-item loop
+      cgh.parallel_for<class divergent_vectorization>(
+        cl::sycl::nd_range<1>{global_size, local_size},
+        [=](cl::sycl::nd_item<1> item) noexcept {
+          const int lid = static_cast<int>(item.get_local_id(0));
+          const auto gid = item.get_global_id(0);
+          const int x = in[gid];
+
+          int r;
+          if(x % 3 == 0)
+            r = x / 3 + lid;
+          else if(lid % 2)
+            r = in[(gid * 7) % global_size];
+          else
+            r = -x;
+          out[gid] = r;
+        });
+    });
+  }
+  for(size_t i = 0; i < global_size / local_size; ++i)
+  {
+    long sum = 0;
+    for(size_t j = 0; j < local_size; ++j)
+      sum += host_out[i * local_size + j];
+    // CHECK: 6441
+    // CHECK: 4900
+    // CHECK: 2559
+    // CHECK: 1241
+    std::cout << sum << "\n";
+  }
+}
@@ -0,0 +1,92 @@
+// RUN: %acpp %s -o %t --acpp-targets=omp --acpp-use-accelerated-cpu
+// RUN: %t | FileCheck %s
+// RUN: %acpp %s -o %t --acpp-targets=omp --acpp-use-accelerated-cpu -O
+// RUN: %t | FileCheck %s
+// RUN: env ACPP_RT_OMP_LOCAL_SIZE_SPECIALIZATION=0 %t | FileCheck %s
+// RUN: %acpp %s -o %t --acpp-targets=omp --acpp-use-accelerated-cpu -O -DHIPSYCL_CBS_LOCAL_SIZE_SPECIALIZATIONS_2D=8,16
+// RUN: %t | FileCheck %s
+
+#include <iostream>
+
+#include <CL/sycl.hpp>
+
+// 128 and 16x16 select the kernel versions compiled for a constant local size,
+// 96, 8x16 and 16x8 the generic versions. When compiled with 8x16 as the only
+// 2D specialization, 8x16 selects it and 16x16 and 16x8 must not.
+// The results depend on the local id in dimension 0, so that mixing up the
+// order of the dimensions is detected.
+template<int Dim>
+void run(cl::sycl::queue &queue, cl::sycl::range<Dim> global_size,
+         cl::sycl::range<Dim> local_size)
+{
+  const size_t num_elements = global_size.size();
+  const size_t group_size = local_size.size();
+
+  std::vector<int> host_in;
+  for(size_t i = 0; i < num_elements; ++i)
+  {
+    host_in.push_back(static_cast<int>(i));
+  }
+  std::vector<int> host_out(num_elements);
+
+  {
+    cl::sycl::buffer<int, 1> in_buf{host_in.data(), host_in.size()};
+    cl::sycl::buffer<int, 1> out_buf{host_out.data(), host_out.size()};
+
+    queue.submit([&](cl::sycl::handler &cgh) {
+      using namespace cl::sycl::access;
+      auto in = in_buf.get_access<mode::read>(cgh);
+      auto out = out_buf.get_access<mode::discard_write>(cgh);
+      auto scratch = cl::sycl::accessor<int, 1, mode::read_write, target::local>{
+          cl::sycl::range<1>{group_size}, cgh};
+
+      cgh.parallel_for(
+        cl::sycl::nd_range<Dim>{global_size, local_size},
+        [=](cl::sycl::nd_item<Dim> item) noexcept {
+          const size_t lid = item.get_local_linear_id();
+          const size_t n = item.get_local_range().size();
+          const size_t gid = item.get_group_linear_id() * n + lid;
+
+          scratch[lid] = in[gid];
+          item.barrier();
+          int x = scratch[n - 1 - lid];
+          item.barrier();
+          scratch[lid] = x;
+          item.barrier();
+          out[gid] = x + scratch[(lid + 1) % n] +
+                     static_cast<int>(item.get_local_id(0)) * 1000000;
+        });
+    });
+  }
+
+  size_t errors = 0;
+  for(size_t i = 0; i < num_elements; ++i)
+  {
+    const size_t group = i / group_size;
+    const size_t lid = i % group_size;
+    const auto reversed = [&](size_t l) {
+      return host_in[group * group_size + group_size - 1 - l];
+    };
+    const size_t lid0 = lid / (group_size / local_size[0]);
+    if(host_out[i] != reversed(lid) + reversed((lid + 1) % group_size) +
+                          static_cast<int>(lid0) * 1000000)
+      ++errors;
+  }
+  std::cout << group_size << ": " << errors << "\n";
+}
+
+int main()
+{
+  cl::sycl::queue queue;
+
+  // CHECK: 128: 0
+  run(queue, cl::sycl::range<1>{768}, cl::sycl::range<1>{128});
+  // CHECK: 96: 0
+  run(queue, cl::sycl::range<1>{768}, cl::sycl::range<1>{96});
+  // CHECK: 256: 0
+  run(queue, cl::sycl::range<2>{32, 32}, cl::sycl::range<2>{16, 16});
+  // CHECK: 128: 0
+  run(queue, cl::sycl::range<2>{32, 32}, cl::sycl::range<2>{8, 16});
+  // CHECK: 128: 0
+  run(queue, cl::sycl::range<2>{32, 32}, cl::sycl::range<2>{16, 8});
+}
@@ -0,0 +1,131 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2023 Aksel Alpay
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <algorithm>
+#include <execution>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "pstl_test_suite.hpp"
+
+BOOST_FIXTURE_TEST_SUITE(pstl_inclusive_scan, enable_unified_shared_memory)
+
+template<class Generator, class... Args>
+void test_inclusive_scan(std::size_t problem_size, Generator gen,
+                         Args... args) {
+  std::vector<int> data(problem_size);
+  for(int i = 0; i < data.size(); ++i)
+    data[i] = gen(i);
+
+  std::vector<int> device_out(problem_size);
+  std::vector<int> host_out(problem_size);
+
+  auto ret = std::inclusive_scan(std::execution::par_unseq, data.begin(),
+                                 data.end(), device_out.begin(), args...);
+  std::inclusive_scan(data.begin(), data.end(), host_out.begin(), args...);
+
+  BOOST_CHECK(device_out == host_out);
+  BOOST_CHECK(ret == device_out.begin() + problem_size);
+}
+
+auto gen = [](int i) { return i % 7 - 3; };
+
+BOOST_AUTO_TEST_CASE(par_unseq_empty) {
+  test_inclusive_scan(0, gen);
+}
+
+BOOST_AUTO_TEST_CASE(par_unseq_single_element) {
+  test_inclusive_scan(1, gen);
+}
+
+BOOST_AUTO_TEST_CASE(par_unseq_incomplete_tile) {
+  test_inclusive_scan(1000, gen);
+}
+
+BOOST_AUTO_TEST_CASE(par_unseq_large) {
+  test_inclusive_scan(1000*1000, gen);
+}
+
+BOOST_AUTO_TEST_CASE(par_unseq_op) {
+  test_inclusive_scan(1000*1000, gen, [](int a, int b){
+    return std::max(a, b);
+  });
+}
+
+BOOST_AUTO_TEST_CASE(par_unseq_op_init) {
+  test_inclusive_scan(1000*1000, gen, std::plus<>{}, 42);
+}
+
+BOOST_AUTO_TEST_CASE(par_unseq_in_place) {
+  std::size_t problem_size = 1000*1000;
+  std::vector<int> data(problem_size);
+  for(int i = 0; i < data.size(); ++i)
+    data[i] = gen(i);
+  std::vector<int> host_out(problem_size);
+  std::inclusive_scan(data.begin(), data.end(), host_out.begin());
+
+  std::inclusive_scan(std::execution::par_unseq, data.begin(), data.end(),
+                      data.begin());
+  BOOST_CHECK(data == host_out);
+}
+
+struct non_default_constructible {
+  explicit non_default_constructible(int x) : value{x} {}
+
+  friend bool operator==(const non_default_constructible &a,
+                         const non_default_constructible &b) {
+    return a.value == b.value;
+  }
+
+  int value;
+};
+
+BOOST_AUTO_TEST_CASE(par_unseq_non_default_constructible) {
+  std::size_t problem_size = 1000*1000;
+  std::vector<non_default_constructible> data;
+  for(int i = 0; i < problem_size; ++i)
+    data.push_back(non_default_constructible{gen(i)});
+
+  auto op = [](const non_default_constructible &a,
+               const non_default_constructible &b) {
+    return non_default_constructible{a.value + b.value};
+  };
+
+  std::vector<non_default_constructible> device_out(
+      problem_size, non_default_constructible{0});
+  std::vector<non_default_constructible> host_out(
+      problem_size, non_default_constructible{0});
+
+  std::inclusive_scan(std::execution::par_unseq, data.begin(), data.end(),
+                      device_out.begin(), op);
+  std::inclusive_scan(data.begin(), data.end(), host_out.begin(), op);
+  BOOST_CHECK(device_out == host_out);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
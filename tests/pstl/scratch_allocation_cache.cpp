@@ -0,0 +1,86 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <hipSYCL/algorithms/algorithm.hpp>
+#include <hipSYCL/algorithms/util/allocation_cache.hpp>
+
+#include "pstl_test_suite.hpp"
+
+BOOST_FIXTURE_TEST_SUITE(pstl_scratch_allocation_cache,
+                         enable_unified_shared_memory)
+
+namespace algorithms = hipsycl::algorithms;
+
+// Scratch allocation groups are released while the operations using them
+// are still in flight. Allocations evicted from a cache whose limit is
+// smaller than the scratch memory must not be freed at this point, but
+// only once those operations have completed.
+BOOST_AUTO_TEST_CASE(scratch_above_cache_limit) {
+  sycl::queue q{sycl::property::queue::in_order{}};
+  algorithms::util::allocation_cache cache{
+      algorithms::util::allocation_type::device, 1024};
+
+  // Large enough that scratch memory does not fit into the cache
+  const std::size_t problem_size = 1024 * 1024;
+  const int num_iterations = 4;
+
+  std::vector<std::vector<int>> data(num_iterations);
+  for(int it = 0; it < num_iterations; ++it) {
+    data[it].resize(problem_size);
+    for(std::size_t i = 0; i < problem_size; ++i)
+      data[it][i] = static_cast<int>((i * 7919 + it) % 100003);
+
+    algorithms::util::allocation_group scratch{&cache, q.get_device()};
+    algorithms::sort(q, scratch, data[it].begin(), data[it].end());
+  }
+
+  auto stats = cache.get_statistics();
+  BOOST_CHECK(stats.num_evictions > 0);
+  BOOST_CHECK(stats.cached_bytes <= 1024);
+  BOOST_CHECK(stats.evicted_bytes > 0);
+
+  q.wait();
+  {
+    // Accessing the cache frees evicted allocations that are
+    // no longer in use.
+    algorithms::util::allocation_group scratch{&cache, q.get_device()};
+    scratch.obtain<int>(1);
+    BOOST_CHECK(cache.get_statistics().evicted_bytes == 0);
+  }
+  cache.release_evicted_allocations();
+  BOOST_CHECK(cache.get_statistics().evicted_bytes == 0);
+
+  for(const auto& d : data)
+    BOOST_CHECK(std::is_sorted(d.begin(), d.end()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,94 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2023 Aksel Alpay
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <algorithm>
+#include <execution>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "pstl_test_suite.hpp"
+
+BOOST_FIXTURE_TEST_SUITE(pstl_sort, enable_unified_shared_memory)
+
+template<class T, class Generator, class... Compare>
+void test_sort(std::size_t problem_size, Generator gen, Compare... comp) {
+  std::mt19937 rng{123};
+  std::vector<T> data(problem_size);
+  for(std::size_t i = 0; i < problem_size; ++i)
+    data[i] = gen(rng);
+
+  std::vector<T> host_data = data;
+
+  std::sort(std::execution::par_unseq, data.begin(), data.end(), comp...);
+  std::sort(host_data.begin(), host_data.end(), comp...);
+
+  BOOST_CHECK(data == host_data);
+}
+
+BOOST_AUTO_TEST_CASE(par_unseq_empty) {
+  test_sort<int>(0, [](auto& rng) { return static_cast<int>(rng()); });
+}
+
+BOOST_AUTO_TEST_CASE(par_unseq_single_element) {
+  test_sort<int>(1, [](auto& rng) { return static_cast<int>(rng()); });
+}
+
+BOOST_AUTO_TEST_CASE(par_unseq_int) {
+  test_sort<int>(1000*1000, [](auto& rng) { return static_cast<int>(rng()); });
+}
+
+BOOST_AUTO_TEST_CASE(par_unseq_small_range) {
+  test_sort<unsigned>(1000*1000, [](auto& rng) { return rng() % 100; });
+}
+
+BOOST_AUTO_TEST_CASE(par_unseq_int64) {
+  test_sort<long long>(1000*1000, [](auto& rng) {
+    return static_cast<long long>(rng()) * rng() - (1ll << 60);
+  });
+}
+
+BOOST_AUTO_TEST_CASE(par_unseq_double) {
+  test_sort<double>(1000*1000, [](auto& rng) {
+    return (static_cast<int>(rng() % 20001) - 10000) * 0.37;
+  });
+}
+
+BOOST_AUTO_TEST_CASE(par_unseq_greater) {
+  test_sort<int>(
+      1000*1000, [](auto& rng) { return static_cast<int>(rng()); },
+      std::greater<>{});
+}
+
+BOOST_AUTO_TEST_CASE(par_unseq_custom_comparator) {
+  test_sort<int>(
+      1000*1000, [](auto& rng) { return static_cast<int>(rng() % 1000); },
+      [](int a, int b) { return (a % 10 < b % 10) || (a % 10 == b % 10 && a < b); });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
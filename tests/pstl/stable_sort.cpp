@@ -0,0 +1,115 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2023 Aksel Alpay
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <algorithm>
+#include <cmath>
+#include <execution>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "pstl_test_suite.hpp"
+
+BOOST_FIXTURE_TEST_SUITE(pstl_stable_sort, enable_unified_shared_memory)
+
+struct element {
+  int key;
+  int original_position;
+
+  friend bool operator==(const element& a, const element& b) {
+    return a.key == b.key && a.original_position == b.original_position;
+  }
+};
+
+void test_stable_sort(std::size_t problem_size, int num_distinct_keys) {
+  std::mt19937 rng{123};
+  std::vector<element> data(problem_size);
+  for(std::size_t i = 0; i < problem_size; ++i)
+    data[i] = element{static_cast<int>(rng() % num_distinct_keys),
+                      static_cast<int>(i)};
+
+  std::vector<element> host_data = data;
+
+  auto comp = [](const element &a, const element &b) { return a.key < b.key; };
+  std::stable_sort(std::execution::par_unseq, data.begin(), data.end(), comp);
+  std::stable_sort(host_data.begin(), host_data.end(), comp);
+
+  BOOST_CHECK(data == host_data);
+}
+
+BOOST_AUTO_TEST_CASE(par_unseq_empty) {
+  test_stable_sort(0, 10);
+}
+
+BOOST_AUTO_TEST_CASE(par_unseq_single_element) {
+  test_stable_sort(1, 10);
+}
+
+BOOST_AUTO_TEST_CASE(par_unseq_few_keys) {
+  test_stable_sort(1000*1000, 10);
+}
+
+BOOST_AUTO_TEST_CASE(par_unseq_many_keys) {
+  test_stable_sort(1000*1000, 100000);
+}
+
+BOOST_AUTO_TEST_CASE(par_unseq_arithmetic) {
+  std::mt19937 rng{123};
+  std::vector<float> data(1000*1000);
+  for(auto& x : data)
+    x = static_cast<float>(static_cast<int>(rng() % 2001) - 1000);
+  std::vector<float> host_data = data;
+
+  std::stable_sort(std::execution::par_unseq, data.begin(), data.end());
+  std::stable_sort(host_data.begin(), host_data.end());
+
+  BOOST_CHECK(data == host_data);
+}
+
+BOOST_AUTO_TEST_CASE(par_unseq_signed_zeros) {
+  // -0.0 and +0.0 compare equal, so their relative order must be preserved
+  std::mt19937 rng{123};
+  std::vector<double> data(1000*1000);
+  for(auto& x : data) {
+    int k = rng() % 4;
+    x = (k == 0) ? -0.0 : ((k == 1) ? 0.0 : static_cast<double>(k) - 2.5);
+  }
+  std::vector<double> host_data = data;
+
+  std::stable_sort(std::execution::par_unseq, data.begin(), data.end());
+  std::stable_sort(host_data.begin(), host_data.end());
+
+  bool is_same_order = true;
+  for(std::size_t i = 0; i < data.size(); ++i)
+    if(data[i] != host_data[i] ||
+       std::signbit(data[i]) != std::signbit(host_data[i]))
+      is_same_order = false;
+  BOOST_CHECK(is_same_order);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,77 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2023 Aksel Alpay
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <algorithm>
+#include <execution>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "pstl_test_suite.hpp"
+
+BOOST_FIXTURE_TEST_SUITE(pstl_transform_inclusive_scan,
+                         enable_unified_shared_memory)
+
+template<class... Args>
+void test_transform_inclusive_scan(std::size_t problem_size, Args... args) {
+  std::vector<int> data(problem_size);
+  for(int i = 0; i < data.size(); ++i)
+    data[i] = i % 13;
+
+  std::vector<long long> device_out(problem_size);
+  std::vector<long long> host_out(problem_size);
+
+  auto transformation = [](int x) -> long long { return 2 * x + 1; };
+
+  auto ret = std::transform_inclusive_scan(
+      std::execution::par_unseq, data.begin(), data.end(), device_out.begin(),
+      std::plus<>{}, transformation, args...);
+  std::transform_inclusive_scan(data.begin(), data.end(), host_out.begin(),
+                                std::plus<>{}, transformation, args...);
+
+  BOOST_CHECK(device_out == host_out);
+  BOOST_CHECK(ret == device_out.begin() + problem_size);
+}
+
+BOOST_AUTO_TEST_CASE(par_unseq_empty) {
+  test_transform_inclusive_scan(0);
+}
+
+BOOST_AUTO_TEST_CASE(par_unseq_single_element) {
+  test_transform_inclusive_scan(1);
+}
+
+BOOST_AUTO_TEST_CASE(par_unseq_large) {
+  test_transform_inclusive_scan(1000*1000);
+}
+
+BOOST_AUTO_TEST_CASE(par_unseq_init) {
+  test_transform_inclusive_scan(1000*1000, 10ll);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,290 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "runtime_test_suite.hpp"
+
+#include <cstdlib>
+#include <memory>
+#include <set>
+#include <vector>
+#include <hipSYCL/runtime/application.hpp>
+#include <hipSYCL/runtime/backend.hpp>
+#include <hipSYCL/runtime/caching_allocator.hpp>
+#include <hipSYCL/runtime/dag_node.hpp>
+#include <hipSYCL/runtime/executor.hpp>
+#include <hipSYCL/runtime/operations.hpp>
+#include <hipSYCL/runtime/runtime.hpp>
+#include <hipSYCL/runtime/submission_batch.hpp>
+
+using namespace hipsycl;
+
+namespace {
+
+rt::device_id get_host_device() {
+  return rt::device_id{
+      rt::backend_descriptor{rt::hardware_platform::cpu, rt::api_platform::omp},
+      0};
+}
+
+rt::dag_node_ptr submit_memset(rt::runtime *r,
+                               std::vector<unsigned char> &data) {
+  rt::execution_hints hints;
+  auto node = std::make_shared<rt::dag_node>(
+      hints, rt::node_list_t{},
+      std::make_unique<rt::memset_operation>(data.data(), 1, data.size()), r);
+
+  rt::backend_executor *executor =
+      r->backends().get(rt::backend_id::omp)->get_executor(get_host_device());
+  node->assign_to_device(get_host_device());
+  node->assign_to_executor(executor);
+  executor->submit_directly(node, node->get_operation(), {});
+  return node;
+}
+
+// Backend allocator that records all allocations that are
+// currently held by the caching_allocator
+class counting_allocator : public rt::backend_allocator {
+public:
+  void *allocate(size_t min_alignment, size_t size_bytes) override {
+    return do_allocate(min_alignment, size_bytes);
+  }
+
+  void *allocate_optimized_host(size_t min_alignment, size_t bytes) override {
+    return do_allocate(min_alignment, bytes);
+  }
+
+  void free(void *mem) override {
+    BOOST_REQUIRE(live_allocations.erase(mem) == 1);
+    std::free(mem);
+  }
+
+  void *allocate_usm(size_t bytes) override {
+    return do_allocate(0, bytes);
+  }
+
+  bool is_usm_accessible_from(rt::backend_descriptor b) const override {
+    return true;
+  }
+
+  rt::result query_pointer(const void *ptr,
+                           rt::pointer_info &out) const override {
+    return rt::make_success();
+  }
+
+  rt::result mem_advise(const void *addr, std::size_t num_bytes,
+                        int advise) const override {
+    return rt::make_success();
+  }
+
+  std::set<void*> live_allocations;
+  std::size_t num_allocations = 0;
+  bool fail_allocations = false;
+
+private:
+  void* do_allocate(size_t min_alignment, size_t size) {
+    if(fail_allocations)
+      return nullptr;
+    void* ptr = std::aligned_alloc(std::max(min_alignment, std::size_t{64}),
+                                   (size + 63) / 64 * 64);
+    live_allocations.insert(ptr);
+    ++num_allocations;
+    return ptr;
+  }
+};
+
+}
+
+BOOST_FIXTURE_TEST_SUITE(caching_allocator, reset_device_fixture)
+
+BOOST_AUTO_TEST_CASE(reuse) {
+  counting_allocator backend;
+  {
+    rt::caching_allocator alloc{&backend, get_host_device(), 1024 * 1024};
+
+    void *a = alloc.allocate(0, 1000);
+    BOOST_REQUIRE(a);
+    alloc.free(a);
+
+    // Same size class, so the block must be reused
+    void *b = alloc.allocate(0, 600);
+    BOOST_CHECK(b == a);
+    BOOST_CHECK(backend.num_allocations == 1);
+
+    // Different size class
+    void *c = alloc.allocate(0, 5000);
+    BOOST_CHECK(c != b);
+    BOOST_CHECK(backend.num_allocations == 2);
+
+    // Different kind of memory
+    void *d = alloc.allocate_usm(600);
+    BOOST_CHECK(d != b);
+    BOOST_CHECK(backend.num_allocations == 3);
+
+    auto stats = alloc.get_statistics();
+    BOOST_CHECK(stats.num_hits == 1);
+    BOOST_CHECK(stats.num_misses == 3);
+    BOOST_CHECK(stats.requested_bytes == 600 + 5000 + 600);
+    BOOST_CHECK(stats.allocated_bytes == 1024 + 8192 + 1024);
+    BOOST_CHECK(stats.cached_bytes == 0);
+
+    alloc.free(b);
+    alloc.free(c);
+    alloc.free(d);
+
+    stats = alloc.get_statistics();
+    BOOST_CHECK(stats.allocated_bytes == 0);
+    BOOST_CHECK(stats.cached_bytes == 1024 + 8192 + 1024);
+    // Nothing is returned to the backend while it fits into the cache
+    BOOST_CHECK(backend.live_allocations.size() == 3);
+  }
+  // Destroying the allocator releases all cached blocks
+  BOOST_CHECK(backend.live_allocations.empty());
+}
+
+BOOST_AUTO_TEST_CASE(alignment) {
+  counting_allocator backend;
+  rt::caching_allocator alloc{&backend, get_host_device(), 1024 * 1024};
+
+  void *a = alloc.allocate(0, 4096);
+  alloc.free(a);
+  void *b = alloc.allocate(4096, 4096);
+  BOOST_CHECK(reinterpret_cast<std::size_t>(b) % 4096 == 0);
+  alloc.free(b);
+}
+
+BOOST_AUTO_TEST_CASE(cache_limit) {
+  counting_allocator backend;
+  rt::caching_allocator alloc{&backend, get_host_device(), 4096};
+
+  std::vector<void*> blocks;
+  for(int i = 0; i < 8; ++i)
+    blocks.push_back(alloc.allocate(0, 1024));
+  for(void* b : blocks)
+    alloc.free(b);
+
+  auto stats = alloc.get_statistics();
+  BOOST_CHECK(stats.cached_bytes <= 4096);
+  BOOST_CHECK(stats.num_trims > 0);
+  BOOST_CHECK(backend.live_allocations.size() == 4);
+
+  alloc.trim();
+  BOOST_CHECK(alloc.get_statistics().cached_bytes == 0);
+  BOOST_CHECK(backend.live_allocations.empty());
+}
+
+BOOST_AUTO_TEST_CASE(oversized_requests_bypass_pool) {
+  counting_allocator backend;
+  rt::caching_allocator alloc{&backend, get_host_device(), 1024 * 1024};
+
+  std::size_t large_size = (std::size_t{1}
+                            << rt::caching_allocator::max_size_class) + 1;
+  void *a = alloc.allocate(0, large_size);
+  BOOST_REQUIRE(a);
+  alloc.free(a);
+  BOOST_CHECK(backend.live_allocations.empty());
+  BOOST_CHECK(alloc.get_statistics().cached_bytes == 0);
+}
+
+BOOST_AUTO_TEST_CASE(trim_on_allocation_failure) {
+  counting_allocator backend;
+  rt::caching_allocator alloc{&backend, get_host_device(), 1024 * 1024};
+
+  void *a = alloc.allocate(0, 1024);
+  alloc.free(a);
+  BOOST_CHECK(backend.live_allocations.size() == 1);
+
+  // A failing backend allocation releases cached blocks before
+  // giving up.
+  backend.fail_allocations = true;
+  BOOST_CHECK(alloc.allocate(0, 8192) == nullptr);
+  BOOST_CHECK(backend.live_allocations.empty());
+  BOOST_CHECK(alloc.get_statistics().cached_bytes == 0);
+}
+
+BOOST_AUTO_TEST_CASE(free_defers_reuse_until_device_operations_complete) {
+  rt::runtime_keep_alive_token rt;
+  counting_allocator backend;
+  rt::caching_allocator alloc{&backend, get_host_device(), 1024 * 1024};
+  std::vector<unsigned char> data(1024 * 1024, 0);
+
+  void *a = alloc.allocate(0, 1000);
+  void *b = nullptr;
+  rt::dag_node_ptr node;
+  {
+    // The shared event of a submission batch only completes
+    // once the batch has ended.
+    rt::submission_batch batch;
+    node = submit_memset(rt.get(), data);
+    alloc.free(a);
+
+    // The operation might still use a, so it must not be handed out again
+    b = alloc.allocate(0, 1000);
+    BOOST_CHECK(b != a);
+    BOOST_CHECK(backend.num_allocations == 2);
+    alloc.free(b);
+    BOOST_CHECK(alloc.get_statistics().cached_bytes == 2 * 1024);
+  }
+  node->wait();
+
+  void *c = alloc.allocate(0, 1000);
+  BOOST_CHECK(c == a || c == b);
+  BOOST_CHECK(backend.num_allocations == 2);
+  alloc.free(c);
+}
+
+BOOST_AUTO_TEST_CASE(free_after_defers_reuse_until_event_completes) {
+  rt::runtime_keep_alive_token rt;
+  counting_allocator backend;
+  rt::caching_allocator alloc{&backend, get_host_device(), 1024 * 1024};
+  std::vector<unsigned char> data(1024 * 1024, 0);
+
+  void *a = alloc.allocate(0, 1000);
+  void *b = nullptr;
+  rt::dag_node_ptr node;
+  {
+    rt::submission_batch batch;
+    node = submit_memset(rt.get(), data);
+    alloc.free_after(a, node->get_event());
+    b = alloc.allocate(0, 1000);
+    BOOST_CHECK(b != a);
+
+    // Without an event, the block can be reused immediately
+    alloc.free_after(b, nullptr);
+    b = alloc.allocate(0, 1000);
+    BOOST_CHECK(b != a);
+    BOOST_CHECK(backend.num_allocations == 2);
+  }
+  node->wait();
+
+  void *c = alloc.allocate(0, 1000);
+  BOOST_CHECK(c == a);
+  BOOST_CHECK(backend.num_allocations == 2);
+  alloc.free(b);
+  alloc.free(c);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
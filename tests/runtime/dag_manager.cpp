@@ -0,0 +1,227 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include "hipSYCL/runtime/application.hpp"
+#include "hipSYCL/runtime/backend.hpp"
+#include "hipSYCL/runtime/dag_builder.hpp"
+#include "hipSYCL/runtime/dag_manager.hpp"
+#include "hipSYCL/runtime/executor.hpp"
+#include "hipSYCL/runtime/hints.hpp"
+#include "hipSYCL/runtime/operations.hpp"
+#include "hipSYCL/runtime/runtime.hpp"
+#include "runtime_test_suite.hpp"
+
+using namespace hipsycl;
+
+namespace {
+
+rt::device_id get_host_device() {
+  return rt::device_id{
+      rt::backend_descriptor{rt::hardware_platform::cpu, rt::api_platform::omp},
+      0};
+}
+
+// Forwards to the executor of the OpenMP backend, records the order in
+// which nodes are submitted, and reports selected operations as not ready
+// for submission, like kernels that are still being JIT-compiled.
+class recording_executor : public rt::backend_executor {
+public:
+  recording_executor(rt::backend_executor *executor) : _executor{executor} {}
+
+  bool is_inorder_queue() const override {
+    return _executor->is_inorder_queue();
+  }
+  bool is_outoforder_queue() const override {
+    return _executor->is_outoforder_queue();
+  }
+  bool is_taskgraph() const override { return _executor->is_taskgraph(); }
+
+  void submit_directly(rt::dag_node_ptr node, rt::operation *op,
+                       const rt::node_list_t &reqs) override {
+    {
+      std::lock_guard<std::mutex> lock{_mutex};
+      _submission_order.push_back(node.get());
+    }
+    _executor->submit_directly(node, op, reqs);
+  }
+
+  bool can_execute_on_device(const rt::device_id &dev) const override {
+    return _executor->can_execute_on_device(dev);
+  }
+
+  bool is_submitted_by_me(rt::dag_node_ptr node) const override {
+    return _executor->is_submitted_by_me(node);
+  }
+
+  bool prepare_operation(const rt::device_id &dev, rt::operation *op,
+                         rt::dag_node_ptr node) override {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _not_ready.count(op) == 0;
+  }
+
+  void set_not_ready(rt::operation *op) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _not_ready.insert(op);
+  }
+
+  std::vector<rt::dag_node *> get_submission_order() const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _submission_order;
+  }
+
+private:
+  rt::backend_executor *_executor;
+  mutable std::mutex _mutex;
+  std::unordered_set<rt::operation *> _not_ready;
+  std::vector<rt::dag_node *> _submission_order;
+};
+
+class dag_flush_test {
+public:
+  dag_flush_test(rt::runtime *r)
+      : _rt{r}, _executor{r->backends()
+                              .get(rt::backend_id::omp)
+                              ->get_executor(get_host_device())},
+        _build{r->dag()} {}
+
+  rt::dag_node_ptr add_memset(std::vector<unsigned char> &data,
+                              unsigned char pattern, bool ready,
+                              const std::vector<rt::dag_node_ptr> &deps = {}) {
+    auto op = std::make_unique<rt::memset_operation>(data.data(), pattern,
+                                                     data.size());
+    if(!ready)
+      _executor.set_not_ready(op.get());
+
+    rt::requirements_list reqs{_rt};
+    for(const auto &dep : deps)
+      reqs.add_node_requirement(dep);
+
+    rt::execution_hints hints;
+    hints.set_hint(rt::hints::bind_to_device{get_host_device()});
+    hints.set_hint(rt::hints::prefer_executor{&_executor});
+
+    return _build.builder()->add_command_group(std::move(op), reqs, hints);
+  }
+
+  std::vector<rt::dag_node *> flush() {
+    _rt->dag().flush_sync();
+    _rt->dag().wait();
+    return _executor.get_submission_order();
+  }
+
+private:
+  rt::runtime *_rt;
+  recording_executor _executor;
+  // Keeps all nodes in one DAG until flush() is called
+  rt::dag_build_guard _build;
+};
+
+std::vector<rt::dag_node *>
+as_raw(const std::vector<rt::dag_node_ptr> &nodes) {
+  std::vector<rt::dag_node *> result;
+  for(const auto &node : nodes)
+    result.push_back(node.get());
+  return result;
+}
+
+constexpr std::size_t num_bytes = 1024;
+
+}
+
+BOOST_FIXTURE_TEST_SUITE(dag_manager, reset_device_fixture)
+
+BOOST_AUTO_TEST_CASE(postponed_nodes_are_submitted_after_ready_nodes) {
+  rt::runtime_keep_alive_token rt;
+  dag_flush_test test{rt.get()};
+
+  std::vector<std::vector<unsigned char>> data(
+      5, std::vector<unsigned char>(num_bytes, 0));
+
+  // a is not ready. c depends on a, and d depends on a through c, so both
+  // must be postponed. b and e are independent of a.
+  auto a = test.add_memset(data[0], 1, false);
+  auto b = test.add_memset(data[1], 2, true);
+  auto c = test.add_memset(data[2], 3, true, {a});
+  auto d = test.add_memset(data[3], 4, true, {c});
+  auto e = test.add_memset(data[4], 5, true);
+
+  std::vector<rt::dag_node *> order = test.flush();
+  std::vector<rt::dag_node *> expected = as_raw({b, e, a, c, d});
+  BOOST_CHECK_EQUAL_COLLECTIONS(order.begin(), order.end(), expected.begin(),
+                                expected.end());
+
+  for(std::size_t i = 0; i < data.size(); ++i) {
+    BOOST_CHECK(data[i].front() == i + 1);
+    BOOST_CHECK(data[i].back() == i + 1);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(postponed_nodes_retain_submission_order) {
+  rt::runtime_keep_alive_token rt;
+  dag_flush_test test{rt.get()};
+
+  std::vector<std::vector<unsigned char>> data(
+      4, std::vector<unsigned char>(num_bytes, 0));
+
+  // Both a and c are not ready, b depends on a. Postponed nodes are
+  // submitted in the order in which they were added, which is a valid
+  // order for their dependencies.
+  auto a = test.add_memset(data[0], 1, false);
+  auto b = test.add_memset(data[1], 2, true, {a});
+  auto c = test.add_memset(data[2], 3, false);
+  auto d = test.add_memset(data[3], 4, true);
+
+  std::vector<rt::dag_node *> order = test.flush();
+  std::vector<rt::dag_node *> expected = as_raw({d, a, b, c});
+  BOOST_CHECK_EQUAL_COLLECTIONS(order.begin(), order.end(), expected.begin(),
+                                expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(ready_nodes_are_not_reordered) {
+  rt::runtime_keep_alive_token rt;
+  dag_flush_test test{rt.get()};
+
+  std::vector<std::vector<unsigned char>> data(
+      3, std::vector<unsigned char>(num_bytes, 0));
+
+  auto a = test.add_memset(data[0], 1, true);
+  auto b = test.add_memset(data[1], 2, true, {a});
+  auto c = test.add_memset(data[2], 3, true);
+
+  std::vector<rt::dag_node *> order = test.flush();
+  std::vector<rt::dag_node *> expected = as_raw({a, b, c});
+  BOOST_CHECK_EQUAL_COLLECTIONS(order.begin(), order.end(), expected.begin(),
+                                expected.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,170 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+#include <string_view>
+
+#include "hipSYCL/common/hcf_container.hpp"
+#include "runtime_test_suite.hpp"
+
+using namespace hipsycl;
+
+namespace {
+
+common::hcf_container make_test_container() {
+  common::hcf_container hcf;
+  hcf.root_node()->set("object-id", "12345");
+  hcf.root_node()->set("generator", "rt_tests");
+
+  auto *images = hcf.root_node()->add_subnode("images");
+  auto *image = images->add_subnode("llvm-ir.global");
+  image->set("format", "llvm-ir");
+  hcf.attach_binary_content(image, std::string(64, 'x'));
+
+  auto *kernels = hcf.root_node()->add_subnode("kernels");
+  for(int i = 0; i < 3; ++i) {
+    auto *kernel = kernels->add_subnode("kernel" + std::to_string(i));
+    kernel->set_as_list("image-providers", {"llvm-ir.global"});
+    auto *params = kernel->add_subnode("parameters");
+    for(int j = 0; j < 2; ++j) {
+      auto *p = params->add_subnode(std::to_string(j));
+      p->set("byte-offset", std::to_string(8 * j));
+      p->set("byte-size", "8");
+    }
+  }
+  return hcf;
+}
+
+// Loads data in all ways that an application may load it, and accesses
+// all binary attachments. None of this may throw, even for invalid data.
+void load_and_access(const std::string &data) {
+  common::hcf_container copied{data};
+  auto viewed = common::hcf_container::from_static_data(data);
+
+  std::string attachment;
+  for(const auto *c : {&copied, &viewed}) {
+    if(const auto *images = c->root_node()->get_subnode("images"))
+      for(const auto &image : images->subnodes)
+        c->get_binary_attachment(&image, attachment);
+  }
+
+  common::hcf_binary_view view{data};
+  if(view.is_valid()) {
+    std::string_view binary;
+    for(std::size_t i = 0; i < view.get_num_nodes(); ++i)
+      view.get_binary_attachment(i, binary);
+  }
+}
+
+// node::set() appends values, so existing values are replaced here
+void replace_value(common::hcf_container::node *n, const std::string &key,
+                   const std::string &value) {
+  for(auto &kv : n->key_value_pairs)
+    if(kv.first == key)
+      kv.second = value;
+}
+
+}
+
+BOOST_FIXTURE_TEST_SUITE(hcf_container, reset_device_fixture)
+
+BOOST_AUTO_TEST_CASE(text_binary_roundtrip) {
+  common::hcf_container original = make_test_container();
+  std::string text = original.serialize();
+  std::string binary = original.serialize_binary();
+  BOOST_CHECK(common::hcf_binary_view::is_binary_hcf(binary));
+  BOOST_CHECK(!common::hcf_binary_view::is_binary_hcf(text));
+
+  common::hcf_container from_binary{binary};
+  BOOST_CHECK(from_binary.serialize() == text);
+  BOOST_CHECK(common::hcf_container{text}.serialize_binary() == binary);
+
+  const auto *image =
+      from_binary.root_node()->get_subnode("images")->get_subnode(
+          "llvm-ir.global");
+  BOOST_REQUIRE(image);
+  std::string attachment;
+  BOOST_CHECK(from_binary.get_binary_attachment(image, attachment));
+  BOOST_CHECK(attachment == std::string(64, 'x'));
+
+  common::hcf_binary_view view{binary};
+  BOOST_REQUIRE(view.is_valid());
+  auto images = view.get_subnode(view.root(), "images");
+  auto view_image = view.get_subnode(images, "llvm-ir.global");
+  std::string_view view_attachment;
+  BOOST_CHECK(view.get_binary_attachment(view_image, view_attachment));
+  BOOST_CHECK(view_attachment == std::string(64, 'x'));
+}
+
+BOOST_AUTO_TEST_CASE(truncated_binary_hcf) {
+  std::string binary = make_test_container().serialize_binary();
+
+  for(std::size_t size = 0; size < binary.size(); ++size) {
+    std::string truncated = binary.substr(0, size);
+    BOOST_TEST_INFO("size: " << size);
+    BOOST_CHECK_NO_THROW(load_and_access(truncated));
+    // The binary appendix comes last, so every truncation cuts into it
+    BOOST_CHECK(common::hcf_container{truncated}.root_node()->subnodes.empty());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(corrupted_binary_hcf) {
+  std::string binary = make_test_container().serialize_binary();
+
+  for(std::size_t pos = 0; pos < binary.size(); ++pos) {
+    for(unsigned char mask : {0x01, 0x80, 0xff}) {
+      std::string corrupted = binary;
+      corrupted[pos] = static_cast<char>(corrupted[pos] ^ mask);
+      BOOST_TEST_INFO("byte: " << pos << ", mask: " << int{mask});
+      BOOST_CHECK_NO_THROW(load_and_access(corrupted));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(invalid_binary_attachment_address) {
+  common::hcf_container hcf;
+  auto *image = hcf.root_node()->add_subnode("image");
+  hcf.attach_binary_content(image, "data");
+  auto *descriptor = image->get_subnode("__binary");
+  replace_value(descriptor, "start", "not-a-number");
+
+  std::string attachment;
+  BOOST_CHECK(!hcf.get_binary_attachment(image, attachment));
+
+  replace_value(descriptor, "start", "0");
+  replace_value(descriptor, "size", "99999999999999999999999");
+  BOOST_CHECK(!hcf.get_binary_attachment(image, attachment));
+
+  std::string binary = hcf.serialize_binary();
+  common::hcf_binary_view view{binary};
+  BOOST_REQUIRE(view.is_valid());
+  std::string_view view_attachment;
+  BOOST_CHECK(!view.get_binary_attachment(
+      view.get_subnode(view.root(), "image"), view_attachment));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,137 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "runtime_test_suite.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <numeric>
+#include <thread>
+#include <vector>
+#include <hipSYCL/runtime/generic/host_thread_pool.hpp>
+
+using namespace hipsycl;
+
+namespace {
+
+// Mirrors how the OpenMP kernel launcher performs reductions inside the
+// pool: Each thread reduces a static part of the range into its own slot,
+// and the partial results are combined after run() returns.
+struct reduction_task {
+  std::uint64_t problem_size;
+  std::vector<std::uint64_t> partial_results;
+  std::vector<int> invocation_counts;
+
+  static void execute(void *data, int thread_id, int num_threads) {
+    auto *task = static_cast<reduction_task *>(data);
+    std::uint64_t chunk =
+        (task->problem_size + num_threads - 1) / num_threads;
+    std::uint64_t begin = thread_id * chunk;
+    std::uint64_t end = std::min(begin + chunk, task->problem_size);
+
+    std::uint64_t sum = 0;
+    for(std::uint64_t i = begin; i < end; ++i)
+      sum += i;
+    task->partial_results[thread_id] = sum;
+    ++task->invocation_counts[thread_id];
+  }
+
+  std::uint64_t launch(rt::host_thread_pool &pool) {
+    int num_threads = pool.get_num_threads();
+    partial_results.assign(num_threads, 0);
+    invocation_counts.assign(num_threads, 0);
+    pool.run(&reduction_task::execute, this);
+    return std::accumulate(partial_results.begin(), partial_results.end(),
+                           std::uint64_t{0});
+  }
+};
+
+bool is_invoked_once_per_thread(const reduction_task &task) {
+  for(int count : task.invocation_counts)
+    if(count != 1)
+      return false;
+  return true;
+}
+
+std::uint64_t expected_sum(std::uint64_t n) { return n * (n - 1) / 2; }
+
+}
+
+BOOST_FIXTURE_TEST_SUITE(host_thread_pool, reset_device_fixture)
+
+BOOST_AUTO_TEST_CASE(reduction) {
+  rt::host_thread_pool pool{4};
+  BOOST_CHECK(pool.get_num_threads() == 4);
+
+  // Back-to-back launches are picked up by spinning workers, launches
+  // after a pause by workers that have gone to sleep.
+  for(int i = 0; i < 100; ++i) {
+    if(i % 25 == 0)
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    reduction_task task{static_cast<std::uint64_t>(1000 + i)};
+    BOOST_CHECK(task.launch(pool) == expected_sum(task.problem_size));
+    BOOST_CHECK(is_invoked_once_per_thread(task));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_launches) {
+  rt::host_thread_pool pool{3};
+
+  // run() may be called concurrently, e.g. by the worker threads
+  // of multiple queues. Launches must not interfere.
+  constexpr int num_launching_threads = 4;
+  std::vector<int> num_errors(num_launching_threads, 0);
+  std::vector<std::thread> launching_threads;
+  for(int t = 0; t < num_launching_threads; ++t) {
+    launching_threads.emplace_back([&, t]() {
+      for(int i = 0; i < 200; ++i) {
+        reduction_task task{static_cast<std::uint64_t>(100 * t + i)};
+        if(task.launch(pool) != expected_sum(task.problem_size) ||
+           !is_invoked_once_per_thread(task))
+          ++num_errors[t];
+      }
+    });
+  }
+  for(auto& t : launching_threads)
+    t.join();
+
+  for(int errors : num_errors)
+    BOOST_CHECK(errors == 0);
+}
+
+BOOST_AUTO_TEST_CASE(single_thread) {
+  rt::host_thread_pool pool{0};
+  BOOST_CHECK(pool.get_num_threads() == 1);
+
+  reduction_task task{12345};
+  BOOST_CHECK(task.launch(pool) == expected_sum(task.problem_size));
+  BOOST_CHECK(is_invoked_once_per_thread(task));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
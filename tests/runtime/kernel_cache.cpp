@@ -0,0 +1,233 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "hipSYCL/common/hcf_container.hpp"
+#include "hipSYCL/glue/kernel_configuration.hpp"
+#include "hipSYCL/runtime/application.hpp"
+#include "hipSYCL/runtime/async_errors.hpp"
+#include "hipSYCL/runtime/kernel_cache.hpp"
+#include "runtime_test_suite.hpp"
+
+using namespace hipsycl;
+
+namespace {
+
+struct throwing_construction_test_kernel {};
+
+common::hcf_container make_hcf(rt::hcf_object_id id,
+                               const std::string &kernel_name,
+                               const std::string &exported_symbol) {
+  common::hcf_container hcf;
+  hcf.root_node()->set("object-id", std::to_string(id));
+  auto *image =
+      hcf.root_node()->add_subnode("images")->add_subnode("llvm-ir.global");
+  image->set("format", "llvm-ir");
+  image->set("variant", "global-module");
+  image->set_as_list("exported-symbols", {exported_symbol});
+
+  auto *kernel =
+      hcf.root_node()->add_subnode("kernels")->add_subnode(kernel_name);
+  kernel->add_subnode("image-providers")->add_subnode("llvm-ir.global");
+  auto *param = kernel->add_subnode("parameters")->add_subnode("0");
+  param->set("byte-offset", "0");
+  param->set("byte-size", "8");
+  param->set("original-index", "0");
+  param->set("type", "pointer");
+  return hcf;
+}
+
+std::vector<rt::hcf_object_id> lookup_providers(const std::string &symbol) {
+  std::vector<rt::hcf_object_id> ids;
+  rt::hcf_cache::get().symbol_lookup(
+      {symbol}, [&](const std::string &,
+                    const rt::hcf_cache::symbol_resolver_list &providers) {
+        for(const auto &p : providers)
+          ids.push_back(p.hcf_id);
+      });
+  return ids;
+}
+
+}
+
+BOOST_FIXTURE_TEST_SUITE(kernel_cache, reset_device_fixture)
+
+BOOST_AUTO_TEST_CASE(construction_key_distinguishes_specialized_kernels) {
+  // Argument-specialized variants only contain the kernel they were
+  // specialized for. Variants of two kernels from the same image with the
+  // same specialized value must therefore not share a construction.
+  glue::kernel_configuration config;
+  int value = 42;
+  config.set_specialized_argument(0, &value, sizeof(value));
+  const auto config_id = config.generate_id();
+
+  auto make_key = [&](const std::vector<std::string> &kernel_names) {
+    return rt::kernel_cache::make_construction_key(
+        rt::backend_id::cuda, 0, 1, "image", kernel_names, config_id);
+  };
+
+  BOOST_CHECK(make_key({"kernel_a"}) != make_key({"kernel_b"}));
+  BOOST_CHECK(make_key({"kernel_a"}) == make_key({"kernel_a"}));
+  BOOST_CHECK(make_key({"kernel_a"}) != make_key({"kernel_a", "kernel_b"}));
+
+  glue::kernel_configuration other_config;
+  int other_value = 43;
+  other_config.set_specialized_argument(0, &other_value, sizeof(other_value));
+  BOOST_CHECK(make_key({"kernel_a"}) !=
+              rt::kernel_cache::make_construction_key(
+                  rt::backend_id::cuda, 0, 1, "image", {"kernel_a"},
+                  other_config.generate_id()));
+}
+
+BOOST_AUTO_TEST_CASE(throwing_construction_does_not_block_waiters) {
+  auto cache = rt::kernel_cache::get();
+  cache->register_kernel<throwing_construction_test_kernel>();
+  const auto *kidx = cache->get_global_kernel_index(
+      cache->get_global_kernel_name<throwing_construction_test_kernel>());
+  BOOST_REQUIRE(kidx);
+
+  std::atomic<int> num_constructions{0};
+  auto construct = [&]() {
+    auto selector = [](const rt::code_object *) { return false; };
+    auto constructor = [&]() -> rt::code_object * {
+      ++num_constructions;
+      throw std::runtime_error{"construction failed"};
+    };
+    return cache->get_or_construct_code_object_async(
+        *kidx, "throwing_construction_test_kernel", rt::backend_id::omp, 0,
+        "throwing_construction_test", selector, constructor);
+  };
+
+  // Both requests may share the construction
+  auto first = construct();
+  auto second = construct();
+  for(auto *f : {&first, &second}) {
+    BOOST_REQUIRE(f->wait_for(std::chrono::seconds{30}) ==
+                  std::future_status::ready);
+    BOOST_CHECK(f->get() == nullptr);
+  }
+  int num_initial_constructions = num_constructions;
+  BOOST_CHECK(num_initial_constructions >= 1);
+
+  // The failed construction must not remain pending
+  auto retry = construct();
+  BOOST_REQUIRE(retry.wait_for(std::chrono::seconds{30}) ==
+                std::future_status::ready);
+  BOOST_CHECK(retry.get() == nullptr);
+  BOOST_CHECK_EQUAL(num_constructions, num_initial_constructions + 1);
+
+  std::size_t num_errors = 0;
+  rt::application::errors().for_each_error(
+      [&](const rt::result &) { ++num_errors; });
+  BOOST_CHECK(num_errors >= 2);
+  rt::application::errors().clear();
+}
+
+BOOST_AUTO_TEST_CASE(hcf_snapshot_republication_during_lookups) {
+  auto &cache = rt::hcf_cache::get();
+  // Unlikely to collide with the ids of HCF objects embedded by the compiler
+  const rt::hcf_object_id stable_id = 18446744073709551501ull;
+  const rt::hcf_object_id first_churn_id = 18446744073709550000ull;
+  const std::string symbol = "__acpp_test_republication_symbol";
+  const std::string stable_kernel = "__acpp_test_republication_kernel";
+  // Enough registrations to grow the name table several times
+  constexpr std::size_t num_churn_objects = 300;
+  constexpr std::size_t num_readers = 4;
+
+  BOOST_REQUIRE(cache.register_hcf_object(
+                    make_hcf(stable_id, stable_kernel, symbol)) == stable_id);
+  const auto stable_kernel_id = cache.get_name_id(stable_kernel);
+  BOOST_REQUIRE(stable_kernel_id != rt::hcf_cache::invalid_name_id);
+
+  std::atomic<bool> done{false};
+  std::atomic<std::size_t> num_errors{0};
+  auto reader = [&]() {
+    while(!done.load(std::memory_order_relaxed)) {
+      const auto *info = cache.get_kernel_info(stable_id, stable_kernel);
+      if(!info || info->get_hcf_object_id() != stable_id ||
+         cache.get_kernel_info(stable_id, stable_kernel_id) != info ||
+         cache.get_name_id(stable_kernel) != stable_kernel_id)
+        ++num_errors;
+
+      // The stable object must always be the first provider, followed
+      // by at most the currently registered churn object.
+      auto providers = lookup_providers(symbol);
+      if(providers.empty() || providers.front() != stable_id ||
+         providers.size() > 2 ||
+         (providers.size() == 2 &&
+          (providers[1] < first_churn_id ||
+           providers[1] >= first_churn_id + num_churn_objects)))
+        ++num_errors;
+    }
+  };
+
+  std::vector<std::thread> readers;
+  for(std::size_t i = 0; i < num_readers; ++i)
+    readers.emplace_back(reader);
+
+  std::vector<rt::hcf_cache::name_id> churn_kernel_ids;
+  for(std::size_t i = 0; i < num_churn_objects; ++i) {
+    const rt::hcf_object_id id = first_churn_id + i;
+    const std::string kernel = stable_kernel + "_" + std::to_string(i);
+    cache.register_hcf_object(make_hcf(id, kernel, symbol));
+
+    churn_kernel_ids.push_back(cache.get_name_id(kernel));
+    BOOST_CHECK(churn_kernel_ids.back() != rt::hcf_cache::invalid_name_id);
+    BOOST_CHECK(cache.get_kernel_info(id, kernel) != nullptr);
+    BOOST_CHECK(lookup_providers(symbol) ==
+                (std::vector<rt::hcf_object_id>{stable_id, id}));
+
+    cache.unregister_hcf_object(id);
+    BOOST_CHECK(cache.get_hcf(id) == nullptr);
+    BOOST_CHECK(lookup_providers(symbol) ==
+                std::vector<rt::hcf_object_id>{stable_id});
+  }
+
+  done = true;
+  for(auto &t : readers)
+    t.join();
+  BOOST_CHECK_EQUAL(num_errors.load(), 0);
+
+  // Names remain interned after their objects have been unregistered
+  for(std::size_t i = 0; i < num_churn_objects; ++i)
+    BOOST_CHECK_EQUAL(
+        cache.get_name_id(stable_kernel + "_" + std::to_string(i)),
+        churn_kernel_ids[i]);
+  BOOST_CHECK_EQUAL(cache.get_name_id(stable_kernel), stable_kernel_id);
+
+  cache.unregister_hcf_object(stable_id);
+  BOOST_CHECK(lookup_providers(symbol).empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
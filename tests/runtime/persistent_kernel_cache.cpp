@@ -0,0 +1,192 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "runtime_test_suite.hpp"
+
+#include <chrono>
+#include <fstream>
+#include <random>
+#include <string>
+#include <hipSYCL/common/config.hpp>
+#include <hipSYCL/runtime/persistent_kernel_cache.hpp>
+
+#include HIPSYCL_CXX_FILESYSTEM_HEADER
+namespace fs = HIPSYCL_CXX_FILESYSTEM_NAMESPACE;
+
+using namespace hipsycl;
+
+namespace {
+
+struct cache_directory_fixture : public reset_device_fixture {
+  cache_directory_fixture() {
+    directory = fs::temp_directory_path() /
+                ("acpp-jit-cache-test-" + std::to_string(std::random_device{}()));
+    fs::create_directories(directory);
+  }
+
+  ~cache_directory_fixture() {
+    std::error_code ec;
+    fs::remove_all(directory, ec);
+  }
+
+  std::size_t count_files(const std::string& extension) const {
+    std::size_t count = 0;
+    for(const auto& entry : fs::directory_iterator{directory})
+      if(entry.path().filename().string().find(extension) != std::string::npos)
+        ++count;
+    return count;
+  }
+
+  fs::path directory;
+};
+
+std::string make_key(int i) {
+  rt::persistent_kernel_cache::key_builder builder;
+  builder(i);
+  return builder.get_key();
+}
+
+}
+
+BOOST_FIXTURE_TEST_SUITE(persistent_kernel_cache, cache_directory_fixture)
+
+BOOST_AUTO_TEST_CASE(store_and_retrieve) {
+  rt::persistent_kernel_cache cache{directory.string(), 1024 * 1024};
+  BOOST_REQUIRE(cache.is_enabled());
+
+  std::string binary = "binary";
+  binary.push_back('\0');
+  binary += "data";
+
+  std::string out;
+  BOOST_CHECK(!cache.retrieve(make_key(0), out));
+  cache.store(make_key(0), binary);
+  BOOST_CHECK(cache.retrieve(make_key(0), out));
+  BOOST_CHECK(out == binary);
+  BOOST_CHECK(!cache.retrieve(make_key(1), out));
+
+  BOOST_CHECK(cache.get_num_hits() == 1);
+  BOOST_CHECK(cache.get_num_misses() == 2);
+
+  // The temporary file must have been renamed to the entry
+  BOOST_CHECK(count_files(".tmp") == 0);
+  BOOST_CHECK(count_files(".acppjit") == 1);
+
+  // Another cache instance sharing the directory sees the entry
+  rt::persistent_kernel_cache other{directory.string(), 1024 * 1024};
+  BOOST_CHECK(other.retrieve(make_key(0), out));
+  BOOST_CHECK(out == binary);
+}
+
+BOOST_AUTO_TEST_CASE(truncated_entry_is_rejected) {
+  rt::persistent_kernel_cache cache{directory.string(), 1024 * 1024};
+  cache.store(make_key(0), std::string(1000, 'x'));
+
+  for(const auto& entry : fs::directory_iterator{directory})
+    fs::resize_file(entry.path(), 100);
+
+  std::string out;
+  BOOST_CHECK(!cache.retrieve(make_key(0), out));
+}
+
+BOOST_AUTO_TEST_CASE(invalid_payload_size_is_a_miss) {
+  rt::persistent_kernel_cache cache{directory.string(), 1024 * 1024};
+  cache.store(make_key(0), std::string(1000, 'x'));
+
+  // Overwrite the payload size, which directly follows magic, key size
+  // and key, with a value that cannot possibly be allocated.
+  const std::string key = make_key(0);
+  const std::uint64_t payload_size = ~std::uint64_t{0};
+  for(const auto& entry : fs::directory_iterator{directory}) {
+    std::fstream file{entry.path(),
+                      std::ios::binary | std::ios::in | std::ios::out};
+    file.seekp(8 + sizeof(std::uint64_t) + key.size());
+    file.write(reinterpret_cast<const char *>(&payload_size),
+               sizeof(payload_size));
+  }
+
+  std::string out;
+  BOOST_CHECK_NO_THROW(BOOST_CHECK(!cache.retrieve(key, out)));
+  BOOST_CHECK(cache.get_num_misses() == 1);
+  // The invalid entry is removed, so that it can be replaced
+  BOOST_CHECK(count_files(".acppjit") == 0);
+
+  cache.store(key, "binary");
+  BOOST_CHECK(cache.retrieve(key, out));
+  BOOST_CHECK(out == "binary");
+}
+
+BOOST_AUTO_TEST_CASE(least_recently_used_eviction) {
+  const std::size_t entry_size = 1000;
+  // Leaves room for two entries including their headers
+  rt::persistent_kernel_cache cache{directory.string(), 2 * entry_size + 200};
+
+  std::string out;
+  cache.store(make_key(0), std::string(entry_size, 'a'));
+  cache.store(make_key(1), std::string(entry_size, 'b'));
+
+  // Make entry 0 the most recently used one
+  for(const auto& entry : fs::directory_iterator{directory})
+    fs::last_write_time(entry.path(), fs::file_time_type::clock::now() -
+                                          std::chrono::minutes{10});
+  BOOST_CHECK(cache.retrieve(make_key(0), out));
+
+  cache.store(make_key(2), std::string(entry_size, 'c'));
+
+  BOOST_CHECK(count_files(".acppjit") == 2);
+  BOOST_CHECK(cache.retrieve(make_key(0), out));
+  BOOST_CHECK(!cache.retrieve(make_key(1), out));
+  BOOST_CHECK(cache.retrieve(make_key(2), out));
+  BOOST_CHECK(out == std::string(entry_size, 'c'));
+}
+
+BOOST_AUTO_TEST_CASE(temporary_files_are_only_reaped_when_stale) {
+  const std::size_t entry_size = 1000;
+  rt::persistent_kernel_cache cache{directory.string(), entry_size + 100};
+
+  // Simulate writes in progress by other processes
+  fs::path active_temporary = directory / (make_key(10) + ".acppjit.tmp1");
+  fs::path stale_temporary = directory / (make_key(11) + ".acppjit.tmp2");
+  for(const auto& p : {active_temporary, stale_temporary}) {
+    std::ofstream file{p.string(), std::ios::binary};
+    file << std::string(4 * entry_size, 't');
+  }
+  fs::last_write_time(stale_temporary, fs::file_time_type::clock::now() -
+                                           std::chrono::hours{2});
+
+  // Storing triggers eviction
+  cache.store(make_key(0), std::string(entry_size, 'a'));
+
+  BOOST_CHECK(fs::exists(active_temporary));
+  BOOST_CHECK(!fs::exists(stale_temporary));
+
+  // Temporary files do not count towards the cache size
+  std::string out;
+  BOOST_CHECK(cache.retrieve(make_key(0), out));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,220 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "hipSYCL/runtime/application.hpp"
+#include "hipSYCL/runtime/backend.hpp"
+#include "hipSYCL/runtime/batch_completion_event.hpp"
+#include "hipSYCL/runtime/dag_node.hpp"
+#include "hipSYCL/runtime/executor.hpp"
+#include "hipSYCL/runtime/operations.hpp"
+#include "hipSYCL/runtime/runtime.hpp"
+#include "hipSYCL/runtime/submission_batch.hpp"
+#include "runtime_test_suite.hpp"
+
+using namespace hipsycl;
+
+namespace {
+
+rt::device_id get_host_device() {
+  return rt::device_id{
+      rt::backend_descriptor{rt::hardware_platform::cpu, rt::api_platform::omp},
+      0};
+}
+
+rt::dag_node_ptr submit(rt::runtime *r, std::unique_ptr<rt::operation> op,
+                        const rt::node_list_t &reqs = {}) {
+  rt::execution_hints hints;
+  auto node = std::make_shared<rt::dag_node>(hints, reqs, std::move(op), r);
+
+  rt::backend_executor *executor =
+      r->backends().get(rt::backend_id::omp)->get_executor(get_host_device());
+  node->assign_to_device(get_host_device());
+  node->assign_to_executor(executor);
+  executor->submit_directly(node, node->get_operation(), reqs);
+  return node;
+}
+
+rt::dag_node_ptr submit_memset(rt::runtime *r, std::vector<unsigned char> &data,
+                               unsigned char pattern) {
+  return submit(r, std::make_unique<rt::memset_operation>(data.data(), pattern,
+                                                          data.size()));
+}
+
+rt::dag_node_ptr submit_memcpy(rt::runtime *r,
+                               std::vector<unsigned char> &source,
+                               std::vector<unsigned char> &dest,
+                               const rt::node_list_t &reqs) {
+  rt::range<3> shape{1, 1, source.size()};
+  rt::memory_location src{get_host_device(), source.data(), rt::id<3>{},
+                          shape, 1};
+  rt::memory_location dst{get_host_device(), dest.data(), rt::id<3>{},
+                          shape, 1};
+  return submit(r, std::make_unique<rt::memcpy_operation>(src, dst, shape),
+                reqs);
+}
+
+bool is_batch_event(const rt::dag_node_ptr &node) {
+  return dynamic_cast<rt::batch_completion_event_base *>(
+             node->get_event().get()) != nullptr;
+}
+
+bool is_resolved(const rt::dag_node_ptr &node) {
+  auto *evt = dynamic_cast<rt::batch_completion_event_base *>(
+      node->get_event().get());
+  return evt && evt->is_resolved();
+}
+
+constexpr std::size_t num_bytes = 1024 * 1024;
+
+}
+
+BOOST_FIXTURE_TEST_SUITE(submission_batch, reset_device_fixture)
+
+BOOST_AUTO_TEST_CASE(shared_event_completes_after_all_operations) {
+  rt::runtime_keep_alive_token rt;
+
+  constexpr int num_operations = 16;
+  std::vector<std::vector<unsigned char>> data(
+      num_operations, std::vector<unsigned char>(num_bytes, 0));
+
+  std::vector<rt::dag_node_ptr> nodes;
+  {
+    rt::submission_batch batch;
+    for(int i = 0; i < num_operations; ++i)
+      nodes.push_back(
+          submit_memset(rt.get(), data[i], static_cast<unsigned char>(i + 1)));
+
+    for(const auto& node : nodes) {
+      BOOST_CHECK(is_batch_event(node));
+      BOOST_CHECK(node->get_assigned_execution_lane() ==
+                  nodes.front()->get_assigned_execution_lane());
+      BOOST_CHECK(node->get_event() == nodes.front()->get_event());
+      // The shared event is only inserted once the batch ends
+      BOOST_CHECK(!is_resolved(node));
+      BOOST_CHECK(!node->get_event()->is_complete());
+    }
+  }
+  BOOST_CHECK(is_resolved(nodes.front()));
+
+  // Waiting on the first operation must not return before the last
+  // operation of the batch has completed.
+  nodes.front()->wait();
+  for(int i = 0; i < num_operations; ++i) {
+    BOOST_CHECK(nodes[i]->is_complete());
+    BOOST_CHECK(data[i].front() == i + 1);
+    BOOST_CHECK(data[i].back() == i + 1);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(cross_lane_dependency_resolves_event) {
+  rt::runtime_keep_alive_token rt;
+
+  std::vector<unsigned char> first(num_bytes, 0);
+  std::vector<unsigned char> second(num_bytes, 0);
+  std::vector<unsigned char> third(num_bytes, 0);
+
+  rt::dag_node_ptr producer, consumer, late_producer;
+  {
+    rt::submission_batch batch;
+    producer = submit_memset(rt.get(), first, 1);
+    BOOST_CHECK(!is_resolved(producer));
+
+    // The memcpy ends up on a different lane than the memset. Synchronizing
+    // with it must not wait for the end of the batch.
+    consumer = submit_memcpy(rt.get(), first, second,
+                             rt::node_list_t{producer});
+    BOOST_CHECK(consumer->get_assigned_execution_lane() !=
+                producer->get_assigned_execution_lane());
+    BOOST_CHECK(is_resolved(producer));
+
+    // Operations submitted to the producer lane afterwards are not covered by
+    // the already resolved event
+    late_producer = submit_memset(rt.get(), third, 3);
+    BOOST_CHECK(late_producer->get_event() != producer->get_event());
+    BOOST_CHECK(!is_resolved(late_producer));
+
+    producer->wait();
+    BOOST_CHECK(first.back() == 1);
+  }
+
+  consumer->wait();
+  late_producer->wait();
+  BOOST_CHECK(second.front() == 1);
+  BOOST_CHECK(second.back() == 1);
+  BOOST_CHECK(third.back() == 3);
+}
+
+BOOST_AUTO_TEST_CASE(resolution_from_other_threads) {
+  rt::runtime_keep_alive_token rt;
+
+  std::vector<unsigned char> first(num_bytes, 0);
+  std::vector<unsigned char> second(num_bytes, 0);
+
+  rt::dag_node_ptr producer, late_producer;
+  {
+    rt::submission_batch batch;
+    producer = submit_memset(rt.get(), first, 1);
+
+    auto *evt = dynamic_cast<rt::batch_completion_event_base *>(
+        producer->get_event().get());
+    BOOST_REQUIRE(evt);
+
+    std::vector<std::thread> threads;
+    for(int i = 0; i < 4; ++i)
+      threads.emplace_back([evt]() { evt->resolve(); });
+    for(auto &t : threads)
+      t.join();
+    BOOST_CHECK(is_resolved(producer));
+
+    // The executor must not attach new operations to the resolved event
+    late_producer = submit_memset(rt.get(), second, 2);
+    BOOST_CHECK(late_producer->get_event() != producer->get_event());
+    BOOST_CHECK(!is_resolved(late_producer));
+  }
+
+  producer->wait();
+  late_producer->wait();
+  BOOST_CHECK(first.back() == 1);
+  BOOST_CHECK(second.back() == 2);
+}
+
+BOOST_AUTO_TEST_CASE(no_batch_outside_scope) {
+  rt::runtime_keep_alive_token rt;
+
+  std::vector<unsigned char> data(num_bytes, 0);
+  BOOST_CHECK(rt::submission_batch::get_current() == nullptr);
+  auto node = submit_memset(rt.get(), data, 1);
+  BOOST_CHECK(!is_batch_event(node));
+  node->wait();
+  BOOST_CHECK(data.back() == 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
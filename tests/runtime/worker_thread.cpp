@@ -0,0 +1,128 @@
+/*
+ * This file is part of hipSYCL, a SYCL implementation based on CUDA/HIP
+ *
+ * Copyright (c) 2026 Aksel Alpay and contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "runtime_test_suite.hpp"
+
+#include <atomic>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <hipSYCL/runtime/generic/async_worker.hpp>
+
+using namespace hipsycl;
+
+BOOST_FIXTURE_TEST_SUITE(worker_thread, reset_device_fixture)
+
+// Enqueues many more tasks than the ring can hold while the worker is
+// blocked, so that most of them end up in the overflow list.
+BOOST_AUTO_TEST_CASE(overflow_ordering) {
+  constexpr int num_tasks = 4096;
+
+  std::vector<int> execution_order;
+  std::atomic<bool> is_released{false};
+  {
+    rt::worker_thread worker;
+    worker([&]() {
+      while (!is_released.load())
+        std::this_thread::yield();
+    });
+    for (int i = 0; i < num_tasks; ++i)
+      worker([&execution_order, i]() { execution_order.push_back(i); });
+
+    is_released = true;
+    worker.wait();
+    BOOST_CHECK(worker.queue_size() == 0);
+
+    // The worker must continue to accept tasks after the overflow
+    // list has been drained.
+    worker([&]() { execution_order.push_back(num_tasks); });
+    worker.wait();
+  }
+
+  BOOST_REQUIRE(execution_order.size() == num_tasks + 1);
+  for (int i = 0; i <= num_tasks; ++i)
+    BOOST_CHECK(execution_order[i] == i);
+}
+
+BOOST_AUTO_TEST_CASE(overflow_ordering_multiple_producers) {
+  constexpr int num_producers = 4;
+  constexpr int num_tasks_per_producer = 2048;
+
+  std::vector<std::vector<int>> execution_order(num_producers);
+  std::atomic<bool> is_released{false};
+  {
+    rt::worker_thread worker;
+    worker([&]() {
+      while (!is_released.load())
+        std::this_thread::yield();
+    });
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < num_producers; ++p) {
+      producers.emplace_back([&, p]() {
+        for (int i = 0; i < num_tasks_per_producer; ++i)
+          worker([&execution_order, p, i]() {
+            execution_order[p].push_back(i);
+          });
+      });
+    }
+    for (auto &t : producers)
+      t.join();
+
+    is_released = true;
+    worker.wait();
+  }
+
+  // Tasks from the same producer must run in the order they were submitted
+  for (int p = 0; p < num_producers; ++p) {
+    BOOST_REQUIRE(execution_order[p].size() == num_tasks_per_producer);
+    for (int i = 0; i < num_tasks_per_producer; ++i)
+      BOOST_CHECK(execution_order[p][i] == i);
+  }
+}
+
+// Tasks running on the worker may enqueue further tasks into the same
+// worker; this must not deadlock when the ring is full.
+BOOST_AUTO_TEST_CASE(recursive_enqueue_into_full_ring) {
+  constexpr int num_tasks = 1024;
+
+  std::vector<int> execution_order;
+  {
+    rt::worker_thread worker;
+    worker([&]() {
+      for (int i = 0; i < num_tasks; ++i)
+        worker([&execution_order, i]() { execution_order.push_back(i); });
+    });
+    worker.wait();
+  }
+
+  BOOST_REQUIRE(execution_order.size() == num_tasks);
+  for (int i = 0; i < num_tasks; ++i)
+    BOOST_CHECK(execution_order[i] == i);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
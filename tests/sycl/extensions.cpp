@@ -681,6 +681,104 @@ BOOST_AUTO_TEST_CASE(cg_property_prefer_execution_lane) {
 
 #endif
 
+#ifdef HIPSYCL_EXT_CG_PROPERTY_HOST_SCHEDULE
+
+template<class Schedule> class host_schedule_offset_kernel;
+template<class Schedule> class host_schedule_basic_kernel;
+template<class Schedule> class host_schedule_nd_range_kernel;
+template<class Schedule> class host_schedule_hierarchical_kernel;
+
+template<class Schedule>
+void test_host_schedule(sycl::queue& q, int* counts, std::size_t n) {
+  const sycl::property_list props{Schedule{}};
+  auto reset = [&]() {
+    for(std::size_t i = 0; i < n; ++i)
+      counts[i] = 0;
+  };
+  auto check = [&](auto expected) {
+    for(std::size_t i = 0; i < n; ++i)
+      BOOST_REQUIRE_EQUAL(counts[i], expected(i));
+  };
+
+  // Irregular cost per work item, so that threads run out of work
+  // at different times
+  auto work = [](std::size_t i) {
+    int x = 0;
+    for(std::size_t j = 0; j < (i % 64) * (i % 7); ++j)
+      x += static_cast<int>(j & 1);
+    return x;
+  };
+
+  reset();
+  q.submit(props, [&](sycl::handler& cgh) {
+    cgh.parallel_for<host_schedule_offset_kernel<Schedule>>(
+        sycl::range<3>{6, 12, 28}, sycl::id<3>{1, 1, 1},
+        [=](sycl::item<3> idx) {
+          std::size_t i = (idx[0] * 13 + idx[1]) * 29 + idx[2];
+          counts[i] += (work(i) >= 0) ? 1 : 0;
+        });
+  });
+  q.wait();
+  check([](std::size_t i) {
+    std::size_t x = i / (13 * 29), y = (i / 29) % 13, z = i % 29;
+    return (x && y && z) ? 1 : 0;
+  });
+
+  reset();
+  q.submit(props, [&](sycl::handler& cgh) {
+    cgh.parallel_for<host_schedule_basic_kernel<Schedule>>(
+        sycl::range<2>{7 * 13, 29}, [=](sycl::item<2> idx) {
+          std::size_t i = idx.get_linear_id();
+          counts[i] += (work(i) >= 0) ? 1 : 0;
+        });
+  });
+  q.wait();
+  check([](std::size_t) { return 1; });
+
+  reset();
+  q.submit(props, [&](sycl::handler& cgh) {
+    cgh.parallel_for<host_schedule_nd_range_kernel<Schedule>>(
+        sycl::nd_range<1>{sycl::range<1>{n}, sycl::range<1>{29}},
+        [=](sycl::nd_item<1> idx) {
+          std::size_t i = idx.get_global_linear_id();
+          counts[i] += (work(i) >= 0) ? 1 : 0;
+        });
+  });
+  q.wait();
+  check([](std::size_t) { return 1; });
+
+  reset();
+  q.submit(props, [&](sycl::handler& cgh) {
+    cgh.parallel_for_work_group<host_schedule_hierarchical_kernel<Schedule>>(
+        sycl::range<1>{n / 29}, sycl::range<1>{29}, [=](sycl::group<1> grp) {
+          grp.parallel_for_work_item([&](sycl::h_item<1> idx) {
+            std::size_t i = idx.get_global_id()[0];
+            counts[i] += (work(i) >= 0) ? 1 : 0;
+          });
+        });
+  });
+  q.wait();
+  check([](std::size_t) { return 1; });
+}
+
+BOOST_AUTO_TEST_CASE(cg_property_host_schedule) {
+  sycl::queue q{sycl::property::queue::in_order{}};
+
+  const std::size_t n = 7 * 13 * 29;
+  int* counts = sycl::malloc_shared<int>(n, q);
+
+  // The properties override the schedule selected by ACPP_RT_OMP_SCHEDULE
+  // for individual kernels, and must not change results.
+  test_host_schedule<sycl::property::command_group::hipSYCL_static_schedule>(
+      q, counts, n);
+  test_host_schedule<
+      sycl::property::command_group::hipSYCL_work_stealing_schedule>(q, counts,
+                                                                     n);
+  sycl::free(counts, q);
+}
+
+#endif
+
 #ifdef HIPSYCL_EXT_PREFETCH_HOST
 BOOST_AUTO_TEST_CASE(prefetch_host) {
   using namespace cl;
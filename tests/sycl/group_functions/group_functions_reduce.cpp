@@ -312,6 +312,46 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(sub_group_reduce, T, test_types) {
   }
 }
 
+// On the host, large types do not fit into the group scratch slots, so this
+// exercises the separately allocated scratch memory for the maximum group size.
+BOOST_AUTO_TEST_CASE(group_reduce_large_type_large_group) {
+  using T = sycl::vec<double, 16>;
+  sycl::queue queue;
+  if (queue.get_device().get_backend() != sycl::backend::omp)
+    return;
+
+  const size_t local_size =
+      queue.get_device().get_info<sycl::info::device::max_work_group_size>();
+  const size_t global_size = 2 * local_size;
+
+  std::vector<T> host_data(global_size);
+  for (size_t i = 0; i < global_size; ++i)
+    host_data[i] = T{static_cast<double>(i)};
+
+  {
+    sycl::buffer<T, 1> buf{host_data.data(), host_data.size()};
+    queue.submit([&](sycl::handler &cgh) {
+      auto acc = buf.get_access<sycl::access::mode::read_write>(cgh);
+      cgh.parallel_for<class group_reduce_large_type_large_group_kernel>(
+          sycl::nd_range<1>{global_size, local_size},
+          [=](sycl::nd_item<1> item) {
+            acc[item.get_global_id()] = sycl::reduce_over_group(
+                item.get_group(), acc[item.get_global_id()], std::plus<T>());
+          });
+    });
+  }
+
+  for (size_t i = 0; i < global_size; ++i) {
+    const size_t group_begin = i / local_size * local_size;
+    const double expected =
+        static_cast<double>(local_size) * (2 * group_begin + local_size - 1) / 2;
+    BOOST_TEST(host_data[i].s0() == expected);
+    BOOST_TEST(host_data[i].sF() == expected);
+    if (host_data[i].s0() != expected)
+      break;
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif
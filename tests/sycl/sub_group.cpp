@@ -25,6 +25,8 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <algorithm>
+#include <vector>
 
 #include "hipSYCL/sycl/info/device.hpp"
 #include "sycl_test_suite.hpp"
@@ -117,5 +119,110 @@ BOOST_AUTO_TEST_CASE(sub_group) {
 }
 
 
+// Sub-group collectives must also work when the local size is not a multiple
+// of the sub-group size and the last sub-group is incomplete.
+BOOST_AUTO_TEST_CASE(sub_group_collectives_partial) {
+  namespace s = cl::sycl;
+  s::queue q{s::property::queue::in_order{}};
+  const std::size_t sg_size =
+      q.get_device().get_info<s::info::device::sub_group_sizes>()[0];
+
+  const std::size_t local_size = 100;
+  const std::size_t global_size = 4 * local_size;
+
+  std::vector<int> reduce_result(global_size);
+  std::vector<int> scan_result(global_size);
+  std::vector<int> broadcast_result(global_size);
+  {
+    s::buffer<int> reduce_buff{reduce_result.data(), s::range<1>{global_size}};
+    s::buffer<int> scan_buff{scan_result.data(), s::range<1>{global_size}};
+    s::buffer<int> broadcast_buff{broadcast_result.data(),
+                                  s::range<1>{global_size}};
+
+    q.submit([&](s::handler &cgh) {
+      auto reduce_acc =
+          reduce_buff.get_access<s::access::mode::discard_write>(cgh);
+      auto scan_acc = scan_buff.get_access<s::access::mode::discard_write>(cgh);
+      auto broadcast_acc =
+          broadcast_buff.get_access<s::access::mode::discard_write>(cgh);
+
+      cgh.parallel_for<class sub_group_collectives_partial_kernel>(
+          s::nd_range<1>{global_size, local_size}, [=](s::nd_item<1> idx) {
+            s::sub_group sg = idx.get_sub_group();
+            int x = static_cast<int>(sg.get_local_linear_id()) + 1;
+            std::size_t gid = idx.get_global_linear_id();
+
+            reduce_acc[gid] = s::reduce_over_group(sg, x, s::plus<int>{});
+            scan_acc[gid] =
+                s::inclusive_scan_over_group(sg, x, s::plus<int>{});
+            broadcast_acc[gid] = s::group_broadcast(sg, x);
+          });
+    });
+  }
+
+  for(std::size_t i = 0; i < global_size; ++i) {
+    std::size_t lid = i % local_size;
+    std::size_t sg_begin = (lid / sg_size) * sg_size;
+    int n = static_cast<int>(std::min(sg_size, local_size - sg_begin));
+    int x = static_cast<int>(lid - sg_begin) + 1;
+
+    BOOST_TEST_INFO("i: " << i << ", sub-group size: " << sg_size);
+    BOOST_CHECK_EQUAL(reduce_result[i], n * (n + 1) / 2);
+    BOOST_CHECK_EQUAL(scan_result[i], x * (x + 1) / 2);
+    BOOST_CHECK_EQUAL(broadcast_result[i], 1);
+  }
+}
+
+// Different sub-groups of the same work group may take different paths
+// through the kernel, as long as all work items of one sub-group stay
+// together. Only sub-group 0 runs the reduction here.
+BOOST_AUTO_TEST_CASE(sub_group_divergent_collectives) {
+  namespace s = cl::sycl;
+  s::queue q{s::property::queue::in_order{}};
+  const std::size_t sg_size =
+      q.get_device().get_info<s::info::device::sub_group_sizes>()[0];
+
+  const std::size_t local_size = 64;
+  const std::size_t global_size = 4 * local_size;
+
+  std::vector<int> result(global_size);
+  {
+    s::buffer<int> buff{result.data(), s::range<1>{global_size}};
+
+    q.submit([&](s::handler &cgh) {
+      auto acc = buff.get_access<s::access::mode::discard_write>(cgh);
+
+      cgh.parallel_for<class sub_group_divergent_collectives_kernel>(
+          s::nd_range<1>{global_size, local_size}, [=](s::nd_item<1> idx) {
+            s::sub_group sg = idx.get_sub_group();
+            std::size_t gid = idx.get_global_linear_id();
+            int lid = static_cast<int>(sg.get_local_linear_id());
+
+            if(sg.get_group_linear_id() == 0)
+              acc[gid] = s::reduce_over_group(sg, 1, s::plus<int>{});
+            else if(sg.get_group_linear_id() % 2 == 1)
+              acc[gid] = s::group_broadcast(
+                  sg, lid + 5, sg.get_local_linear_range() - 1);
+            else
+              acc[gid] = 0;
+          });
+    });
+  }
+
+  for(std::size_t i = 0; i < global_size; ++i) {
+    std::size_t lid = i % local_size;
+    std::size_t sg_id = lid / sg_size;
+    std::size_t sg_range = std::min(sg_size, local_size - sg_id * sg_size);
+
+    int expected = 0;
+    if(sg_id == 0)
+      expected = static_cast<int>(sg_range);
+    else if(sg_id % 2 == 1)
+      expected = static_cast<int>(sg_range - 1) + 5;
+
+    BOOST_TEST_INFO("i: " << i << ", sub-group size: " << sg_size);
+    BOOST_CHECK_EQUAL(result[i], expected);
+  }
+}
 
 BOOST_AUTO_TEST_SUITE_END()